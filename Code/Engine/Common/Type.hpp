@@ -35,4 +35,6 @@ namespace PenFramework::PenEngine
 	using F64 = double;
 
 	static constexpr Usize BitsPerBytes = 8;
+	// 被不同线程频繁写入的数据按该字节数分隔，避免伪共享
+	static constexpr Usize CacheLineBytes = 64;
 }
\ No newline at end of file
@@ -0,0 +1,551 @@
+// File /Engine/Container/RingBuffer.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Memory/Memory.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace PenFramework::PenEngine
+{
+	namespace Detail
+	{
+		// 容量按2的幂取整，下标只需要与运算
+		constexpr Usize RingBufferCapacity(Usize capacity) noexcept
+		{
+			return std::bit_ceil(std::max<Usize>(capacity, 2));
+		}
+	}
+
+	// 单生产者单消费者的有界无锁队列
+	// 只能有一个线程调用Push系列函数，一个线程调用Pop系列函数
+	// 两端各自缓存对方的下标，只有看起来满或空时才读取对方的缓存行
+	template <typename T>
+	class SPSCRingBuffer
+	{
+	public:
+		using value_type = T;
+
+		// @brief 容量按2的幂向上取整，至少为2
+		explicit SPSCRingBuffer(Usize capacity);
+		SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+		SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+		~SPSCRingBuffer();
+
+		template <typename... Args>
+		bool TryEmplace(Args&&... args);
+		bool TryPush(const T& value) { return TryEmplace(value); }
+		bool TryPush(T&& value) { return TryEmplace(std::move(value)); }
+
+		// @brief 尽可能多地放入[first, last)中的元素，返回放入的个数，只发布一次下标
+		template <std::input_iterator InputIt>
+		Usize TryPushBatch(InputIt first, InputIt last);
+
+		std::optional<T> TryPop();
+
+		// @brief 最多取出maxCount个元素写入out，返回取出的个数，只发布一次下标
+		template <typename OutputIt>
+		Usize TryPopBatch(OutputIt out, Usize maxCount);
+
+		Usize Capacity() const noexcept { return m_mask + 1; }
+		// @brief 其他线程同时修改时只是近似值
+		Usize SizeApprox() const noexcept;
+		bool EmptyApprox() const noexcept { return SizeApprox() == 0; }
+	private:
+		T* m_buffer;
+		Usize m_mask;
+
+		// 消费者写入
+		alignas(CacheLineBytes) std::atomic<Usize> m_head = 0;
+		Usize m_cachedTail = 0;
+
+		// 生产者写入
+		alignas(CacheLineBytes) std::atomic<Usize> m_tail = 0;
+		Usize m_cachedHead = 0;
+
+		alignas(CacheLineBytes) std::byte m_padding[1] = {};
+	};
+
+	// 多生产者多消费者的有界无锁队列（Dmitry Vyukov的算法）
+	// 每个位置带一个序号，生产者与消费者通过CAS各自的下标认领位置，再通过位置的序号交接元素
+	template <typename T>
+	class MPMCRingBuffer
+	{
+	public:
+		using value_type = T;
+
+		// @brief 容量按2的幂向上取整，至少为2
+		explicit MPMCRingBuffer(Usize capacity);
+		MPMCRingBuffer(const MPMCRingBuffer&) = delete;
+		MPMCRingBuffer& operator=(const MPMCRingBuffer&) = delete;
+		~MPMCRingBuffer();
+
+		template <typename... Args>
+		bool TryEmplace(Args&&... args);
+		bool TryPush(const T& value) { return TryEmplace(value); }
+		bool TryPush(T&& value) { return TryEmplace(std::move(value)); }
+
+		// @brief 一次CAS认领连续的空位置，返回放入的个数
+		template <std::forward_iterator ForwardIt>
+		Usize TryPushBatch(ForwardIt first, ForwardIt last);
+
+		std::optional<T> TryPop();
+
+		// @brief 一次CAS认领连续的已写入位置，最多取出maxCount个元素写入out，返回取出的个数
+		template <typename OutputIt>
+		Usize TryPopBatch(OutputIt out, Usize maxCount);
+
+		Usize Capacity() const noexcept { return m_mask + 1; }
+		// @brief 其他线程同时修改时只是近似值
+		Usize SizeApprox() const noexcept;
+		bool EmptyApprox() const noexcept { return SizeApprox() == 0; }
+	private:
+		struct Cell
+		{
+			// 等于位置下标时可以写入，等于下标加一时可以读取
+			std::atomic<Usize> Sequence;
+			alignas(T) std::byte Storage[sizeof(T)];
+		};
+
+		static T* Element(Cell& cell) noexcept { return reinterpret_cast<T*>(cell.Storage); }
+
+		Cell* m_cells;
+		Usize m_mask;
+
+		alignas(CacheLineBytes) std::atomic<Usize> m_enqueuePos = 0;
+		alignas(CacheLineBytes) std::atomic<Usize> m_dequeuePos = 0;
+		alignas(CacheLineBytes) std::byte m_padding[1] = {};
+	};
+
+	// 在SPSCRingBuffer或MPMCRingBuffer之上增加阻塞的Push与Pop
+	// 满或空时通过std::atomic::wait睡眠，只有存在等待的线程时另一端才调用notify
+	// 等待标记由第一个发出通知的线程清除，被唤醒但尚未运行的线程不会让后续每次操作都进入内核
+	template <typename RingBuffer>
+	class BlockingRingBuffer
+	{
+	public:
+		using value_type = typename RingBuffer::value_type;
+
+		explicit BlockingRingBuffer(Usize capacity) : m_ring(capacity) {}
+
+		// @brief 队列满时等待
+		template <typename... Args>
+		void Emplace(Args&&... args);
+		void Push(const value_type& value) { Emplace(value); }
+		void Push(value_type&& value) { Emplace(std::move(value)); }
+
+		// @brief 队列空时等待
+		value_type Pop();
+
+		// @brief 放入[first, last)中的全部元素，队列满时等待
+		template <std::forward_iterator ForwardIt>
+		void PushBatch(ForwardIt first, ForwardIt last);
+
+		// @brief 至少取出一个元素，最多maxCount个，队列空时等待
+		template <typename OutputIt>
+		Usize PopBatch(OutputIt out, Usize maxCount);
+
+		template <typename... Args>
+		bool TryEmplace(Args&&... args);
+		bool TryPush(const value_type& value) { return TryEmplace(value); }
+		bool TryPush(value_type&& value) { return TryEmplace(std::move(value)); }
+		std::optional<value_type> TryPop();
+
+		Usize Capacity() const noexcept { return m_ring.Capacity(); }
+		Usize SizeApprox() const noexcept { return m_ring.SizeApprox(); }
+		bool EmptyApprox() const noexcept { return m_ring.EmptyApprox(); }
+	private:
+		// 等待的一方先读取计数，失败后在计数上等待，另一端成功后递增计数，计数变化时wait立即返回
+		void NotifyPushed() noexcept;
+		void NotifyPopped() noexcept;
+
+		RingBuffer m_ring;
+
+		alignas(CacheLineBytes) std::atomic<U32> m_pushCount = 0;
+		std::atomic<bool> m_popWaiting = false;
+		alignas(CacheLineBytes) std::atomic<U32> m_popCount = 0;
+		std::atomic<bool> m_pushWaiting = false;
+	};
+
+	template <typename T>
+	SPSCRingBuffer<T>::SPSCRingBuffer(Usize capacity) :
+		m_buffer(Memory::Allocate<T>(Detail::RingBufferCapacity(capacity), Memory::MemoryTag::Container)),
+		m_mask(Detail::RingBufferCapacity(capacity) - 1)
+	{
+	}
+
+	template <typename T>
+	SPSCRingBuffer<T>::~SPSCRingBuffer()
+	{
+		Usize tail = m_tail.load(std::memory_order::relaxed);
+		for (Usize i = m_head.load(std::memory_order::relaxed); i != tail; ++i)
+			Memory::Destroy(m_buffer + (i & m_mask));
+		Memory::Deallocate(m_buffer, m_mask + 1, Memory::MemoryTag::Container);
+	}
+
+	template <typename T>
+	template <typename... Args>
+	bool SPSCRingBuffer<T>::TryEmplace(Args&&... args)
+	{
+		Usize tail = m_tail.load(std::memory_order::relaxed);
+		if (tail - m_cachedHead > m_mask)
+		{
+			m_cachedHead = m_head.load(std::memory_order::acquire);
+			if (tail - m_cachedHead > m_mask)
+				return false;
+		}
+
+		Memory::Construct(m_buffer + (tail & m_mask), std::forward<Args>(args)...);
+		m_tail.store(tail + 1, std::memory_order::release);
+		return true;
+	}
+
+	template <typename T>
+	template <std::input_iterator InputIt>
+	Usize SPSCRingBuffer<T>::TryPushBatch(InputIt first, InputIt last)
+	{
+		Usize tail = m_tail.load(std::memory_order::relaxed);
+		Usize free = m_mask + 1 - (tail - m_cachedHead);
+		if (free == 0 || (std::sized_sentinel_for<InputIt, InputIt> && static_cast<Usize>(std::distance(first, last)) > free))
+		{
+			m_cachedHead = m_head.load(std::memory_order::acquire);
+			free = m_mask + 1 - (tail - m_cachedHead);
+		}
+
+		Usize count = 0;
+		for (; count < free && first != last; ++count, ++first)
+			Memory::Construct(m_buffer + ((tail + count) & m_mask), *first);
+
+		if (count != 0)
+			m_tail.store(tail + count, std::memory_order::release);
+		return count;
+	}
+
+	template <typename T>
+	std::optional<T> SPSCRingBuffer<T>::TryPop()
+	{
+		Usize head = m_head.load(std::memory_order::relaxed);
+		if (head == m_cachedTail)
+		{
+			m_cachedTail = m_tail.load(std::memory_order::acquire);
+			if (head == m_cachedTail)
+				return std::nullopt;
+		}
+
+		T* element = m_buffer + (head & m_mask);
+		std::optional<T> res(std::move(*element));
+		Memory::Destroy(element);
+		m_head.store(head + 1, std::memory_order::release);
+		return res;
+	}
+
+	template <typename T>
+	template <typename OutputIt>
+	Usize SPSCRingBuffer<T>::TryPopBatch(OutputIt out, Usize maxCount)
+	{
+		Usize head = m_head.load(std::memory_order::relaxed);
+		if (m_cachedTail - head < maxCount)
+			m_cachedTail = m_tail.load(std::memory_order::acquire);
+
+		Usize count = std::min(m_cachedTail - head, maxCount);
+		for (Usize i = 0; i < count; ++i)
+		{
+			T* element = m_buffer + ((head + i) & m_mask);
+			*out = std::move(*element);
+			++out;
+			Memory::Destroy(element);
+		}
+
+		if (count != 0)
+			m_head.store(head + count, std::memory_order::release);
+		return count;
+	}
+
+	template <typename T>
+	Usize SPSCRingBuffer<T>::SizeApprox() const noexcept
+	{
+		Usize head = m_head.load(std::memory_order::acquire);
+		Usize tail = m_tail.load(std::memory_order::acquire);
+		return tail - head <= m_mask + 1 ? tail - head : 0;
+	}
+
+	template <typename T>
+	MPMCRingBuffer<T>::MPMCRingBuffer(Usize capacity) :
+		m_cells(Memory::Allocate<Cell>(Detail::RingBufferCapacity(capacity), Memory::MemoryTag::Container)),
+		m_mask(Detail::RingBufferCapacity(capacity) - 1)
+	{
+		for (Usize i = 0; i <= m_mask; ++i)
+			std::construct_at(&m_cells[i].Sequence, i);
+	}
+
+	template <typename T>
+	MPMCRingBuffer<T>::~MPMCRingBuffer()
+	{
+		Usize end = m_enqueuePos.load(std::memory_order::relaxed);
+		for (Usize i = m_dequeuePos.load(std::memory_order::relaxed); i != end; ++i)
+			Memory::Destroy(Element(m_cells[i & m_mask]));
+		Memory::Deallocate(m_cells, m_mask + 1, Memory::MemoryTag::Container);
+	}
+
+	template <typename T>
+	template <typename... Args>
+	bool MPMCRingBuffer<T>::TryEmplace(Args&&... args)
+	{
+		Usize pos = m_enqueuePos.load(std::memory_order::relaxed);
+		while (true)
+		{
+			Cell& cell = m_cells[pos & m_mask];
+			Usize sequence = cell.Sequence.load(std::memory_order::acquire);
+			Isize diff = static_cast<Isize>(sequence - pos);
+			if (diff == 0)
+			{
+				if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order::relaxed))
+				{
+					Memory::Construct(Element(cell), std::forward<Args>(args)...);
+					cell.Sequence.store(pos + 1, std::memory_order::release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				// 该位置上一轮的元素还没有被取走，队列已满
+				return false;
+			}
+			else
+			{
+				pos = m_enqueuePos.load(std::memory_order::relaxed);
+			}
+		}
+	}
+
+	template <typename T>
+	template <std::forward_iterator ForwardIt>
+	Usize MPMCRingBuffer<T>::TryPushBatch(ForwardIt first, ForwardIt last)
+	{
+		Usize want = static_cast<Usize>(std::distance(first, last));
+		Usize pos = m_enqueuePos.load(std::memory_order::relaxed);
+		while (want != 0)
+		{
+			// 从pos开始数出连续的空位置，认领成功后这些位置只属于当前线程，序号不会再改变
+			Usize count = 0;
+			while (count < want && count <= m_mask && m_cells[(pos + count) & m_mask].Sequence.load(std::memory_order::acquire) == pos + count)
+				++count;
+
+			if (count == 0)
+			{
+				Usize sequence = m_cells[pos & m_mask].Sequence.load(std::memory_order::acquire);
+				if (static_cast<Isize>(sequence - pos) < 0)
+					return 0;
+				pos = m_enqueuePos.load(std::memory_order::relaxed);
+				continue;
+			}
+
+			if (m_enqueuePos.compare_exchange_weak(pos, pos + count, std::memory_order::relaxed))
+			{
+				for (Usize i = 0; i < count; ++i, ++first)
+				{
+					Cell& cell = m_cells[(pos + i) & m_mask];
+					Memory::Construct(Element(cell), *first);
+					cell.Sequence.store(pos + i + 1, std::memory_order::release);
+				}
+				return count;
+			}
+		}
+		return 0;
+	}
+
+	template <typename T>
+	std::optional<T> MPMCRingBuffer<T>::TryPop()
+	{
+		Usize pos = m_dequeuePos.load(std::memory_order::relaxed);
+		while (true)
+		{
+			Cell& cell = m_cells[pos & m_mask];
+			Usize sequence = cell.Sequence.load(std::memory_order::acquire);
+			Isize diff = static_cast<Isize>(sequence - (pos + 1));
+			if (diff == 0)
+			{
+				if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order::relaxed))
+				{
+					std::optional<T> res(std::move(*Element(cell)));
+					Memory::Destroy(Element(cell));
+					cell.Sequence.store(pos + m_mask + 1, std::memory_order::release);
+					return res;
+				}
+			}
+			else if (diff < 0)
+			{
+				// 该位置还没有写入，队列为空
+				return std::nullopt;
+			}
+			else
+			{
+				pos = m_dequeuePos.load(std::memory_order::relaxed);
+			}
+		}
+	}
+
+	template <typename T>
+	template <typename OutputIt>
+	Usize MPMCRingBuffer<T>::TryPopBatch(OutputIt out, Usize maxCount)
+	{
+		Usize pos = m_dequeuePos.load(std::memory_order::relaxed);
+		while (maxCount != 0)
+		{
+			Usize count = 0;
+			while (count < maxCount && count <= m_mask && m_cells[(pos + count) & m_mask].Sequence.load(std::memory_order::acquire) == pos + count + 1)
+				++count;
+
+			if (count == 0)
+			{
+				Usize sequence = m_cells[pos & m_mask].Sequence.load(std::memory_order::acquire);
+				if (static_cast<Isize>(sequence - (pos + 1)) < 0)
+					return 0;
+				pos = m_dequeuePos.load(std::memory_order::relaxed);
+				continue;
+			}
+
+			if (m_dequeuePos.compare_exchange_weak(pos, pos + count, std::memory_order::relaxed))
+			{
+				for (Usize i = 0; i < count; ++i)
+				{
+					Cell& cell = m_cells[(pos + i) & m_mask];
+					*out = std::move(*Element(cell));
+					++out;
+					Memory::Destroy(Element(cell));
+					cell.Sequence.store(pos + i + m_mask + 1, std::memory_order::release);
+				}
+				return count;
+			}
+		}
+		return 0;
+	}
+
+	template <typename T>
+	Usize MPMCRingBuffer<T>::SizeApprox() const noexcept
+	{
+		Usize dequeuePos = m_dequeuePos.load(std::memory_order::acquire);
+		Usize enqueuePos = m_enqueuePos.load(std::memory_order::acquire);
+		return enqueuePos - dequeuePos <= m_mask + 1 ? enqueuePos - dequeuePos : 0;
+	}
+
+	template <typename RingBuffer>
+	template <typename... Args>
+	void BlockingRingBuffer<RingBuffer>::Emplace(Args&&... args)
+	{
+		while (true)
+		{
+			U32 popCount = m_popCount.load(std::memory_order::seq_cst);
+			if (m_ring.TryEmplace(std::forward<Args>(args)...))
+				break;
+
+			m_pushWaiting.store(true, std::memory_order::seq_cst);
+			m_popCount.wait(popCount, std::memory_order::seq_cst);
+		}
+		NotifyPushed();
+	}
+
+	template <typename RingBuffer>
+	typename BlockingRingBuffer<RingBuffer>::value_type BlockingRingBuffer<RingBuffer>::Pop()
+	{
+		while (true)
+		{
+			U32 pushCount = m_pushCount.load(std::memory_order::seq_cst);
+			if (std::optional<value_type> res = m_ring.TryPop())
+			{
+				NotifyPopped();
+				return std::move(*res);
+			}
+
+			m_popWaiting.store(true, std::memory_order::seq_cst);
+			m_pushCount.wait(pushCount, std::memory_order::seq_cst);
+		}
+	}
+
+	template <typename RingBuffer>
+	template <std::forward_iterator ForwardIt>
+	void BlockingRingBuffer<RingBuffer>::PushBatch(ForwardIt first, ForwardIt last)
+	{
+		while (first != last)
+		{
+			U32 popCount = m_popCount.load(std::memory_order::seq_cst);
+			if (Usize count = m_ring.TryPushBatch(first, last); count != 0)
+			{
+				std::advance(first, count);
+				NotifyPushed();
+				continue;
+			}
+
+			m_pushWaiting.store(true, std::memory_order::seq_cst);
+			m_popCount.wait(popCount, std::memory_order::seq_cst);
+		}
+	}
+
+	template <typename RingBuffer>
+	template <typename OutputIt>
+	Usize BlockingRingBuffer<RingBuffer>::PopBatch(OutputIt out, Usize maxCount)
+	{
+		while (true)
+		{
+			U32 pushCount = m_pushCount.load(std::memory_order::seq_cst);
+			if (Usize count = m_ring.TryPopBatch(out, maxCount); count != 0)
+			{
+				NotifyPopped();
+				return count;
+			}
+
+			m_popWaiting.store(true, std::memory_order::seq_cst);
+			m_pushCount.wait(pushCount, std::memory_order::seq_cst);
+		}
+	}
+
+	template <typename RingBuffer>
+	template <typename... Args>
+	bool BlockingRingBuffer<RingBuffer>::TryEmplace(Args&&... args)
+	{
+		if (!m_ring.TryEmplace(std::forward<Args>(args)...))
+			return false;
+		NotifyPushed();
+		return true;
+	}
+
+	template <typename RingBuffer>
+	std::optional<typename BlockingRingBuffer<RingBuffer>::value_type> BlockingRingBuffer<RingBuffer>::TryPop()
+	{
+		std::optional<value_type> res = m_ring.TryPop();
+		if (res)
+			NotifyPopped();
+		return res;
+	}
+
+	template <typename RingBuffer>
+	void BlockingRingBuffer<RingBuffer>::NotifyPushed() noexcept
+	{
+		m_pushCount.fetch_add(1, std::memory_order::seq_cst);
+		if (m_popWaiting.load(std::memory_order::seq_cst) && m_popWaiting.exchange(false, std::memory_order::seq_cst))
+			m_pushCount.notify_all();
+	}
+
+	template <typename RingBuffer>
+	void BlockingRingBuffer<RingBuffer>::NotifyPopped() noexcept
+	{
+		m_popCount.fetch_add(1, std::memory_order::seq_cst);
+		if (m_pushWaiting.load(std::memory_order::seq_cst) && m_pushWaiting.exchange(false, std::memory_order::seq_cst))
+			m_popCount.notify_all();
+	}
+}
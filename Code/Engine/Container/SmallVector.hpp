@@ -0,0 +1,587 @@
+// File /Engine/Container/SmallVector.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Memory/Memory.hpp"
+#include "../Memory/Utils.hpp"
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+
+namespace PenFramework::PenEngine
+{
+	// 前N个元素存放在对象内部，超过后才分配堆内存
+	// 接口与std::vector相同，迭代器为指针，插入与扩容使之前的迭代器失效
+	// 堆内存默认经由Memory::Allocate分配并计入MemoryTag::Container，也可以指定一个std::pmr::memory_resource
+	// 元素可平凡搬动（Memory::IsTriviallyRelocatable）时，扩容、插入与删除都按字节整块搬动元素
+	template <typename T, Usize N>
+	class SmallVector
+	{
+		static_assert(N > 0, "SmallVector needs at least one inline element, use std::vector instead");
+	public:
+		using value_type = T;
+		using size_type = Usize;
+		using difference_type = Isize;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using iterator = T*;
+		using const_iterator = const T*;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		static constexpr Usize InlineCapacity = N;
+
+		SmallVector() noexcept : m_data(InlineData()) {}
+		explicit SmallVector(std::pmr::memory_resource* resource) noexcept : m_data(InlineData()), m_resource(resource) {}
+
+		explicit SmallVector(Usize count, std::pmr::memory_resource* resource = nullptr) : SmallVector(resource)
+		{
+			resize(count);
+		}
+
+		SmallVector(Usize count, const T& value, std::pmr::memory_resource* resource = nullptr) : SmallVector(resource)
+		{
+			assign(count, value);
+		}
+
+		template <std::input_iterator InputIt>
+		SmallVector(InputIt first, InputIt last, std::pmr::memory_resource* resource = nullptr) : SmallVector(resource)
+		{
+			assign(first, last);
+		}
+
+		SmallVector(std::initializer_list<T> list, std::pmr::memory_resource* resource = nullptr) : SmallVector(resource)
+		{
+			assign(list.begin(), list.end());
+		}
+
+		// 与std::pmr容器相同，复制构造不沿用other的内存资源
+		SmallVector(const SmallVector& other) : SmallVector(other.begin(), other.end()) {}
+
+		SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : SmallVector(other.m_resource)
+		{
+			StealOrMove(other);
+		}
+
+		~SmallVector() noexcept
+		{
+			Memory::DestroyForRange(begin(), end());
+			FreeHeapBuffer();
+		}
+
+		SmallVector& operator=(const SmallVector& other)
+		{
+			if (this != &other)
+				assign(other.begin(), other.end());
+			return *this;
+		}
+
+		SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+		{
+			if (this == &other)
+				return *this;
+
+			if (!other.IsInline() && m_resource == other.m_resource)
+			{
+				clear();
+				FreeHeapBuffer();
+				StealOrMove(other);
+				return *this;
+			}
+
+			assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+			other.clear();
+			return *this;
+		}
+
+		SmallVector& operator=(std::initializer_list<T> list)
+		{
+			assign(list.begin(), list.end());
+			return *this;
+		}
+
+		void assign(Usize count, const T& value)
+		{
+			if (count > m_capacity)
+			{
+				// value可能引用当前的元素，先构造到新缓冲区再释放旧元素
+				T* buffer = AllocateBuffer(count);
+				std::uninitialized_fill_n(buffer, count, value);
+				Memory::DestroyForRange(begin(), end());
+				FreeHeapBuffer();
+				m_data = buffer;
+				m_capacity = count;
+				m_size = count;
+				return;
+			}
+
+			std::fill_n(m_data, std::min(count, m_size), value);
+			if (count > m_size)
+				std::uninitialized_fill_n(m_data + m_size, count - m_size, value);
+			else
+				Memory::DestroyForRange(m_data + count, m_data + m_size);
+			m_size = count;
+		}
+
+		template <std::input_iterator InputIt>
+		void assign(InputIt first, InputIt last)
+		{
+			clear();
+			insert(end(), first, last);
+		}
+
+		void assign(std::initializer_list<T> list)
+		{
+			assign(list.begin(), list.end());
+		}
+
+		T& at(Usize pos)
+		{
+			if (pos >= m_size)
+				throw std::out_of_range("SmallVector::at");
+			return m_data[pos];
+		}
+
+		const T& at(Usize pos) const
+		{
+			if (pos >= m_size)
+				throw std::out_of_range("SmallVector::at");
+			return m_data[pos];
+		}
+
+		T& operator[](Usize pos) noexcept { return m_data[pos]; }
+		const T& operator[](Usize pos) const noexcept { return m_data[pos]; }
+
+		T& front() noexcept { return m_data[0]; }
+		const T& front() const noexcept { return m_data[0]; }
+		T& back() noexcept { return m_data[m_size - 1]; }
+		const T& back() const noexcept { return m_data[m_size - 1]; }
+
+		T* data() noexcept { return m_data; }
+		const T* data() const noexcept { return m_data; }
+
+		iterator begin() noexcept { return m_data; }
+		const_iterator begin() const noexcept { return m_data; }
+		const_iterator cbegin() const noexcept { return m_data; }
+		iterator end() noexcept { return m_data + m_size; }
+		const_iterator end() const noexcept { return m_data + m_size; }
+		const_iterator cend() const noexcept { return m_data + m_size; }
+
+		reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+		const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+		reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+		const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+		bool empty() const noexcept { return m_size == 0; }
+		Usize size() const noexcept { return m_size; }
+		Usize max_size() const noexcept { return std::numeric_limits<Usize>::max() / sizeof(T); }
+		Usize capacity() const noexcept { return m_capacity; }
+
+		void reserve(Usize newCapacity)
+		{
+			if (newCapacity > m_capacity)
+				Reallocate(newCapacity);
+		}
+
+		// @brief 元素能放回内部存储时回到内部存储，否则把堆内存缩小到恰好容纳所有元素
+		void shrink_to_fit()
+		{
+			if (IsInline() || m_size == m_capacity)
+				return;
+			Reallocate(std::max(m_size, N));
+		}
+
+		void clear() noexcept
+		{
+			Memory::DestroyForRange(begin(), end());
+			m_size = 0;
+		}
+
+		iterator insert(const_iterator pos, const T& value)
+		{
+			return emplace(pos, value);
+		}
+
+		iterator insert(const_iterator pos, T&& value)
+		{
+			return emplace(pos, std::move(value));
+		}
+
+		iterator insert(const_iterator pos, Usize count, const T& value)
+		{
+			Usize offset = static_cast<Usize>(pos - begin());
+			Usize oldSize = m_size;
+			if (m_size + count > m_capacity)
+			{
+				// 与assign相同，value可能引用当前的元素
+				T copy = value;
+				reserve(GrowCapacity(m_size + count));
+				std::uninitialized_fill_n(end(), count, copy);
+			}
+			else
+			{
+				std::uninitialized_fill_n(end(), count, value);
+			}
+			m_size += count;
+			RotateIntoPlace(offset, oldSize);
+			return begin() + offset;
+		}
+
+		template <std::input_iterator InputIt>
+		iterator insert(const_iterator pos, InputIt first, InputIt last)
+		{
+			Usize offset = static_cast<Usize>(pos - begin());
+			Usize oldSize = m_size;
+			if constexpr (std::forward_iterator<InputIt>)
+			{
+				Usize count = static_cast<Usize>(std::distance(first, last));
+				if (m_size + count > m_capacity)
+					reserve(GrowCapacity(m_size + count));
+
+				if constexpr (std::contiguous_iterator<InputIt> && std::is_trivially_copyable_v<T> && std::same_as<std::remove_const_t<std::iter_value_t<InputIt>>, T>)
+					MemoryCopy(std::to_address(first), end(), count);
+				else
+					std::uninitialized_copy(first, last, end());
+				m_size += count;
+			}
+			else
+			{
+				for (; first != last; ++first)
+					emplace_back(*first);
+			}
+
+			RotateIntoPlace(offset, oldSize);
+			return begin() + offset;
+		}
+
+		iterator insert(const_iterator pos, std::initializer_list<T> list)
+		{
+			return insert(pos, list.begin(), list.end());
+		}
+
+		template <typename... Args>
+		iterator emplace(const_iterator pos, Args&&... args)
+		{
+			Usize offset = static_cast<Usize>(pos - begin());
+			emplace_back(std::forward<Args>(args)...);
+			RotateIntoPlace(offset, m_size - 1);
+			return begin() + offset;
+		}
+
+		iterator erase(const_iterator pos)
+		{
+			return erase(pos, pos + 1);
+		}
+
+		iterator erase(const_iterator first, const_iterator last)
+		{
+			T* from = begin() + (first - cbegin());
+			T* to = begin() + (last - cbegin());
+			if constexpr (Memory::IsTriviallyRelocatableV<T>)
+			{
+				// 先析构被删除的元素，再把后面的元素整体平移过来
+				Memory::DestroyForRange(from, to);
+				Memory::RelocateOverlappingRange(to, end(), from);
+				m_size -= static_cast<Usize>(to - from);
+			}
+			else if (from != to)
+			{
+				T* newEnd = std::move(to, end(), from);
+				Memory::DestroyForRange(newEnd, end());
+				m_size = static_cast<Usize>(newEnd - begin());
+			}
+			return from;
+		}
+
+		void push_back(const T& value)
+		{
+			emplace_back(value);
+		}
+
+		void push_back(T&& value)
+		{
+			emplace_back(std::move(value));
+		}
+
+		template <typename... Args>
+		T& emplace_back(Args&&... args)
+		{
+			if (m_size == m_capacity)
+				return GrowAndEmplaceBack(std::forward<Args>(args)...);
+
+			T* res = std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+			++m_size;
+			return *res;
+		}
+
+		void pop_back() noexcept
+		{
+			--m_size;
+			Memory::Destroy(m_data + m_size);
+		}
+
+		void resize(Usize count)
+		{
+			if (count > m_size)
+			{
+				reserve(count);
+				std::uninitialized_value_construct_n(end(), count - m_size);
+			}
+			else
+			{
+				Memory::DestroyForRange(begin() + count, end());
+			}
+			m_size = count;
+		}
+
+		void resize(Usize count, const T& value)
+		{
+			if (count > m_size)
+				insert(end(), count - m_size, value);
+			else
+				resize(count);
+		}
+
+		void swap(SmallVector& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+		{
+			if (!IsInline() && !other.IsInline() && m_resource == other.m_resource)
+			{
+				std::swap(m_data, other.m_data);
+				std::swap(m_size, other.m_size);
+				std::swap(m_capacity, other.m_capacity);
+				return;
+			}
+
+			SmallVector temp(std::move(other));
+			other = std::move(*this);
+			*this = std::move(temp);
+		}
+
+		friend void swap(SmallVector& lhs, SmallVector& rhs) noexcept(noexcept(lhs.swap(rhs)))
+		{
+			lhs.swap(rhs);
+		}
+
+		friend bool operator==(const SmallVector& lhs, const SmallVector& rhs)
+		{
+			return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+		}
+
+		friend auto operator<=>(const SmallVector& lhs, const SmallVector& rhs)
+		{
+			return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+		}
+
+		Usize Size() const noexcept { return m_size; }
+		Usize Capacity() const noexcept { return m_capacity; }
+		bool Empty() const noexcept { return m_size == 0; }
+		T* Data() noexcept { return m_data; }
+		const T* Data() const noexcept { return m_data; }
+
+		// @brief 元素是否仍存放在对象内部
+		bool IsInline() const noexcept { return m_data == InlineData(); }
+		// @brief 为空时使用Memory::Allocate
+		std::pmr::memory_resource* GetMemoryResource() const noexcept { return m_resource; }
+	private:
+		// 插入时最多在栈上暂存这么多字节的新元素
+		static constexpr Usize RotateStashBytes = 256;
+
+		T* InlineData() noexcept { return reinterpret_cast<T*>(m_inline); }
+		const T* InlineData() const noexcept { return reinterpret_cast<const T*>(m_inline); }
+
+		Usize GrowCapacity(Usize required) const noexcept
+		{
+			return std::max(required, m_capacity * 2);
+		}
+
+		// @brief 移动可能抛出异常时与std::move_if_noexcept相同，能复制就复制，保证失败时原有元素不变
+		// @note 只能移动的类型退化为移动，失败时原有元素处于移动后的状态
+		static void CopyOrMoveRange(T* first, T* last, T* to)
+		{
+			if constexpr (std::is_copy_constructible_v<T>)
+				std::uninitialized_copy(first, last, to);
+			else
+				std::uninitialized_move(first, last, to);
+		}
+
+		T* AllocateBuffer(Usize capacity)
+		{
+			if (m_resource != nullptr)
+				return static_cast<T*>(m_resource->allocate(capacity * sizeof(T), alignof(T)));
+			return Memory::Allocate<T>(capacity, Memory::MemoryTag::Container);
+		}
+
+		void FreeHeapBuffer() noexcept
+		{
+			if (IsInline())
+				return;
+
+			if (m_resource != nullptr)
+				m_resource->deallocate(m_data, m_capacity * sizeof(T), alignof(T));
+			else
+				Memory::Deallocate(m_data, m_capacity, Memory::MemoryTag::Container);
+			m_data = InlineData();
+			m_capacity = N;
+		}
+
+		// @brief 把末尾[oldSize, m_size)中新加入的元素转到offset处
+		void RotateIntoPlace(Usize offset, Usize oldSize)
+		{
+			if (offset == oldSize)
+				return;
+
+			if constexpr (Memory::IsTriviallyRelocatableV<T>)
+			{
+				// 新元素不多时暂存到栈上，中间的元素整体平移一次，不需要逐个移动赋值
+				Usize count = m_size - oldSize;
+				if (count == 1 || count * sizeof(T) <= RotateStashBytes)
+				{
+					alignas(T) std::byte stash[std::max(RotateStashBytes, sizeof(T))];
+					T* stashed = reinterpret_cast<T*>(stash);
+					Memory::RelocateRange(m_data + oldSize, m_data + m_size, stashed);
+					Memory::RelocateOverlappingRange(m_data + offset, m_data + oldSize, m_data + offset + count);
+					Memory::RelocateRange(stashed, stashed + count, m_data + offset);
+					return;
+				}
+			}
+
+			std::rotate(begin() + offset, begin() + oldSize, end());
+		}
+
+		void Reallocate(Usize newCapacity)
+		{
+			if constexpr (Memory::IsTriviallyRelocatableV<T>)
+			{
+				// 新旧缓冲区都来自Memory::Allocate时交给Memory::Reallocate，大块映射可以原地调整
+				if (m_resource == nullptr && !IsInline() && newCapacity > N)
+				{
+					m_data = Memory::Reallocate(m_data, m_capacity, newCapacity, m_size, Memory::MemoryTag::Container);
+					m_capacity = newCapacity;
+					return;
+				}
+			}
+
+			T* buffer = newCapacity <= N ? InlineData() : AllocateBuffer(newCapacity);
+			if (buffer == m_data)
+				return;
+
+			if constexpr (Memory::IsNothrowRelocatableV<T>)
+			{
+				Memory::RelocateRange(m_data, m_data + m_size, buffer);
+			}
+			else
+			{
+				try
+				{
+					CopyOrMoveRange(m_data, m_data + m_size, buffer);
+				}
+				catch (...)
+				{
+					if (buffer != InlineData())
+						FreeBuffer(buffer, newCapacity);
+					throw;
+				}
+				Memory::DestroyForRange(begin(), end());
+			}
+
+			FreeHeapBuffer();
+			m_data = buffer;
+			m_capacity = std::max(newCapacity, N);
+		}
+
+		void FreeBuffer(T* buffer, Usize capacity) noexcept
+		{
+			if (m_resource != nullptr)
+				m_resource->deallocate(buffer, capacity * sizeof(T), alignof(T));
+			else
+				Memory::Deallocate(buffer, capacity, Memory::MemoryTag::Container);
+		}
+
+		template <typename... Args>
+		T& GrowAndEmplaceBack(Args&&... args)
+		{
+			// 先在新缓冲区中构造新元素，参数引用当前元素时仍然有效
+			Usize newCapacity = GrowCapacity(m_size + 1);
+			T* buffer = AllocateBuffer(newCapacity);
+			T* res;
+			try
+			{
+				res = std::construct_at(buffer + m_size, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				FreeBuffer(buffer, newCapacity);
+				throw;
+			}
+
+			if constexpr (Memory::IsNothrowRelocatableV<T>)
+			{
+				Memory::RelocateRange(m_data, m_data + m_size, buffer);
+			}
+			else
+			{
+				try
+				{
+					CopyOrMoveRange(m_data, m_data + m_size, buffer);
+				}
+				catch (...)
+				{
+					Memory::Destroy(res);
+					FreeBuffer(buffer, newCapacity);
+					throw;
+				}
+				Memory::DestroyForRange(begin(), end());
+			}
+
+			FreeHeapBuffer();
+			m_data = buffer;
+			m_capacity = newCapacity;
+			++m_size;
+			return *res;
+		}
+
+		// @brief other与当前对象使用同一个内存资源，当前对象为空且没有堆内存
+		void StealOrMove(SmallVector& other) noexcept(Memory::IsNothrowRelocatableV<T>)
+		{
+			if (!other.IsInline())
+			{
+				m_data = other.m_data;
+				m_size = other.m_size;
+				m_capacity = other.m_capacity;
+				other.m_data = other.InlineData();
+				other.m_size = 0;
+				other.m_capacity = N;
+				return;
+			}
+
+			Memory::RelocateRange(other.m_data, other.m_data + other.m_size, m_data);
+			m_size = other.m_size;
+			other.m_size = 0;
+		}
+
+		T* m_data;
+		Usize m_size = 0;
+		Usize m_capacity = N;
+		std::pmr::memory_resource* m_resource = nullptr;
+		alignas(T) std::byte m_inline[N * sizeof(T)];
+	};
+}
@@ -0,0 +1,173 @@
+// File /Engine/Container/WorkStealingDeque.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Memory/Memory.hpp"
+#include "SmallVector.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace PenFramework::PenEngine
+{
+	// Chase-Lev工作窃取双端队列，容量不足时自动扩容
+	// 所有者线程在底部Push与Pop（后进先出），其他线程在顶部Steal（先进先出）
+	// 扩容后旧数组保留到析构，窃取线程可能仍在读取它
+	template <typename T>
+	class WorkStealingDeque
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque requires a trivially copyable element type");
+	public:
+		using value_type = T;
+
+		// @brief 初始容量按2的幂向上取整
+		explicit WorkStealingDeque(Usize capacity = 256);
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+		~WorkStealingDeque();
+
+		// @brief 只能由所有者线程调用
+		void Push(T value);
+		// @brief 只能由所有者线程调用，取出最近放入的元素
+		std::optional<T> Pop();
+		// @brief 任意线程调用，取出最早放入的元素
+		// @note 与其他线程竞争失败时同样返回空，即使队列中仍有元素
+		std::optional<T> Steal();
+
+		Usize Capacity() const noexcept { return m_array.load(std::memory_order::relaxed)->Mask + 1; }
+		// @brief 其他线程同时修改时只是近似值
+		Usize SizeApprox() const noexcept;
+		bool EmptyApprox() const noexcept { return SizeApprox() == 0; }
+	private:
+		struct Array
+		{
+			Usize Mask;
+			std::atomic<T>* Buffer;
+
+			T Get(Isize index) const noexcept { return Buffer[static_cast<Usize>(index) & Mask].load(std::memory_order::relaxed); }
+			void Put(Isize index, T value) noexcept { Buffer[static_cast<Usize>(index) & Mask].store(value, std::memory_order::relaxed); }
+		};
+
+		static Array* AllocateArray(Usize capacity);
+		static void DeallocateArray(Array* array) noexcept;
+
+		alignas(CacheLineBytes) std::atomic<Isize> m_top = 0;
+		alignas(CacheLineBytes) std::atomic<Isize> m_bottom = 0;
+		std::atomic<Array*> m_array;
+		// 只由所有者线程访问
+		SmallVector<Array*, 8> m_retired;
+	};
+
+	template <typename T>
+	WorkStealingDeque<T>::WorkStealingDeque(Usize capacity) : m_array(AllocateArray(std::bit_ceil(std::max<Usize>(capacity, 2))))
+	{
+	}
+
+	template <typename T>
+	WorkStealingDeque<T>::~WorkStealingDeque()
+	{
+		DeallocateArray(m_array.load(std::memory_order::relaxed));
+		for (Array* array : m_retired)
+			DeallocateArray(array);
+	}
+
+	template <typename T>
+	void WorkStealingDeque<T>::Push(T value)
+	{
+		Isize bottom = m_bottom.load(std::memory_order::relaxed);
+		Isize top = m_top.load(std::memory_order::acquire);
+		Array* array = m_array.load(std::memory_order::relaxed);
+
+		if (static_cast<Usize>(bottom - top) > array->Mask)
+		{
+			Array* grown = AllocateArray((array->Mask + 1) * 2);
+			for (Isize i = top; i < bottom; ++i)
+				grown->Put(i, array->Get(i));
+			m_retired.push_back(array);
+			m_array.store(grown, std::memory_order::release);
+			array = grown;
+		}
+
+		array->Put(bottom, value);
+		m_bottom.store(bottom + 1, std::memory_order::release);
+	}
+
+	template <typename T>
+	std::optional<T> WorkStealingDeque<T>::Pop()
+	{
+		Isize bottom = m_bottom.load(std::memory_order::relaxed) - 1;
+		Array* array = m_array.load(std::memory_order::relaxed);
+		// 先公布底部下标再读取顶部，与Steal中的读取顺序构成全序，二者不会同时取走最后一个元素
+		m_bottom.store(bottom, std::memory_order::seq_cst);
+		Isize top = m_top.load(std::memory_order::seq_cst);
+
+		if (top > bottom)
+		{
+			m_bottom.store(bottom + 1, std::memory_order::relaxed);
+			return std::nullopt;
+		}
+
+		T value = array->Get(bottom);
+		if (top == bottom)
+		{
+			// 只剩最后一个元素，与窃取线程竞争顶部下标
+			bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order::seq_cst, std::memory_order::relaxed);
+			m_bottom.store(bottom + 1, std::memory_order::relaxed);
+			if (!won)
+				return std::nullopt;
+		}
+		return value;
+	}
+
+	template <typename T>
+	std::optional<T> WorkStealingDeque<T>::Steal()
+	{
+		Isize top = m_top.load(std::memory_order::seq_cst);
+		Isize bottom = m_bottom.load(std::memory_order::seq_cst);
+		if (top >= bottom)
+			return std::nullopt;
+
+		Array* array = m_array.load(std::memory_order::acquire);
+		T value = array->Get(top);
+		if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order::seq_cst, std::memory_order::relaxed))
+			return std::nullopt;
+		return value;
+	}
+
+	template <typename T>
+	Usize WorkStealingDeque<T>::SizeApprox() const noexcept
+	{
+		Isize bottom = m_bottom.load(std::memory_order::seq_cst);
+		Isize top = m_top.load(std::memory_order::seq_cst);
+		return bottom > top ? static_cast<Usize>(bottom - top) : 0;
+	}
+
+	template <typename T>
+	typename WorkStealingDeque<T>::Array* WorkStealingDeque<T>::AllocateArray(Usize capacity)
+	{
+		Array* array = Memory::Allocate<Array>(1, Memory::MemoryTag::Container);
+		std::atomic<T>* buffer = Memory::Allocate<std::atomic<T>>(capacity, Memory::MemoryTag::Container);
+		for (Usize i = 0; i < capacity; ++i)
+			std::construct_at(buffer + i);
+		return std::construct_at(array, Array{ capacity - 1, buffer });
+	}
+
+	template <typename T>
+	void WorkStealingDeque<T>::DeallocateArray(Array* array) noexcept
+	{
+		Memory::Deallocate(array->Buffer, array->Mask + 1, Memory::MemoryTag::Container);
+		Memory::Deallocate(array, 1, Memory::MemoryTag::Container);
+	}
+}
@@ -1,7 +1,7 @@
 // File /Engine/Coroutine/AsyncTask.hpp
 // This file is a part of PenFramework Project
 // https://github.com/PenNineCat/PenFramework
-// 
+//
 // Copyright (C) 2025 - Present PenNineCat. All rights reserved
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
@@ -10,68 +10,390 @@
 
 #pragma once
 
+#include "CoroutineFrame.hpp"
+#include <atomic>
+#include <concepts>
 #include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
 
 namespace PenFramework::PenEngine
 {
+	class Scheduler;
+
 	template <typename Ret>
-	class AsyncTask
+	class AsyncTask;
+
+	namespace Detail
 	{
-	public:
-		class Promise
+		// task结束或产出时收到通知的对象，WhenAll、WhenAny通过它等待多个task，不需要为每个task再创建协程
+		class AsyncTaskListener
 		{
 		public:
-			AsyncTask get_return_object()
+			// @brief 在task发布状态之后调用，返回接下来要恢复的协程
+			// @param task 只用于区分是哪个task，不能访问它
+			virtual std::coroutine_handle<> OnPublished(const void* task) noexcept = 0;
+		protected:
+			~AsyncTaskListener() = default;
+		};
+
+		struct AsyncTaskAccess;
+
+		enum class AsyncTaskState : U32
+		{
+			// 挂起中，持有AsyncTask的线程可以恢复它
+			Suspended,
+			// 正在执行，或已交给调度器
+			Running,
+			Finished
+		};
+
+		// @brief 阻塞等待task时使用的唤醒计数，按promise地址分组
+		// @note 计数不在协程帧中，task发布状态后协程帧可能已经被销毁，仍然可以通过它唤醒Wait
+		inline std::atomic<U32>& AsyncTaskWakeEpoch(const void* promise) noexcept
+		{
+			struct alignas(CacheLineBytes) Slot
 			{
-				return AsyncTask(std::coroutine_handle<Promise>::from_promise(*this));
-			}
+				std::atomic<U32> Epoch = 0;
+			};
+
+			static constexpr Usize slotCount = 64;
+			static Slot slots[slotCount];
+			return slots[(reinterpret_cast<Usize>(promise) / CacheLineBytes) % slotCount].Epoch;
+		}
 
+		// 协程帧经由PooledCoroutineFrame分配，不再每次调用全局operator new
+		class AsyncTaskPromiseBase : public PooledCoroutineFrame
+		{
+		protected:
+			// 协程完全挂起后再发布状态，看到该状态的线程可以立即恢复或销毁协程帧
+			// 同时取走等待该task的协程并对称转移到它，等待链再长也不会占用更多的栈
+			template <AsyncTaskState State>
+			struct PublishState
+			{
+				static bool await_ready() noexcept { return false; }
+
+				template <typename Promise>
+				static std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+				{
+					AsyncTaskPromiseBase& promise = handle.promise();
+					const void* identity = &promise;
+					// 结束后留下标记，之后的co_await不再登记，直接继续执行
+					void* continuation = promise.m_continuation.exchange(State == AsyncTaskState::Finished ? FinishedMark() : nullptr, std::memory_order::acq_rel);
+
+					std::atomic<U32>& wakeEpoch = AsyncTaskWakeEpoch(identity);
+
+					// 发布之后协程帧可能立即被其他线程销毁，不能再访问promise
+					promise.m_state.store(State, std::memory_order::release);
+					wakeEpoch.fetch_add(1, std::memory_order::release);
+					wakeEpoch.notify_all();
+
+					if (continuation == nullptr)
+						return std::noop_coroutine();
+					if (AsyncTaskListener* listener = UntagListener(continuation))
+						return listener->OnPublished(identity);
+					return std::coroutine_handle<>::from_address(continuation);
+				}
+
+				static void await_resume() noexcept {}
+			};
+		public:
 			static std::suspend_always initial_suspend() noexcept { return {}; }
-			static std::suspend_never final_suspend() noexcept { return {}; }
+			// 结束后保持挂起，协程帧在AsyncTask析构时释放，之后仍然可以读取结果
+			static PublishState<AsyncTaskState::Finished> final_suspend() noexcept { return {}; }
+
+			void unhandled_exception() noexcept
+			{
+				m_exception = std::current_exception();
+			}
+		protected:
+			template <typename>
+			friend class PenEngine::AsyncTask;
+			friend struct AsyncTaskAccess;
+
+			static void* FinishedMark() noexcept
+			{
+				alignas(8) static U8 mark;
+				return &mark;
+			}
+
+			// 协程帧与listener至少按2字节对齐，最低位用于区分二者
+			static void* TagListener(AsyncTaskListener* listener) noexcept
+			{
+				return reinterpret_cast<void*>(reinterpret_cast<Usize>(listener) | 1);
+			}
 
-			void unhandled_exception();
+			static AsyncTaskListener* UntagListener(void* continuation) noexcept
+			{
+				Usize address = reinterpret_cast<Usize>(continuation);
+				return (address & 1) != 0 ? reinterpret_cast<AsyncTaskListener*>(address & ~Usize(1)) : nullptr;
+			}
 
-			void return_value(const Ret& v)
+			void RethrowIfFailed() const
 			{
-				m_v = v;
+				if (m_exception)
+					std::rethrow_exception(m_exception);
 			}
 
-			std::suspend_always yield_value(const Ret& v)
+			std::exception_ptr m_exception;
+			// 等待该task的协程，nullptr表示没有，FinishedMark表示已经结束
+			// 最低位为1时是AsyncTaskListener
+			std::atomic<void*> m_continuation = nullptr;
+			std::atomic<AsyncTaskState> m_state = AsyncTaskState::Suspended;
+		};
+
+		template <typename Ret>
+		class AsyncTaskPromise : public AsyncTaskPromiseBase
+		{
+		public:
+			AsyncTask<Ret> get_return_object() noexcept
 			{
-				m_v = v;
+				return AsyncTask<Ret>(std::coroutine_handle<AsyncTaskPromise>::from_promise(*this));
+			}
+
+			template <typename Value = Ret> requires std::constructible_from<Ret, Value&&>
+			void return_value(Value&& v)
+			{
+				m_v.emplace(std::forward<Value>(v));
+			}
+
+			// @note 产出值的task应当在同一个线程上恢复和等待
+			template <typename Value = Ret> requires std::constructible_from<Ret, Value&&>
+			PublishState<AsyncTaskState::Suspended> yield_value(Value&& v)
+			{
+				m_v.emplace(std::forward<Value>(v));
 				return {};
 			}
 
 			Ret& Get()
 			{
-				return m_v;
+				RethrowIfFailed();
+				return *m_v;
 			}
 		private:
-			Ret m_v;
+			// 只在结束或产出时构造，Ret不需要默认构造，也可以只能移动
+			std::optional<Ret> m_v;
+		};
+
+		template <>
+		class AsyncTaskPromise<void> : public AsyncTaskPromiseBase
+		{
+		public:
+			AsyncTask<void> get_return_object() noexcept;
+
+			static void return_void() noexcept {}
+
+			void Get() const
+			{
+				RethrowIfFailed();
+			}
 		};
+	}
 
+	// 惰性执行的协程，创建后保持挂起，直到被Get、Resume、co_await或交给Scheduler
+	// co_await一个AsyncTask时登记当前协程为后继，task结束后对称转移回来，结果或异常在co_await处取得
+	// @note 等待链只在编译器把对称转移实现为尾调用时占用固定的栈空间，GCC需要-O2及以上
+	template <typename Ret>
+	class AsyncTask
+	{
+	public:
+		using ValueType = Ret;
+		using Promise = Detail::AsyncTaskPromise<Ret>;
 		using promise_type = Promise;
+		using Reference = std::add_lvalue_reference_t<Ret>;
 
 		explicit AsyncTask(std::coroutine_handle<Promise> coroutine) :m_handle(coroutine) {}
+		AsyncTask(const AsyncTask&) = delete;
+		AsyncTask(AsyncTask&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
 
-		Ret Get()
+		AsyncTask& operator=(const AsyncTask&) = delete;
+		AsyncTask& operator=(AsyncTask&& other) noexcept
 		{
-			m_handle.resume();
+			if (this != &other)
+			{
+				if (m_handle)
+					m_handle.destroy();
+				m_handle = std::exchange(other.m_handle, nullptr);
+			}
+			return *this;
+		}
+
+		~AsyncTask()
+		{
+			if (m_handle)
+				m_handle.destroy();
+		}
+
+		// @brief 协程挂起中则在当前线程恢复它，已交给调度器则等待它结束或产出下一个值
+		Reference Get()
+		{
+			if (std::coroutine_handle<> handle = Start())
+				handle.resume();
+			Wait();
 			return m_handle.promise().Get();
 		}
 
+		// @brief 读取最近一次产出或结束时发布的结果，不会恢复协程
+		// @note 协程不能正在执行，例如在co_await、WhenAll或WhenAny返回之后读取
+		Reference Result() const
+		{
+			return m_handle.promise().Get();
+		}
+
+		// @brief 等待在其他线程上执行的协程结束或产出下一个值，协程挂起中时立即返回
+		void Wait() const
+		{
+			const Detail::AsyncTaskPromiseBase& promise = m_handle.promise();
+			std::atomic<U32>& wakeEpoch = Detail::AsyncTaskWakeEpoch(&promise);
+			while (true)
+			{
+				// 先读取计数再检查状态，状态在读取之后发布时计数一定已经改变，不会错过唤醒
+				U32 epoch = wakeEpoch.load(std::memory_order::acquire);
+				if (promise.m_state.load(std::memory_order::acquire) != Detail::AsyncTaskState::Running)
+					return;
+				wakeEpoch.wait(epoch, std::memory_order::acquire);
+			}
+		}
+
 		explicit operator bool() const noexcept
 		{
-			return !m_handle.done();
+			return !Done();
 		}
 
+		// @brief 可以从其他线程调用
 		bool Done() const noexcept
 		{
-			return m_handle.done();
+			return m_handle.promise().m_state.load(std::memory_order::acquire) == Detail::AsyncTaskState::Finished;
+		}
+
+		void Resume() const
+		{
+			m_handle.promise().m_state.store(Detail::AsyncTaskState::Running, std::memory_order::relaxed);
+			m_handle.resume();
 		}
 
-		void Resume() const { m_handle.resume(); }
+		// @brief 左值task返回结果的引用，之后仍然可以再次读取
+		auto operator co_await() & noexcept { return Awaiter<false>(m_handle); }
+		// @brief 临时的task将结果移动出来按值返回，避免引用随task一起销毁，例如用于范围for的初始化
+		auto operator co_await() && noexcept { return Awaiter<true>(m_handle); }
 	private:
+		friend class Scheduler;
+		friend struct Detail::AsyncTaskAccess;
+
+		template <bool Move>
+		class Awaiter
+		{
+		public:
+			explicit Awaiter(std::coroutine_handle<Promise> handle) noexcept : m_handle(handle) {}
+
+			bool await_ready() const noexcept
+			{
+				return m_handle.promise().m_state.load(std::memory_order::acquire) == Detail::AsyncTaskState::Finished;
+			}
+
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) const noexcept
+			{
+				Promise& promise = m_handle.promise();
+
+				// 挂起中的task只有持有者能改变它的状态，不需要原子的读改写，直接在当前线程开始执行
+				if (promise.m_state.load(std::memory_order::acquire) == Detail::AsyncTaskState::Suspended)
+				{
+					promise.m_continuation.store(awaiting.address(), std::memory_order::relaxed);
+					promise.m_state.store(Detail::AsyncTaskState::Running, std::memory_order::relaxed);
+					return m_handle;
+				}
+
+				// 已交给调度器的task结束时会恢复awaiting，登记失败说明它已经结束，直接继续执行
+				void* expected = nullptr;
+				if (!promise.m_continuation.compare_exchange_strong(expected, awaiting.address(), std::memory_order::acq_rel, std::memory_order::acquire))
+					return awaiting;
+				return std::noop_coroutine();
+			}
+
+			decltype(auto) await_resume() const
+			{
+				if constexpr (std::is_void_v<Ret>)
+					m_handle.promise().Get();
+				else if constexpr (Move)
+					return Ret(std::move(m_handle.promise().Get()));
+				else
+					return m_handle.promise().Get();
+			}
+		private:
+			std::coroutine_handle<Promise> m_handle;
+		};
+
+		// @brief 协程挂起中时标记为执行中并返回句柄，否则返回空句柄
+		std::coroutine_handle<> Start() const noexcept
+		{
+			Detail::AsyncTaskState expected = Detail::AsyncTaskState::Suspended;
+			if (m_handle.promise().m_state.compare_exchange_strong(expected, Detail::AsyncTaskState::Running, std::memory_order::acquire))
+				return m_handle;
+			return nullptr;
+		}
+
+		bool Running() const noexcept
+		{
+			return m_handle.promise().m_state.load(std::memory_order::acquire) == Detail::AsyncTaskState::Running;
+		}
+
 		std::coroutine_handle<Promise> m_handle;
 	};
-}
\ No newline at end of file
+
+	namespace Detail
+	{
+		// 供WhenAll、WhenAny等组合器使用的内部接口
+		struct AsyncTaskAccess
+		{
+			enum class AttachResult
+			{
+				Attached,
+				// task已经结束，不会通知listener
+				Finished
+			};
+
+			// @brief 登记listener，task挂起中时标记为执行中，并通过start返回需要由调用方恢复的句柄
+			template <typename Ret>
+			static AttachResult Attach(AsyncTask<Ret>& task, AsyncTaskListener* listener, std::coroutine_handle<>& start) noexcept
+			{
+				AsyncTaskPromiseBase& promise = task.m_handle.promise();
+				start = nullptr;
+
+				if (promise.m_state.load(std::memory_order::acquire) == AsyncTaskState::Suspended)
+				{
+					promise.m_continuation.store(AsyncTaskPromiseBase::TagListener(listener), std::memory_order::relaxed);
+					promise.m_state.store(AsyncTaskState::Running, std::memory_order::relaxed);
+					start = task.m_handle;
+					return AttachResult::Attached;
+				}
+
+				void* expected = nullptr;
+				if (promise.m_continuation.compare_exchange_strong(expected, AsyncTaskPromiseBase::TagListener(listener), std::memory_order::acq_rel, std::memory_order::acquire))
+					return AttachResult::Attached;
+				return AttachResult::Finished;
+			}
+
+			// @brief 撤销登记，task已经取走listener、即将或已经通知它时返回false
+			template <typename Ret>
+			static bool Detach(AsyncTask<Ret>& task, AsyncTaskListener* listener) noexcept
+			{
+				void* expected = AsyncTaskPromiseBase::TagListener(listener);
+				return task.m_handle.promise().m_continuation.compare_exchange_strong(expected, nullptr, std::memory_order::acq_rel, std::memory_order::relaxed);
+			}
+
+			// @brief 与OnPublished的参数比较，判断是哪个task
+			template <typename Ret>
+			static const void* Identity(const AsyncTask<Ret>& task) noexcept
+			{
+				return static_cast<const AsyncTaskPromiseBase*>(&task.m_handle.promise());
+			}
+		};
+	}
+
+	inline AsyncTask<void> Detail::AsyncTaskPromise<void>::get_return_object() noexcept
+	{
+		return AsyncTask<void>(std::coroutine_handle<AsyncTaskPromise>::from_promise(*this));
+	}
+}
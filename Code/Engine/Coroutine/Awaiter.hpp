@@ -1,7 +1,7 @@
 // File /Engine/Coroutine/Awaiter.hpp
 // This file is a part of PenFramework Project
 // https://github.com/PenNineCat/PenFramework
-// 
+//
 // Copyright (C) 2025 - Present PenNineCat. All rights reserved
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
@@ -10,10 +10,51 @@
 
 #pragma once
 
+#include <concepts>
+#include <coroutine>
+#include <type_traits>
+#include <utility>
+
 namespace PenFramework::PenEngine
 {
-	class Awaiter
+	namespace Detail
 	{
+		template <typename T>
+		concept AwaitSuspendResult = std::same_as<T, void> || std::same_as<T, bool> || std::convertible_to<T, std::coroutine_handle<>>;
+
+		template <typename T>
+		concept HasMemberCoAwait = requires(T && t) { std::forward<T>(t).operator co_await(); };
 
+		template <typename T>
+		concept HasFreeCoAwait = requires(T && t) { operator co_await(std::forward<T>(t)); };
+	}
+
+	// 可以直接用于co_await表达式的等待器
+	template <typename T>
+	concept Awaiter = requires(T & t, std::coroutine_handle<> handle)
+	{
+		{ t.await_ready() } -> std::convertible_to<bool>;
+		{ t.await_suspend(handle) } -> Detail::AwaitSuspendResult;
+		t.await_resume();
 	};
-}
\ No newline at end of file
+
+	// @brief 取得co_await value时实际使用的等待器
+	template <typename T>
+	decltype(auto) GetAwaiter(T&& value)
+	{
+		if constexpr (Detail::HasMemberCoAwait<T>)
+			return std::forward<T>(value).operator co_await();
+		else if constexpr (Detail::HasFreeCoAwait<T>)
+			return operator co_await(std::forward<T>(value));
+		else
+			return std::forward<T>(value);
+	}
+
+	// 自身是等待器，或通过operator co_await得到等待器的类型
+	template <typename T>
+	concept Awaitable = Awaiter<std::remove_cvref_t<decltype(GetAwaiter(std::declval<T>()))>>;
+
+	// co_await一个T类型的表达式得到的类型
+	template <Awaitable T>
+	using AwaitResultT = decltype(std::declval<std::remove_cvref_t<decltype(GetAwaiter(std::declval<T>()))>&>().await_resume());
+}
@@ -0,0 +1,107 @@
+// File /Engine/Coroutine/CoroutineFrame.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Memory/Memory.hpp"
+#include "../Memory/PoolAllocator.h"
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+namespace PenFramework::PenEngine
+{
+	// promise_type继承该类后，协程帧从Memory的按大小分级的线程缓存中分配，并计入MemoryTag::Coroutine
+	// 协程的参数以std::allocator_arg, std::pmr::memory_resource*开头时（成员函数协程为对象之后），帧改为从该内存资源分配
+	// 帧的末尾多存放一个指针，记录分配它的内存资源，释放时据此归还
+	class PooledCoroutineFrame
+	{
+	public:
+		static void* operator new(Usize bytes)
+		{
+			return AllocateFrame(bytes, nullptr);
+		}
+
+		template <typename... Args>
+		static void* operator new(Usize bytes, std::allocator_arg_t, std::pmr::memory_resource* resource, const Args&...)
+		{
+			return AllocateFrame(bytes, resource);
+		}
+
+		template <typename Self, typename... Args>
+		static void* operator new(Usize bytes, const Self&, std::allocator_arg_t, std::pmr::memory_resource* resource, const Args&...)
+		{
+			return AllocateFrame(bytes, resource);
+		}
+
+		static void operator delete(void* frame, Usize bytes) noexcept
+		{
+			std::pmr::memory_resource* resource;
+			std::memcpy(&resource, static_cast<U8*>(frame) + TrailerOffset(bytes), sizeof(resource));
+			Usize total = TrailerOffset(bytes) + sizeof(resource);
+
+			if (resource != nullptr)
+			{
+				resource->deallocate(frame, total, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+				return;
+			}
+
+			#if MEMORY_TRACKING
+			Memory::TrackDeallocate(Memory::MemoryTag::Coroutine, total);
+			#endif // MEMORY_TRACKING
+
+			#if MEMORY_HEAP_PROFILER
+			Memory::HeapProfilerRecordDeallocate(frame);
+			#endif // MEMORY_HEAP_PROFILER
+
+			Memory::PoolDeallocate(frame, total);
+		}
+	private:
+		static constexpr Usize TrailerOffset(Usize bytes) noexcept
+		{
+			return (bytes + alignof(std::pmr::memory_resource*) - 1) & ~(alignof(std::pmr::memory_resource*) - 1);
+		}
+
+		static void* AllocateFrame(Usize bytes, std::pmr::memory_resource* resource)
+		{
+			Usize total = TrailerOffset(bytes) + sizeof(resource);
+			void* frame;
+			if (resource != nullptr)
+			{
+				frame = resource->allocate(total, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+			}
+			else
+			{
+				#if MEMORY_TRACKING
+				Memory::TrackAllocate(Memory::MemoryTag::Coroutine, total);
+				#endif // MEMORY_TRACKING
+
+				frame = Memory::PoolAllocate(total);
+
+				#if MEMORY_HEAP_PROFILER
+				Memory::HeapProfilerRecordAllocate(frame, total, Memory::MemoryTag::Coroutine);
+				#endif // MEMORY_HEAP_PROFILER
+			}
+
+			std::memcpy(static_cast<U8*>(frame) + TrailerOffset(bytes), &resource, sizeof(resource));
+			return frame;
+		}
+	};
+
+	// @brief 当前从线程缓存分配且尚未释放的协程帧数量，不包括从内存资源分配的帧
+	// @note 依赖内存统计，MEMORY_TRACKING为0时总是0
+	inline u64 GetPooledCoroutineFrameCount()
+	{
+		Memory::MemoryStatistics statistics = Memory::GetMemoryStatistics();
+		return statistics[Memory::MemoryTag::Coroutine].AllocationCount - statistics[Memory::MemoryTag::Coroutine].DeallocationCount;
+	}
+}
@@ -0,0 +1,211 @@
+// File /Engine/Coroutine/Generator.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../DebugTools/Verify.hpp"
+#include "CoroutineFrame.hpp"
+#include <concepts>
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace PenFramework::PenEngine
+{
+	template <typename T>
+	class Generator;
+
+	namespace Detail
+	{
+		// Generator<T>产出T&&，可以从中移动出值；Generator<T&>与Generator<const T&>直接产出引用
+		template <typename T>
+		using GeneratorReferenceT = std::conditional_t<std::is_reference_v<T>, T, T&&>;
+
+		template <typename T>
+		class GeneratorPromise : public PooledCoroutineFrame
+		{
+		public:
+			using Reference = GeneratorReferenceT<T>;
+			using Value = std::remove_cvref_t<T>;
+
+			Generator<T> get_return_object() noexcept
+			{
+				return Generator<T>(std::coroutine_handle<GeneratorPromise>::from_promise(*this));
+			}
+
+			static std::suspend_always initial_suspend() noexcept { return {}; }
+			static std::suspend_always final_suspend() noexcept { return {}; }
+
+			// co_yield表达式中的临时对象在协程挂起期间一直存活，只记录地址，不会复制
+			std::suspend_always yield_value(Reference v) noexcept
+			{
+				m_value = std::addressof(v);
+				return {};
+			}
+
+			// 产出左值时Generator<T>无法直接交出T&&，先复制到等待器中，等待器同样在挂起期间存活
+			auto yield_value(const Value& v) requires (!std::is_reference_v<T> && std::copy_constructible<Value>)
+			{
+				class CopyAwaiter
+				{
+				public:
+					CopyAwaiter(const Value& v, GeneratorPromise& promise) : m_copy(v), m_promise(promise) {}
+
+					static bool await_ready() noexcept { return false; }
+
+					void await_suspend(std::coroutine_handle<>) noexcept
+					{
+						m_promise.m_value = std::addressof(m_copy);
+					}
+
+					static void await_resume() noexcept {}
+				private:
+					Value m_copy;
+					GeneratorPromise& m_promise;
+				};
+
+				return CopyAwaiter(v, *this);
+			}
+
+			static void return_void() noexcept {}
+
+			void unhandled_exception() noexcept
+			{
+				m_exception = std::current_exception();
+			}
+
+			// 生成器只能产出值，不能在其中等待其他协程
+			template <typename U>
+			std::suspend_never await_transform(U&&) = delete;
+
+			Reference Current() const noexcept
+			{
+				return static_cast<Reference>(*m_value);
+			}
+
+			void RethrowIfFailed() const
+			{
+				if (m_exception)
+					std::rethrow_exception(m_exception);
+			}
+		private:
+			std::add_pointer_t<Reference> m_value = nullptr;
+			std::exception_ptr m_exception;
+		};
+	}
+
+	// 惰性的生成器协程，每次co_yield产出一个元素，遍历到该元素时才恢复执行
+	// Generator<T>产出T&&，Generator<T&>与Generator<const T&>产出引用；产出的对象不会被复制，只有Generator<T>产出左值时复制一次
+	// 协程帧使用PooledCoroutineFrame分配，可以通过std::allocator_arg指定内存资源
+	// @note 只能遍历一次，Begin只能调用一次；生成器中抛出的异常在Begin或递增迭代器时重新抛出
+	template <typename T>
+	class Generator : public std::ranges::view_interface<Generator<T>>
+	{
+	public:
+		using Promise = Detail::GeneratorPromise<T>;
+		using promise_type = Promise;
+		using Reference = Detail::GeneratorReferenceT<T>;
+		using ValueType = std::remove_cvref_t<T>;
+
+		class Iterator
+		{
+		public:
+			using iterator_concept = std::input_iterator_tag;
+
+			using value_type = ValueType;
+			using difference_type = Isize;
+			using reference = Reference;
+
+			Iterator() noexcept = default;
+			explicit Iterator(std::coroutine_handle<Promise> handle) noexcept : m_handle(handle) {}
+
+			Iterator(Iterator&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+			Iterator& operator=(Iterator&& other) noexcept
+			{
+				m_handle = std::exchange(other.m_handle, nullptr);
+				return *this;
+			}
+
+			reference operator*() const noexcept
+			{
+				DEBUG_VERIFY_REPORT(m_handle && !m_handle.done(), "cannot dereference end generator iterator")
+					return m_handle.promise().Current();
+			}
+
+			Iterator& operator++()
+			{
+				DEBUG_VERIFY_REPORT(m_handle && !m_handle.done(), "cannot increment end generator iterator")
+					m_handle.resume();
+				if (m_handle.done())
+					m_handle.promise().RethrowIfFailed();
+				return *this;
+			}
+
+			void operator++(int)
+			{
+				++*this;
+			}
+
+			friend bool operator==(const Iterator& it, std::default_sentinel_t) noexcept
+			{
+				return !it.m_handle || it.m_handle.done();
+			}
+		private:
+			std::coroutine_handle<Promise> m_handle;
+		};
+
+		using iterator = Iterator;
+		using Sentinel = std::default_sentinel_t;
+
+		explicit Generator(std::coroutine_handle<Promise> handle) noexcept : m_handle(handle) {}
+		Generator(const Generator&) = delete;
+		Generator(Generator&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+		Generator& operator=(const Generator&) = delete;
+		Generator& operator=(Generator&& other) noexcept
+		{
+			if (this != &other)
+			{
+				if (m_handle)
+					m_handle.destroy();
+				m_handle = std::exchange(other.m_handle, nullptr);
+			}
+			return *this;
+		}
+
+		~Generator()
+		{
+			if (m_handle)
+				m_handle.destroy();
+		}
+
+		// @brief 开始执行到第一个co_yield
+		Iterator Begin()
+		{
+			DEBUG_VERIFY_REPORT(m_handle, "cannot iterate moved-from generator")
+				m_handle.resume();
+			if (m_handle.done())
+				m_handle.promise().RethrowIfFailed();
+			return Iterator(m_handle);
+		}
+
+		static Sentinel End() noexcept { return std::default_sentinel; }
+
+		Iterator begin() { return Begin(); }
+		static Sentinel end() noexcept { return End(); }
+	private:
+		std::coroutine_handle<Promise> m_handle;
+	};
+}
@@ -0,0 +1,189 @@
+// File /Engine/Coroutine/Scheduler.cpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Scheduler.h"
+#include "../Utils/ThreadLocal.hpp"
+
+#include <algorithm>
+
+namespace
+{
+	using namespace PenFramework::PenEngine;
+
+	// 当前线程所属的调度器与工作线程下标，非工作线程为nullptr
+	thread_local const Scheduler* t_scheduler = nullptr;
+	thread_local Usize t_workerIndex = 0;
+
+	u64 NextRandom(u64& state) noexcept
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+}
+
+PenFramework::PenEngine::Scheduler::Scheduler(Usize workerCount, Usize injectionCapacity) :
+	m_workerCount(std::max<Usize>(workerCount, 1)),
+	m_workers(std::make_unique<Worker[]>(m_workerCount)),
+	m_injection(injectionCapacity)
+{
+	m_threads.reserve(m_workerCount);
+	for (Usize i = 0; i < m_workerCount; ++i)
+	{
+		m_workers[i].RandomState = 0x9E3779B97F4A7C15ull * (i + 1);
+		m_threads.emplace_back([this, i] { WorkerMain(i); });
+	}
+}
+
+PenFramework::PenEngine::Scheduler::~Scheduler()
+{
+	m_stopping.store(true, std::memory_order::seq_cst);
+	m_wakeEpoch.fetch_add(1, std::memory_order::seq_cst);
+	m_wakeEpoch.notify_all();
+	m_threads.clear();
+}
+
+void PenFramework::PenEngine::Scheduler::Enqueue(std::coroutine_handle<> handle)
+{
+	if (t_scheduler == this)
+	{
+		m_workers[t_workerIndex].Deque.Push(handle);
+	}
+	else
+	{
+		while (!m_injection.TryPush(handle))
+			std::this_thread::yield();
+	}
+	WakeOne();
+}
+
+PenFramework::PenEngine::Scheduler::WorkerStatistics PenFramework::PenEngine::Scheduler::GetWorkerStatistics(Usize workerIndex) const noexcept
+{
+	const Worker& worker = m_workers[workerIndex];
+	return WorkerStatistics{
+		.Executed = worker.Executed.load(std::memory_order::relaxed),
+		.Stolen = worker.Stolen.load(std::memory_order::relaxed),
+		.StealAttempts = worker.StealAttempts.load(std::memory_order::relaxed),
+		.Injected = worker.Injected.load(std::memory_order::relaxed),
+		.Parked = worker.Parked.load(std::memory_order::relaxed)
+	};
+}
+
+bool PenFramework::PenEngine::Scheduler::IsWorkerThread() const noexcept
+{
+	return t_scheduler == this;
+}
+
+void PenFramework::PenEngine::Scheduler::WorkerMain(Usize workerIndex)
+{
+	t_scheduler = this;
+	t_workerIndex = workerIndex;
+	Worker& worker = m_workers[workerIndex];
+
+	while (!m_stopping.load(std::memory_order::relaxed))
+	{
+		if (std::coroutine_handle<> handle = FindWork(worker))
+		{
+			OwnerAdd<u64>(worker.Executed, 1);
+			handle.resume();
+		}
+		else
+		{
+			Park(worker);
+		}
+	}
+
+	t_scheduler = nullptr;
+}
+
+std::coroutine_handle<> PenFramework::PenEngine::Scheduler::FindWork(Worker& worker)
+{
+	if (std::optional<std::coroutine_handle<>> handle = worker.Deque.Pop())
+		return *handle;
+
+	if (std::optional<std::coroutine_handle<>> handle = m_injection.TryPop())
+	{
+		OwnerAdd<u64>(worker.Injected, 1);
+		return *handle;
+	}
+
+	return StealWork(worker);
+}
+
+std::coroutine_handle<> PenFramework::PenEngine::Scheduler::StealWork(Worker& thief)
+{
+	if (m_workerCount == 1)
+		return nullptr;
+
+	// 从随机的位置开始轮询，避免所有空闲线程同时窃取同一个工作线程
+	Usize start = NextRandom(thief.RandomState) % m_workerCount;
+	for (Usize i = 0; i < m_workerCount; ++i)
+	{
+		Worker& victim = m_workers[(start + i) % m_workerCount];
+		if (&victim == &thief)
+			continue;
+
+		OwnerAdd<u64>(thief.StealAttempts, 1);
+		if (std::optional<std::coroutine_handle<>> handle = victim.Deque.Steal())
+		{
+			OwnerAdd<u64>(thief.Stolen, 1);
+			return *handle;
+		}
+	}
+	return nullptr;
+}
+
+bool PenFramework::PenEngine::Scheduler::RunPending()
+{
+	Worker& worker = m_workers[t_workerIndex];
+	std::coroutine_handle<> handle = FindWork(worker);
+	if (!handle)
+		return false;
+
+	OwnerAdd<u64>(worker.Executed, 1);
+	handle.resume();
+	return true;
+}
+
+bool PenFramework::PenEngine::Scheduler::HasWork() const noexcept
+{
+	if (!m_injection.EmptyApprox())
+		return true;
+	for (Usize i = 0; i < m_workerCount; ++i)
+	{
+		if (!m_workers[i].Deque.EmptyApprox())
+			return true;
+	}
+	return false;
+}
+
+void PenFramework::PenEngine::Scheduler::Park(Worker& worker)
+{
+	// 先登记休眠再检查队列，与WakeOne中先放入任务再检查休眠数量的顺序构成全序，二者至少有一方看到对方
+	U32 epoch = m_wakeEpoch.load(std::memory_order::seq_cst);
+	m_parkedCount.fetch_add(1, std::memory_order::seq_cst);
+	std::atomic_thread_fence(std::memory_order::seq_cst);
+	if (!HasWork() && !m_stopping.load(std::memory_order::seq_cst))
+	{
+		OwnerAdd<u64>(worker.Parked, 1);
+		m_wakeEpoch.wait(epoch, std::memory_order::seq_cst);
+	}
+	m_parkedCount.fetch_sub(1, std::memory_order::seq_cst);
+}
+
+void PenFramework::PenEngine::Scheduler::WakeOne() noexcept
+{
+	std::atomic_thread_fence(std::memory_order::seq_cst);
+	if (m_parkedCount.load(std::memory_order::relaxed) == 0)
+		return;
+	m_wakeEpoch.fetch_add(1, std::memory_order::seq_cst);
+	m_wakeEpoch.notify_one();
+}
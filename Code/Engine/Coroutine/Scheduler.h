@@ -0,0 +1,145 @@
+// File /Engine/Coroutine/Scheduler.h
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Container/RingBuffer.hpp"
+#include "../Container/WorkStealingDeque.hpp"
+#include "../Utils/Parallel.hpp"
+#include "AsyncTask.hpp"
+#include <atomic>
+#include <coroutine>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace PenFramework::PenEngine
+{
+	// 工作窃取线程池，在多个工作线程上恢复协程
+	// 每个工作线程有自己的WorkStealingDeque，工作线程上产生的协程放入自己的队列，其他线程产生的协程放入共享的注入队列
+	// 自己的队列为空时依次检查注入队列、随机选择其他工作线程窃取，都没有任务时在std::atomic::wait上休眠
+	// @note 析构时尚未执行的协程不会被恢复，协程帧仍由持有它的AsyncTask释放
+	class Scheduler
+	{
+	public:
+		struct WorkerStatistics
+		{
+			// 恢复的协程数量
+			u64 Executed = 0;
+			// 从其他工作线程窃取成功的次数
+			u64 Stolen = 0;
+			// 尝试窃取的次数，包括失败的
+			u64 StealAttempts = 0;
+			// 从注入队列取得的任务数量
+			u64 Injected = 0;
+			// 休眠的次数
+			u64 Parked = 0;
+		};
+
+		// co_await scheduler.Schedule()后，协程在某个工作线程上继续执行
+		class ScheduleAwaiter
+		{
+		public:
+			explicit ScheduleAwaiter(Scheduler& scheduler) noexcept : m_scheduler(&scheduler) {}
+
+			static bool await_ready() noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> handle) const { m_scheduler->Enqueue(handle); }
+			static void await_resume() noexcept {}
+		private:
+			Scheduler* m_scheduler;
+		};
+
+		// @param workerCount 工作线程数量，至少为1
+		// @param injectionCapacity 注入队列的容量，满时非工作线程的Enqueue会等待
+		explicit Scheduler(Usize workerCount = HardwareConcurrency(), Usize injectionCapacity = 1024);
+		Scheduler(const Scheduler&) = delete;
+		Scheduler& operator=(const Scheduler&) = delete;
+		~Scheduler();
+
+		[[nodiscard]] ScheduleAwaiter Schedule() noexcept { return ScheduleAwaiter(*this); }
+
+		// @brief 安排handle在某个工作线程上恢复
+		void Enqueue(std::coroutine_handle<> handle);
+
+		// @brief 将挂起中的task交给调度器执行，之后通过Join或task.Get()取得结果
+		// @note 在工作线程上调用时task放入当前线程的队列，空闲的工作线程可以窃取它
+		template <typename Ret>
+		void Spawn(AsyncTask<Ret>& task);
+
+		// @brief 等待task结束或产出下一个值并返回结果，task尚未交给调度器时在当前线程执行
+		// @note 在工作线程上调用时，等待期间继续执行其他任务，而不是阻塞工作线程
+		template <typename Ret>
+		typename AsyncTask<Ret>::Reference Join(AsyncTask<Ret>& task);
+
+		Usize WorkerCount() const noexcept { return m_workerCount; }
+		WorkerStatistics GetWorkerStatistics(Usize workerIndex) const noexcept;
+		// @brief 当前线程是否为该调度器的工作线程
+		bool IsWorkerThread() const noexcept;
+	private:
+		struct alignas(CacheLineBytes) Worker
+		{
+			WorkStealingDeque<std::coroutine_handle<>> Deque;
+			// 只由所属工作线程写入
+			std::atomic<u64> Executed = 0;
+			std::atomic<u64> Stolen = 0;
+			std::atomic<u64> StealAttempts = 0;
+			std::atomic<u64> Injected = 0;
+			std::atomic<u64> Parked = 0;
+			u64 RandomState = 0;
+		};
+
+		void WorkerMain(Usize workerIndex);
+		std::coroutine_handle<> FindWork(Worker& worker);
+		std::coroutine_handle<> StealWork(Worker& thief);
+		// @brief 在当前工作线程上执行一个其他任务，没有任务时返回false
+		bool RunPending();
+		bool HasWork() const noexcept;
+		void Park(Worker& worker);
+		void WakeOne() noexcept;
+
+		Usize m_workerCount;
+		std::unique_ptr<Worker[]> m_workers;
+		MPMCRingBuffer<std::coroutine_handle<>> m_injection;
+
+		alignas(CacheLineBytes) std::atomic<U32> m_wakeEpoch = 0;
+		std::atomic<U32> m_parkedCount = 0;
+		std::atomic<bool> m_stopping = false;
+
+		// 放在最后，先于其他成员析构，线程退出后队列才会释放
+		std::vector<std::jthread> m_threads;
+	};
+
+	template <typename Ret>
+	void Scheduler::Spawn(AsyncTask<Ret>& task)
+	{
+		if (std::coroutine_handle<> handle = task.Start())
+			Enqueue(handle);
+	}
+
+	template <typename Ret>
+	typename AsyncTask<Ret>::Reference Scheduler::Join(AsyncTask<Ret>& task)
+	{
+		// 尚未交给调度器的task直接在当前线程执行
+		if (std::coroutine_handle<> handle = task.Start())
+			handle.resume();
+
+		if (IsWorkerThread())
+		{
+			while (task.Running())
+			{
+				if (!RunPending())
+					std::this_thread::yield();
+			}
+		}
+		task.Wait();
+		return task.m_handle.promise().Get();
+	}
+}
@@ -0,0 +1,140 @@
+// File /Engine/Coroutine/WhenAll.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Container/SmallVector.hpp"
+#include "AsyncTask.hpp"
+#include <atomic>
+#include <coroutine>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace PenFramework::PenEngine
+{
+	// WhenAll返回的SmallVector的内联容量
+	static constexpr Usize WhenAllInlineCapacity = 8;
+
+	namespace Detail
+	{
+		template <typename T>
+		struct IsAsyncTask : std::false_type {};
+
+		template <typename Ret>
+		struct IsAsyncTask<AsyncTask<Ret>> : std::true_type {};
+
+		template <typename Range>
+		concept AsyncTaskRange = std::ranges::forward_range<Range> && IsAsyncTask<std::ranges::range_value_t<Range>>::value;
+
+		template <typename Ret>
+		using WhenAllResultT = std::conditional_t<std::is_void_v<Ret>, std::monostate, Ret>;
+
+		// 产出值的task发布的是挂起状态，不能用Get读取，否则会越过co_yield继续执行
+		template <typename Ret>
+		WhenAllResultT<Ret> TakeWhenAllResult(AsyncTask<Ret>& task)
+		{
+			if constexpr (std::is_void_v<Ret>)
+			{
+				task.Result();
+				return {};
+			}
+			else
+			{
+				return std::move(task.Result());
+			}
+		}
+
+		// 计数从task数量加一开始，每个task结束时减一，await_suspend启动完所有task后再减一
+		// 最后减到零的一方恢复等待的协程，task在await_suspend中同步结束时不会提前恢复它
+		template <typename ForEachTask>
+		class WhenAllAwaiter : public AsyncTaskListener
+		{
+		public:
+			WhenAllAwaiter(Usize taskCount, ForEachTask forEachTask) noexcept : m_remaining(taskCount + 1), m_forEachTask(forEachTask) {}
+
+			static bool await_ready() noexcept { return false; }
+
+			bool await_suspend(std::coroutine_handle<> awaiting) noexcept
+			{
+				m_continuation = awaiting;
+				m_forEachTask([this](auto& task)
+					{
+						std::coroutine_handle<> start;
+						if (AsyncTaskAccess::Attach(task, this, start) == AsyncTaskAccess::AttachResult::Finished)
+							m_remaining.fetch_sub(1, std::memory_order::acq_rel);
+						else if (start)
+							start.resume();
+					});
+				return m_remaining.fetch_sub(1, std::memory_order::acq_rel) != 1;
+			}
+
+			static void await_resume() noexcept {}
+
+			std::coroutine_handle<> OnPublished(const void*) noexcept override
+			{
+				if (m_remaining.fetch_sub(1, std::memory_order::acq_rel) == 1)
+					return m_continuation;
+				return std::noop_coroutine();
+			}
+		private:
+			std::atomic<Usize> m_remaining;
+			std::coroutine_handle<> m_continuation;
+			ForEachTask m_forEachTask;
+		};
+
+		template <typename ForEachTask>
+		WhenAllAwaiter<ForEachTask> MakeWhenAllAwaiter(Usize taskCount, ForEachTask forEachTask) noexcept
+		{
+			return WhenAllAwaiter<ForEachTask>(taskCount, forEachTask);
+		}
+
+		// Range为左值引用时引用调用方的范围，否则移动到协程帧中
+		template <typename Range>
+		AsyncTask<SmallVector<WhenAllResultT<typename std::ranges::range_value_t<Range>::ValueType>, WhenAllInlineCapacity>> WhenAllRange(Range tasks)
+		{
+			using Result = WhenAllResultT<typename std::ranges::range_value_t<Range>::ValueType>;
+
+			co_await MakeWhenAllAwaiter(static_cast<Usize>(std::ranges::distance(tasks)), [&](auto&& func)
+				{
+					for (auto& task : tasks)
+						func(task);
+				});
+
+			SmallVector<Result, WhenAllInlineCapacity> results;
+			results.reserve(static_cast<Usize>(std::ranges::distance(tasks)));
+			for (auto& task : tasks)
+				results.push_back(TakeWhenAllResult(task));
+			co_return std::move(results);
+		}
+	}
+
+	// @brief 等待所有task结束，按参数顺序返回结果，void的结果为std::monostate
+	// @note 尚未开始的task依次在当前线程启动，已交给Scheduler的task并行执行
+	// 有task抛出异常时，所有task结束后重新抛出第一个失败的task的异常
+	template <typename... Rets>
+	AsyncTask<std::tuple<Detail::WhenAllResultT<Rets>...>> WhenAll(AsyncTask<Rets>... tasks)
+	{
+		co_await Detail::MakeWhenAllAwaiter(sizeof...(Rets), [&](auto&& func) { (func(tasks), ...); });
+		// 花括号保证按参数顺序取出结果，重新抛出的是第一个失败的task的异常
+		co_return std::tuple<Detail::WhenAllResultT<Rets>...>{ Detail::TakeWhenAllResult(tasks)... };
+	}
+
+	// @brief 等待范围内所有task结束，按顺序返回结果
+	// @note 传入左值时范围由调用方持有，必须在返回的task结束前保持有效，传入右值时范围被移动到协程帧中
+	template <Detail::AsyncTaskRange Range>
+	auto WhenAll(Range&& tasks)
+	{
+		return Detail::WhenAllRange<Range>(std::forward<Range>(tasks));
+	}
+}
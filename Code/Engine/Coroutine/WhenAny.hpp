@@ -0,0 +1,133 @@
+// File /Engine/Coroutine/WhenAny.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "AsyncTask.hpp"
+#include "WhenAll.hpp"
+#include <atomic>
+#include <coroutine>
+#include <ranges>
+#include <thread>
+
+namespace PenFramework::PenEngine
+{
+	namespace Detail
+	{
+		// 第一个结束的task记为胜者，胜者与await_suspend中较晚的一方恢复等待的协程
+		// 恢复后撤销在其余task上的登记，已经取走listener的task通知完成之前不会离开await_resume
+		template <typename ForEachTask>
+		class WhenAnyAwaiter : public AsyncTaskListener
+		{
+		public:
+			explicit WhenAnyAwaiter(ForEachTask forEachTask) noexcept : m_forEachTask(forEachTask) {}
+
+			static bool await_ready() noexcept { return false; }
+
+			bool await_suspend(std::coroutine_handle<> awaiting) noexcept
+			{
+				m_continuation = awaiting;
+				m_forEachTask([this](auto& task)
+					{
+						// 已有task结束时不再启动后面的task
+						if (m_winner.load(std::memory_order::acquire) != nullptr)
+							return;
+
+						std::coroutine_handle<> start;
+						if (AsyncTaskAccess::Attach(task, this, start) == AsyncTaskAccess::AttachResult::Finished)
+						{
+							Win(AsyncTaskAccess::Identity(task));
+							return;
+						}
+
+						m_attached.fetch_add(1, std::memory_order::relaxed);
+						if (start)
+							start.resume();
+					});
+				return m_pending.fetch_sub(1, std::memory_order::acq_rel) != 1;
+			}
+
+			Usize await_resume() noexcept
+			{
+				Usize detached = 0;
+				Usize index = 0;
+				Usize winnerIndex = 0;
+				const void* winner = m_winner.load(std::memory_order::acquire);
+				m_forEachTask([&](auto& task)
+					{
+						if (AsyncTaskAccess::Detach(task, this))
+							++detached;
+						if (AsyncTaskAccess::Identity(task) == winner)
+							winnerIndex = index;
+						++index;
+					});
+
+				// 这里只会短暂等待正在发布状态的task
+				while (m_notified.load(std::memory_order::acquire) != m_attached.load(std::memory_order::relaxed) - detached)
+					std::this_thread::yield();
+				return winnerIndex;
+			}
+
+			std::coroutine_handle<> OnPublished(const void* task) noexcept override
+			{
+				std::coroutine_handle<> next = Win(task) ? m_continuation : std::noop_coroutine();
+				// 最后一次访问this，之后await_resume可能立即返回
+				m_notified.fetch_add(1, std::memory_order::acq_rel);
+				return next;
+			}
+		private:
+			// @brief 成为胜者且await_suspend已经结束时返回true
+			bool Win(const void* task) noexcept
+			{
+				const void* expected = nullptr;
+				if (!m_winner.compare_exchange_strong(expected, task, std::memory_order::acq_rel, std::memory_order::acquire))
+					return false;
+				return m_pending.fetch_sub(1, std::memory_order::acq_rel) == 1;
+			}
+
+			std::atomic<const void*> m_winner = nullptr;
+			// 胜者与await_suspend各占一个
+			std::atomic<U32> m_pending = 2;
+			std::atomic<Usize> m_attached = 0;
+			std::atomic<Usize> m_notified = 0;
+			std::coroutine_handle<> m_continuation;
+			ForEachTask m_forEachTask;
+		};
+
+		template <typename ForEachTask>
+		WhenAnyAwaiter<ForEachTask> MakeWhenAnyAwaiter(ForEachTask forEachTask) noexcept
+		{
+			return WhenAnyAwaiter<ForEachTask>(forEachTask);
+		}
+	}
+
+	// @brief 等待任意一个task结束或产出值，返回它的下标，通过该task的Result取得结果
+	// Get会恢复产出值后挂起的task，读取到的是它之后的结果
+	// @note 尚未开始的task依次在当前线程启动，直到某个task结束；之后的task保持挂起，不会被启动
+	// task由调用方持有，其余仍在执行的task必须在销毁前等待它们结束
+	template <typename... Rets> requires (sizeof...(Rets) > 0)
+	AsyncTask<Usize> WhenAny(AsyncTask<Rets>&... tasks)
+	{
+		co_return co_await Detail::MakeWhenAnyAwaiter([&](auto&& func) { (func(tasks), ...); });
+	}
+
+	// @brief 等待范围内任意一个task结束，返回它的下标
+	// @note 范围不能为空，并且必须在返回的task结束前保持有效
+	template <Detail::AsyncTaskRange Range>
+	AsyncTask<Usize> WhenAny(Range& tasks)
+	{
+		co_return co_await Detail::MakeWhenAnyAwaiter([&](auto&& func)
+			{
+				for (auto& task : tasks)
+					func(task);
+			});
+	}
+}
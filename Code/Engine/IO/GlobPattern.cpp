@@ -0,0 +1,405 @@
+// File /Engine/IO/GlobPattern.cpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "GlobPattern.h"
+
+#include "../Exception/InvalidArgument.hpp"
+#include <map>
+
+namespace
+{
+	using namespace PenFramework::PenEngine;
+
+	std::bitset<256> SeparatorSet() noexcept
+	{
+		std::bitset<256> res;
+		res.set('/');
+		res.set('\\');
+		return res;
+	}
+
+	void AddByte(std::bitset<256>& set, U8 byte, bool caseInsensitive) noexcept
+	{
+		set.set(byte);
+		if (caseInsensitive && byte >= 'a' && byte <= 'z')
+			set.set(byte - 'a' + 'A');
+		else if (caseInsensitive && byte >= 'A' && byte <= 'Z')
+			set.set(byte - 'A' + 'a');
+	}
+
+	// @brief 解析从'['之后开始的字符集合
+	// @retval 指向']'之后的位置
+	const Ch* ParseBracket(const Ch* p, const Ch* end, std::bitset<256>& set, bool caseInsensitive)
+	{
+		bool negate = p != end && (*p == '!' || *p == '^');
+		if (negate)
+			++p;
+
+		bool first = true;
+		for (;; first = false)
+		{
+			if (p == end)
+				throw InvalidArgument("GlobPattern", "Function GlobPattern", "unterminated character class");
+
+			// 紧跟在'['或取反符号之后的']'按普通字符处理
+			if (*p == ']' && !first)
+				break;
+
+			if (*p == '\\' && ++p == end)
+				throw InvalidArgument("GlobPattern", "Function GlobPattern", "pattern ends with an escape character");
+			U8 low = static_cast<U8>(*p++);
+			U8 high = low;
+
+			if (p + 1 < end && *p == '-' && p[1] != ']')
+			{
+				++p;
+				if (*p == '\\' && ++p == end)
+					throw InvalidArgument("GlobPattern", "Function GlobPattern", "pattern ends with an escape character");
+				high = static_cast<U8>(*p++);
+				if (high < low)
+					throw InvalidArgument("GlobPattern", "Function GlobPattern", "invalid range in character class");
+			}
+
+			for (U32 ch = low; ch <= high; ++ch)
+				AddByte(set, static_cast<U8>(ch), caseInsensitive);
+		}
+
+		if (negate)
+			set.flip();
+
+		return p + 1;
+	}
+}
+
+PenFramework::PenEngine::GlobPattern::GlobPattern(StringView pattern, GlobOptionFlag options) :
+	GlobPattern(std::span<const StringView>(&pattern, 1), options)
+{
+}
+
+PenFramework::PenEngine::GlobPattern::GlobPattern(std::span<const StringView> patterns, GlobOptionFlag options) :
+	m_options(options)
+{
+	Compile(patterns);
+}
+
+PenFramework::PenEngine::GlobPattern::GlobPattern(std::initializer_list<StringView> patterns, GlobOptionFlag options) :
+	GlobPattern(std::span<const StringView>(patterns.begin(), patterns.size()), options)
+{
+}
+
+bool PenFramework::PenEngine::GlobPattern::Match(StringView text) const
+{
+	return MatchIndex(text) != NPos;
+}
+
+bool PenFramework::PenEngine::GlobPattern::Match(const Path& path) const
+{
+	return MatchIndex(path.ToView()) != NPos;
+}
+
+PenFramework::PenEngine::Usize PenFramework::PenEngine::GlobPattern::MatchIndex(StringView text) const
+{
+	if (m_patternCount == 0)
+		return NPos;
+
+	if (IsDeterministic())
+	{
+		U32 state = m_dfaStart;
+		for (Ch ch : text)
+		{
+			state = m_transitions[state * m_classCount + m_byteClass[static_cast<U8>(ch)]];
+			if (state == DeadState)
+				return NPos;
+		}
+
+		return m_acceptOffsets[state] == m_acceptOffsets[state + 1] ? NPos : m_acceptPatterns[m_acceptOffsets[state]];
+	}
+
+	// NFA模拟只在模式很多且复杂时使用，这里的分配相对于逐字符的位集运算可以忽略
+	StateSet set = Simulate(text);
+	std::vector<Usize> accepts;
+	CollectAccepts(set, accepts);
+	return accepts.empty() ? NPos : accepts.front();
+}
+
+PenFramework::PenEngine::Usize PenFramework::PenEngine::GlobPattern::MatchIndex(const Path& path) const
+{
+	return MatchIndex(path.ToView());
+}
+
+void PenFramework::PenEngine::GlobPattern::MatchAll(StringView text, std::vector<Usize>& out) const
+{
+	if (m_patternCount == 0)
+		return;
+
+	if (IsDeterministic())
+	{
+		U32 state = m_dfaStart;
+		for (Ch ch : text)
+		{
+			state = m_transitions[state * m_classCount + m_byteClass[static_cast<U8>(ch)]];
+			if (state == DeadState)
+				return;
+		}
+
+		out.insert(out.end(), m_acceptPatterns.begin() + m_acceptOffsets[state], m_acceptPatterns.begin() + m_acceptOffsets[state + 1]);
+		return;
+	}
+
+	CollectAccepts(Simulate(text), out);
+}
+
+std::vector<PenFramework::PenEngine::Usize> PenFramework::PenEngine::GlobPattern::MatchAll(StringView text) const
+{
+	std::vector<Usize> res;
+	MatchAll(text, res);
+	return res;
+}
+
+std::vector<PenFramework::PenEngine::Usize> PenFramework::PenEngine::GlobPattern::MatchAll(const Path& path) const
+{
+	return MatchAll(path.ToView());
+}
+
+void PenFramework::PenEngine::GlobPattern::Compile(std::span<const StringView> patterns)
+{
+	m_patternCount = patterns.size();
+	for (Usize i = 0; i < patterns.size(); ++i)
+		CompilePattern(patterns[i], i);
+
+	BuildByteClasses();
+	BuildDfa();
+}
+
+void PenFramework::PenEngine::GlobPattern::CompilePattern(StringView pattern, Usize patternIndex)
+{
+	bool pathMode = m_options.Test(GlobOption::PathSeparator);
+	bool caseInsensitive = m_options.Test(GlobOption::CaseInsensitive);
+
+	std::bitset<256> separators = pathMode ? SeparatorSet() : std::bitset<256>();
+	std::bitset<256> nonSeparators = ~separators;
+
+	m_starts.push_back(m_states.size());
+
+	const Ch* begin = pattern.Data();
+	const Ch* end = pattern.EndData();
+	for (const Ch* p = begin; p != end;)
+	{
+		NfaState state;
+
+		if (*p == '*')
+		{
+			const Ch* starEnd = p;
+			while (starEnd != end && *starEnd == '*')
+				++starEnd;
+
+			// "**"只有作为完整路径段出现时才跨越目录
+			bool segmentStart = p == begin || p[-1] == '/';
+			bool globStar = pathMode && starEnd - p == 2 && segmentStart && (starEnd == end || *starEnd == '/');
+
+			state.Set = globStar ? ~std::bitset<256>() : nonSeparators;
+			state.Loop = true;
+
+			if (globStar && starEnd != end)
+			{
+				// "**/"匹配零或多层以分隔符结尾的目录：任意字节后跟一个分隔符，或者整体跳过
+				// 跳过只能发生在进入时，所以放在一个不消耗字节的入口状态上，而不是循环状态本身
+				NfaState entry;
+				entry.Loop = true;
+				entry.Skip = m_states.size() + 3;
+				m_states.push_back(entry);
+				m_states.push_back(state);
+
+				NfaState separator;
+				separator.Set = separators;
+				m_states.push_back(separator);
+				p = starEnd + 1;
+				continue;
+			}
+
+			m_states.push_back(state);
+			p = starEnd;
+			continue;
+		}
+
+		if (*p == '?')
+		{
+			state.Set = nonSeparators;
+			++p;
+		}
+		else if (*p == '[')
+		{
+			p = ParseBracket(p + 1, end, state.Set, caseInsensitive);
+			state.Set &= nonSeparators;
+		}
+		else if (*p == '/' && pathMode)
+		{
+			state.Set = separators;
+			++p;
+		}
+		else
+		{
+			if (*p == '\\' && ++p == end)
+				throw InvalidArgument("GlobPattern", "Function GlobPattern", "pattern ends with an escape character");
+			AddByte(state.Set, static_cast<U8>(*p++), caseInsensitive);
+		}
+
+		m_states.push_back(state);
+	}
+
+	NfaState accept;
+	accept.Accept = patternIndex;
+	m_states.push_back(accept);
+}
+
+void PenFramework::PenEngine::GlobPattern::BuildByteClasses()
+{
+	// 按照每个字节属于哪些状态的集合来划分等价类，同一类中的字节在任何状态下的转移都相同
+	std::array<U32, 256> classes = {};
+	U32 classCount = 1;
+
+	for (const NfaState& state : m_states)
+	{
+		if (state.Set.none() || state.Set.all())
+			continue;
+
+		std::map<std::pair<U32, bool>, U32> refined;
+		for (Usize byte = 0; byte < 256; ++byte)
+		{
+			auto [it, inserted] = refined.try_emplace({ classes[byte], state.Set.test(byte) }, static_cast<U32>(refined.size()));
+			classes[byte] = it->second;
+		}
+		classCount = static_cast<U32>(refined.size());
+	}
+
+	for (Usize byte = 0; byte < 256; ++byte)
+		m_byteClass[byte] = static_cast<U8>(classes[byte]);
+	m_classCount = classCount;
+}
+
+void PenFramework::PenEngine::GlobPattern::BuildDfa()
+{
+	Usize words = (m_states.size() + 63) / 64;
+
+	// 每个字节类取一个代表字节
+	std::vector<U8> representatives(m_classCount);
+	for (Usize byte = 256; byte-- > 0;)
+		representatives[m_byteClass[byte]] = static_cast<U8>(byte);
+
+	std::map<StateSet, U32> ids;
+	std::vector<StateSet> pending;
+
+	auto intern = [&](StateSet&& set) -> U32
+		{
+			auto [it, inserted] = ids.try_emplace(std::move(set), static_cast<U32>(ids.size()));
+			if (inserted)
+				pending.push_back(it->first);
+			return it->second;
+		};
+
+	intern(StateSet(words, 0));
+
+	StateSet start(words, 0);
+	for (Usize state : m_starts)
+		AddState(start, state);
+	m_dfaStart = intern(std::move(start));
+
+	std::vector<U32> transitions;
+	std::vector<U32> acceptOffsets;
+	std::vector<Usize> acceptPatterns;
+
+	// 状态按编号顺序处理，pending中第i个元素就是编号为i的状态
+	StateSet next(words);
+	for (Usize index = 0; index < pending.size(); ++index)
+	{
+		if (ids.size() > GlobMaxDfaStates)
+			return;
+
+		StateSet current = pending[index];
+		acceptOffsets.push_back(static_cast<U32>(acceptPatterns.size()));
+		CollectAccepts(current, acceptPatterns);
+
+		for (Usize cls = 0; cls < m_classCount; ++cls)
+		{
+			Step(current, representatives[cls], next);
+			transitions.push_back(intern(StateSet(next)));
+		}
+	}
+	acceptOffsets.push_back(static_cast<U32>(acceptPatterns.size()));
+
+	m_transitions = std::move(transitions);
+	m_acceptOffsets = std::move(acceptOffsets);
+	m_acceptPatterns = std::move(acceptPatterns);
+}
+
+void PenFramework::PenEngine::GlobPattern::AddState(StateSet& set, Usize state) const noexcept
+{
+	// 每个状态最多两条空转移，沿着空转移把可达的状态全部加入
+	while (state != NPos)
+	{
+		u64 bit = 1ull << (state % 64);
+		if (set[state / 64] & bit)
+			return;
+		set[state / 64] |= bit;
+
+		const NfaState& nfa = m_states[state];
+		if (nfa.Skip != NPos)
+			AddState(set, nfa.Skip);
+		state = nfa.Loop ? state + 1 : NPos;
+	}
+}
+
+void PenFramework::PenEngine::GlobPattern::Step(const StateSet& from, U8 byte, StateSet& to) const noexcept
+{
+	std::fill(to.begin(), to.end(), 0);
+
+	for (Usize word = 0; word < from.size(); ++word)
+	{
+		for (u64 bits = from[word]; bits != 0; bits &= bits - 1)
+		{
+			Usize state = word * 64 + static_cast<Usize>(std::countr_zero(bits));
+			const NfaState& nfa = m_states[state];
+			if (nfa.Accept == NPos && nfa.Set.test(byte))
+				AddState(to, nfa.Loop ? state : state + 1);
+		}
+	}
+}
+
+PenFramework::PenEngine::GlobPattern::StateSet PenFramework::PenEngine::GlobPattern::Simulate(StringView text) const
+{
+	Usize words = (m_states.size() + 63) / 64;
+	StateSet current(words, 0);
+	StateSet next(words, 0);
+
+	for (Usize state : m_starts)
+		AddState(current, state);
+
+	for (Ch ch : text)
+	{
+		Step(current, static_cast<U8>(ch), next);
+		current.swap(next);
+	}
+
+	return current;
+}
+
+void PenFramework::PenEngine::GlobPattern::CollectAccepts(const StateSet& set, std::vector<Usize>& out) const
+{
+	// 接受状态按模式顺序排列，得到的下标自然是升序的
+	for (Usize word = 0; word < set.size(); ++word)
+	{
+		for (u64 bits = set[word]; bits != 0; bits &= bits - 1)
+		{
+			const NfaState& nfa = m_states[word * 64 + static_cast<Usize>(std::countr_zero(bits))];
+			if (nfa.Accept != NPos)
+				out.push_back(nfa.Accept);
+		}
+	}
+}
@@ -0,0 +1,114 @@
+// File /Engine/IO/GlobPattern.h
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../String/StringView.hpp"
+#include "../Utils/Flag.hpp"
+#include "Path.h"
+#include <array>
+#include <bitset>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+namespace PenFramework::PenEngine
+{
+	enum class GlobOption : U8
+	{
+		None = 0,
+		// '*'与'?'不匹配路径分隔符，"**"作为完整的路径段时匹配任意层目录；'/'与'\\'都视为分隔符
+		PathSeparator = 1 << 0,
+		// 仅对ASCII字母忽略大小写
+		CaseInsensitive = 1 << 1,
+	};
+
+	DECL_ENUM_FLAG_TYPE(GlobOption)
+
+	// DFA状态数的上限，超过时退回位集NFA模拟，匹配仍为线性时间但每个字符的开销与模式长度相关
+	static constexpr Usize GlobMaxDfaStates = 4096;
+
+	// 将一个或多个通配符模式编译为自动机，匹配时间与文本长度成线性关系，不会回溯
+	// 支持的语法：
+	// *        任意个字符
+	// ?        一个字符
+	// [abc]    字符集合，支持a-z形式的范围，以!或^开头表示取反
+	// **       PathSeparator模式下作为完整路径段出现时匹配零或多层目录，例如"**/*.png"、"Textures/**"
+	// \c       匹配字面字符c
+	// @note 匹配以字节为单位，'?'与字符集合对非ASCII的UTF-8字符按单个字节处理
+	class GlobPattern
+	{
+	public:
+		GlobPattern() noexcept = default;
+		explicit GlobPattern(StringView pattern, GlobOptionFlag options = GlobOption::PathSeparator);
+		explicit GlobPattern(std::span<const StringView> patterns, GlobOptionFlag options = GlobOption::PathSeparator);
+		GlobPattern(std::initializer_list<StringView> patterns, GlobOptionFlag options = GlobOption::PathSeparator);
+
+		// @brief 是否有任意一个模式与text完全匹配
+		bool Match(StringView text) const;
+		bool Match(const Path& path) const;
+
+		// @brief 返回与text匹配的下标最小的模式
+		// @retval 没有模式匹配时返回NPos
+		Usize MatchIndex(StringView text) const;
+		Usize MatchIndex(const Path& path) const;
+
+		// @brief 将所有与text匹配的模式下标按升序追加到out
+		void MatchAll(StringView text, std::vector<Usize>& out) const;
+		std::vector<Usize> MatchAll(StringView text) const;
+		std::vector<Usize> MatchAll(const Path& path) const;
+
+		Usize PatternCount() const noexcept { return m_patternCount; }
+		// @brief 是否已经构建出DFA，否则使用位集NFA模拟
+		bool IsDeterministic() const noexcept { return !m_transitions.empty(); }
+	private:
+		// NFA中的一个位置，消耗一个属于Set的字节后前往下一个位置
+		// Loop为真时消耗后停留在原位置，并且可以不消耗字节直接前往下一个位置
+		// Skip不为NPos时可以不消耗字节直接前往Skip
+		struct NfaState
+		{
+			std::bitset<256> Set;
+			bool Loop = false;
+			Usize Skip = NPos;
+			// 不为NPos时表示到达该位置即第Accept个模式匹配成功
+			Usize Accept = NPos;
+		};
+
+		using StateSet = std::vector<u64>;
+
+		void Compile(std::span<const StringView> patterns);
+		void CompilePattern(StringView pattern, Usize patternIndex);
+		void BuildByteClasses();
+		void BuildDfa();
+
+		void AddState(StateSet& set, Usize state) const noexcept;
+		void Step(const StateSet& from, U8 byte, StateSet& to) const noexcept;
+		StateSet Simulate(StringView text) const;
+		void CollectAccepts(const StateSet& set, std::vector<Usize>& out) const;
+
+		// 空状态编号为0，进入后可以提前结束
+		static constexpr U32 DeadState = 0;
+
+		std::vector<NfaState> m_states;
+		std::vector<Usize> m_starts;
+		Usize m_patternCount = 0;
+		GlobOptionFlag m_options;
+
+		std::array<U8, 256> m_byteClass = {};
+		Usize m_classCount = 0;
+
+		U32 m_dfaStart = DeadState;
+		std::vector<U32> m_transitions;
+		// 第i个DFA状态接受的模式下标为m_acceptPatterns[m_acceptOffsets[i], m_acceptOffsets[i + 1])
+		std::vector<U32> m_acceptOffsets;
+		std::vector<Usize> m_acceptPatterns;
+	};
+}
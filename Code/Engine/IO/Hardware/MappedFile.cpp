@@ -0,0 +1,145 @@
+// File /Engine/IO/Hardware/MappedFile.cpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+// 
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "MappedFile.h"
+#include <utility>
+
+#ifdef _WIN32
+#include "../../Environment/Win32Environment.h"
+#else // _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+PenFramework::PenEngine::MappedFile::~MappedFile() noexcept
+{
+	Close();
+}
+
+PenFramework::PenEngine::MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+	*this = std::move(other);
+}
+
+PenFramework::PenEngine::MappedFile& PenFramework::PenEngine::MappedFile::operator=(MappedFile&& other) noexcept
+{
+	if (this != &other)
+	{
+		Close();
+
+		m_data = std::exchange(other.m_data, nullptr);
+		m_size = std::exchange(other.m_size, 0);
+		m_opened = std::exchange(other.m_opened, false);
+
+		#ifdef _WIN32
+		m_file = std::exchange(other.m_file, nullptr);
+		m_mapping = std::exchange(other.m_mapping, nullptr);
+		#endif // _WIN32
+	}
+
+	return *this;
+}
+
+bool PenFramework::PenEngine::MappedFile::Open(const Path& path)
+{
+	Close();
+
+	#ifdef _WIN32
+	std::wstring nativePath = path.ToStdString<wchar_t>();
+
+	HANDLE file = CreateFileW(nativePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	m_file = file;
+	m_size = static_cast<Usize>(size.QuadPart);
+	m_opened = true;
+
+	// 空文件无法创建映射，但仍然视为打开成功
+	if (m_size == 0)
+		return true;
+
+	m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (m_mapping == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	m_data = static_cast<const B8*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+	#else // _WIN32
+	int file = open(path.Data(), O_RDONLY | O_CLOEXEC);
+	if (file < 0)
+		return false;
+
+	struct stat status;
+	if (fstat(file, &status) != 0)
+	{
+		close(file);
+		return false;
+	}
+
+	m_size = static_cast<Usize>(status.st_size);
+	m_opened = true;
+
+	if (m_size != 0)
+	{
+		void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+		if (data != MAP_FAILED)
+		{
+			// 按行处理通常是顺序访问，提示内核加大预读
+			madvise(data, m_size, MADV_SEQUENTIAL);
+			m_data = static_cast<const B8*>(data);
+		}
+	}
+
+	// 映射建立后即可关闭文件描述符
+	close(file);
+	#endif // _WIN32
+
+	if (m_size != 0 && m_data == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void PenFramework::PenEngine::MappedFile::Close() noexcept
+{
+	#ifdef _WIN32
+	if (m_data != nullptr)
+		UnmapViewOfFile(m_data);
+	if (m_mapping != nullptr)
+		CloseHandle(m_mapping);
+	if (m_file != nullptr)
+		CloseHandle(m_file);
+
+	m_mapping = nullptr;
+	m_file = nullptr;
+	#else // _WIN32
+	if (m_data != nullptr)
+		munmap(const_cast<B8*>(m_data), m_size);
+	#endif // _WIN32
+
+	m_data = nullptr;
+	m_size = 0;
+	m_opened = false;
+}
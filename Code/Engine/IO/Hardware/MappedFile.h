@@ -0,0 +1,52 @@
+// File /Engine/IO/Hardware/MappedFile.h
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+// 
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Common/Type.hpp"
+#include "../../String/StringView.hpp"
+#include "../Path.h"
+
+namespace PenFramework::PenEngine
+{
+	// 只读的文件内存映射，映射期间文件内容可以直接作为StringView访问
+	class MappedFile
+	{
+	public:
+		MappedFile() noexcept = default;
+		~MappedFile() noexcept;
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		// @brief 映射整个文件，已打开的映射会先被关闭
+		// @retval 文件不存在或映射失败时返回false
+		bool Open(const Path& path);
+		void Close() noexcept;
+
+		bool IsOpen() const noexcept { return m_opened; }
+
+		const B8* Data() const noexcept { return m_data; }
+		Usize Size() const noexcept { return m_size; }
+
+		StringView View() const noexcept { return StringView(reinterpret_cast<const Ch*>(m_data), m_size); }
+	private:
+		const B8* m_data = nullptr;
+		Usize m_size = 0;
+		bool m_opened = false;
+
+		#ifdef _WIN32
+		void* m_file = nullptr;
+		void* m_mapping = nullptr;
+		#endif // _WIN32
+	};
+}
@@ -9,6 +9,7 @@
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "Path.h"
+#include "../Container/SmallVector.hpp"
 
 #include "Internal/PathNormalizer.h"
 #include "Internal/PathUtils.h"
@@ -422,7 +423,8 @@ PenFramework::PenEngine::String PenFramework::PenEngine::Path::Normalize(StringV
 
 	String res(path.Size());
 
-	std::vector<StringView> stack;
+	// 绝大多数路径的层级不超过16，不需要分配堆内存
+	SmallVector<StringView, 16> stack;
 
 	Internal::PathNormalizer normalizer(path, Internal::PathNormalizer::State::AtStart);
 
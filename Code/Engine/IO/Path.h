@@ -139,6 +139,9 @@ namespace PenFramework::PenEngine
 	}
 }
 
+template <>
+struct PenFramework::PenEngine::Memory::IsTriviallyRelocatable<PenFramework::PenEngine::Path> : std::true_type {};
+
 template <>
 struct std::hash<PenFramework::PenEngine::Path>
 {
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "../Common/Type.hpp"
+#include "../Memory/Relocation.hpp"
 #include <algorithm>
 #include <cstdint>
 
@@ -868,3 +869,9 @@ namespace PenFramework::PenEngine
 		return Color32(R + (R + target) * t, G + (G + target) * t, B + (B + target) * t, A + (A + target) * t);
 	}
 }
+
+template <>
+struct PenFramework::PenEngine::Memory::IsTriviallyRelocatable<PenFramework::PenEngine::ColorF> : std::true_type {};
+
+template <>
+struct PenFramework::PenEngine::Memory::IsTriviallyRelocatable<PenFramework::PenEngine::Color32> : std::true_type {};
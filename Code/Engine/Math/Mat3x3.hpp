@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "../Memory/Relocation.hpp"
 #include "MathFunction.hpp"
 #include "Vec3.hpp"
 
@@ -163,4 +164,7 @@ namespace PenFramework::PenEngine
 
 		return *this;
 	}
-}
\ No newline at end of file
+}
+
+template <>
+struct PenFramework::PenEngine::Memory::IsTriviallyRelocatable<PenFramework::PenEngine::Mat3x3> : std::true_type {};
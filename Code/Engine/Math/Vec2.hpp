@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "../Memory/Relocation.hpp"
 #include "MathFunction.hpp"
 
 namespace PenFramework::PenEngine
@@ -401,4 +402,7 @@ namespace PenFramework::PenEngine
         return ReflectWithUnit(v.Normalized());
 	}
 
-}
\ No newline at end of file
+}
+
+template <>
+struct PenFramework::PenEngine::Memory::IsTriviallyRelocatable<PenFramework::PenEngine::Vec2> : std::true_type {};
@@ -9,6 +9,7 @@
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #pragma once
 
+#include "../Memory/Relocation.hpp"
 #include "MathFunction.hpp"
 
 namespace PenFramework::PenEngine
@@ -308,3 +309,6 @@ namespace PenFramework::PenEngine
 	}
 
 }
+
+template <>
+struct PenFramework::PenEngine::Memory::IsTriviallyRelocatable<PenFramework::PenEngine::Vec3> : std::true_type {};
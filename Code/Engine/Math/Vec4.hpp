@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "../Memory/Relocation.hpp"
 #include "MathFunction.hpp"
 
 namespace PenFramework::PenEngine
@@ -322,3 +323,6 @@ namespace PenFramework::PenEngine
 		return *this - v * (2.0f * Dot(v));
 	}
 }
+
+template <>
+struct PenFramework::PenEngine::Memory::IsTriviallyRelocatable<PenFramework::PenEngine::Vec4> : std::true_type {};
@@ -0,0 +1,364 @@
+// File /Engine/Memory/HeapProfiler.cpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "HeapProfiler.h"
+#include "../Utils/Preprocessor.hpp"
+#include "../Utils/ThreadLocal.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include "../Environment/Win32Environment.h"
+#else // _WIN32
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif // _WIN32
+
+namespace
+{
+	using namespace PenFramework::PenEngine;
+	using namespace PenFramework::PenEngine::Memory;
+	using namespace PenFramework::PenEngine::Memory::Detail;
+
+	struct StackRecord
+	{
+		std::vector<void*> Frames;
+		MemoryTag Tag;
+
+		// 仍然存活的被采样分配，未经放大
+		Usize LiveCount = 0;
+		Usize LiveBytes = 0;
+		// 按采样概率放大后的估计值
+		double EstimatedLiveBytes = 0;
+		double EstimatedLiveObjects = 0;
+
+		// 自开始采样以来的所有被采样分配
+		Usize TotalCount = 0;
+		Usize TotalBytes = 0;
+	};
+
+	struct LiveSample
+	{
+		Usize Stack;
+		Usize Bytes;
+		double Scale;
+	};
+
+	struct Profiler
+	{
+		std::mutex Mutex;
+		HeapProfilerOptions Options;
+		std::string ExitReportPath;
+		bool ExitReportRegistered = false;
+
+		std::vector<StackRecord> Stacks;
+		std::unordered_map<std::string, Usize> StackIndex;
+		std::unordered_map<void*, LiveSample> Live;
+	};
+
+	// 退出时写出报告以及静态对象析构时的释放都需要访问它
+	Profiler& GetProfiler()
+	{
+		return ImmortalInstance<Profiler>();
+	}
+
+	std::atomic<Usize> g_sampleIntervalBytes = HeapProfilerOptions().SampleIntervalBytes;
+	std::atomic<Usize> g_maxStackDepth = HeapProfilerOptions().MaxStackDepth;
+
+	thread_local constinit bool t_countdownInitialized = false;
+	thread_local constinit bool t_insideProfiler = false;
+
+	// 采样间隔服从均值为SampleIntervalBytes的指数分布，即每个字节以相同的概率触发采样
+	Isize NextSampleCountdown() noexcept
+	{
+		thread_local std::minstd_rand engine(static_cast<U32>(reinterpret_cast<uintptr_t>(&t_countdownInitialized)));
+		std::exponential_distribution<double> distribution(1.0 / static_cast<double>(g_sampleIntervalBytes.load(std::memory_order::relaxed)));
+		return static_cast<Isize>(distribution(engine)) + 1;
+	}
+
+	NOINLINE Usize CaptureStack(void** frames, Usize maxDepth) noexcept
+	{
+		// 跳过CaptureStack与SampleAllocation自身
+		constexpr Usize skip = 2;
+		void* buffer[HeapProfilerMaxStackDepth + skip];
+		Usize depth = std::min(maxDepth, HeapProfilerMaxStackDepth) + skip;
+
+		#ifdef _WIN32
+		Usize captured = RtlCaptureStackBackTrace(0, static_cast<DWORD>(depth), buffer, nullptr);
+		#else // _WIN32
+		Usize captured = static_cast<Usize>(backtrace(buffer, static_cast<int>(depth)));
+		#endif // _WIN32
+
+		if (captured <= skip)
+			return 0;
+
+		std::copy(buffer + skip, buffer + captured, frames);
+		return captured - skip;
+	}
+
+	std::string SymbolName(void* address)
+	{
+		#ifndef _WIN32
+		Dl_info info;
+		if (dladdr(address, &info) != 0 && info.dli_sname != nullptr)
+		{
+			int status = 0;
+			char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+			std::string res = status == 0 && demangled != nullptr ? demangled : info.dli_sname;
+			std::free(demangled);
+
+			// ';'与' '在折叠格式中有特殊含义
+			std::ranges::replace(res, ';', ':');
+			std::ranges::replace(res, ' ', '_');
+			return res;
+		}
+		#endif // _WIN32
+
+		return std::format("{}", address);
+	}
+
+	void WriteExitReport()
+	{
+		Profiler& profiler = GetProfiler();
+		std::string path;
+		HeapProfileFormat format;
+		{
+			std::scoped_lock lock(profiler.Mutex);
+			path = profiler.ExitReportPath;
+			format = profiler.Options.ExitReportFormat;
+		}
+
+		if (path.empty())
+			return;
+
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		if (out)
+			DumpHeapProfile(out, format);
+	}
+}
+
+void PenFramework::PenEngine::Memory::StartHeapProfiler(const HeapProfilerOptions& options)
+{
+	Profiler& profiler = GetProfiler();
+	std::scoped_lock lock(profiler.Mutex);
+
+	profiler.Options = options;
+	profiler.Options.SampleIntervalBytes = std::max<Usize>(options.SampleIntervalBytes, 1);
+	profiler.ExitReportPath = options.ExitReportPath != nullptr ? options.ExitReportPath : "";
+
+	if (!profiler.ExitReportPath.empty() && !profiler.ExitReportRegistered)
+	{
+		profiler.ExitReportRegistered = true;
+		std::atexit(WriteExitReport);
+	}
+
+	g_sampleIntervalBytes.store(profiler.Options.SampleIntervalBytes, std::memory_order::relaxed);
+	g_maxStackDepth.store(options.MaxStackDepth, std::memory_order::relaxed);
+	g_heapProfilerRunning.store(true, std::memory_order::relaxed);
+}
+
+void PenFramework::PenEngine::Memory::StopHeapProfiler() noexcept
+{
+	Profiler& profiler = GetProfiler();
+	std::scoped_lock lock(profiler.Mutex);
+
+	g_heapProfilerRunning.store(false, std::memory_order::relaxed);
+	for (std::atomic<U8>& counter : g_heapSampleFilter)
+		counter.store(0, std::memory_order::relaxed);
+
+	profiler.Stacks.clear();
+	profiler.StackIndex.clear();
+	profiler.Live.clear();
+}
+
+bool PenFramework::PenEngine::Memory::IsHeapProfilerRunning() noexcept
+{
+	return g_heapProfilerRunning.load(std::memory_order::relaxed);
+}
+
+void PenFramework::PenEngine::Memory::DumpHeapProfile(std::ostream& out, HeapProfileFormat format)
+{
+	Profiler& profiler = GetProfiler();
+
+	// 输出流可能经过Memory::Allocate，期间不能持有锁，所以先复制一份
+	std::vector<StackRecord> stacks;
+	Usize interval;
+	{
+		std::scoped_lock lock(profiler.Mutex);
+		stacks = profiler.Stacks;
+		interval = profiler.Options.SampleIntervalBytes;
+	}
+
+	if (format == HeapProfileFormat::Pprof)
+	{
+		// heap_v2格式中的数量是未经放大的采样值，pprof会根据采样间隔自行换算
+		Usize liveCount = 0, liveBytes = 0, totalCount = 0, totalBytes = 0;
+		for (const StackRecord& stack : stacks)
+		{
+			liveCount += stack.LiveCount;
+			liveBytes += stack.LiveBytes;
+			totalCount += stack.TotalCount;
+			totalBytes += stack.TotalBytes;
+		}
+
+		out << std::format("heap profile: {}: {} [{}: {}] @ heap_v2/{}\n", liveCount, liveBytes, totalCount, totalBytes, interval);
+		for (const StackRecord& stack : stacks)
+		{
+			out << std::format("{}: {} [{}: {}] @", stack.LiveCount, stack.LiveBytes, stack.TotalCount, stack.TotalBytes);
+			for (void* frame : stack.Frames)
+				out << std::format(" {}", frame);
+			out << '\n';
+		}
+
+		#ifdef __linux__
+		// pprof根据映射表把地址对应到可执行文件与动态库
+		out << "\nMAPPED_LIBRARIES:\n";
+		if (std::ifstream maps("/proc/self/maps"); maps)
+			out << maps.rdbuf();
+		#endif // __linux__
+		return;
+	}
+
+	// 折叠格式从最外层的调用开始，以标签作为根节点
+	std::unordered_map<void*, std::string> symbols;
+	for (const StackRecord& stack : stacks)
+	{
+		if (stack.LiveCount == 0)
+			continue;
+
+		out << MemoryTagName(stack.Tag);
+		for (auto it = stack.Frames.rbegin(); it != stack.Frames.rend(); ++it)
+		{
+			auto [symbol, inserted] = symbols.try_emplace(*it);
+			if (inserted)
+				symbol->second = SymbolName(*it);
+			out << ';' << symbol->second;
+		}
+		out << ' ' << static_cast<u64>(std::llround(stack.EstimatedLiveBytes)) << '\n';
+	}
+}
+
+PenFramework::PenEngine::Memory::HeapProfileSummary PenFramework::PenEngine::Memory::GetHeapProfileSummary()
+{
+	Profiler& profiler = GetProfiler();
+	std::scoped_lock lock(profiler.Mutex);
+
+	HeapProfileSummary res;
+	double bytes = 0, objects = 0;
+	for (const StackRecord& stack : profiler.Stacks)
+	{
+		res.LiveSampleCount += stack.LiveCount;
+		bytes += stack.EstimatedLiveBytes;
+		objects += stack.EstimatedLiveObjects;
+	}
+
+	res.EstimatedLiveBytes = static_cast<Usize>(std::llround(bytes));
+	res.EstimatedLiveObjects = static_cast<Usize>(std::llround(objects));
+	res.StackCount = profiler.Stacks.size();
+	return res;
+}
+
+NOINLINE void PenFramework::PenEngine::Memory::Detail::SampleAllocation(void* ptr, Usize bytes, MemoryTag tag) noexcept
+{
+	// 第一次经过的线程只初始化倒计时，避免每个线程的第一次分配都被采样
+	if (!t_countdownInitialized)
+	{
+		t_countdownInitialized = true;
+		t_heapSampleCountdown = NextSampleCountdown();
+		return;
+	}
+
+	t_heapSampleCountdown = NextSampleCountdown();
+
+	// 写出报告等过程中的分配不再采样
+	if (t_insideProfiler || ptr == nullptr)
+		return;
+	t_insideProfiler = true;
+
+	void* frames[HeapProfilerMaxStackDepth];
+	Usize depth = CaptureStack(frames, g_maxStackDepth.load(std::memory_order::relaxed));
+
+	// 一个大小为bytes的分配被采样的概率为1 - e^(-bytes / interval)，按其倒数放大得到无偏估计
+	double interval = static_cast<double>(g_sampleIntervalBytes.load(std::memory_order::relaxed));
+	double scale = 1.0 / -std::expm1(-static_cast<double>(std::max<Usize>(bytes, 1)) / interval);
+
+	std::string key(reinterpret_cast<const char*>(frames), depth * sizeof(void*));
+	key.push_back(static_cast<char>(tag));
+
+	try
+	{
+		Profiler& profiler = GetProfiler();
+		std::scoped_lock lock(profiler.Mutex);
+
+		if (g_heapProfilerRunning.load(std::memory_order::relaxed))
+		{
+			auto [it, inserted] = profiler.StackIndex.try_emplace(std::move(key), profiler.Stacks.size());
+			if (inserted)
+				profiler.Stacks.push_back({ std::vector<void*>(frames, frames + depth), tag });
+
+			StackRecord& stack = profiler.Stacks[it->second];
+			++stack.LiveCount;
+			++stack.TotalCount;
+			stack.LiveBytes += bytes;
+			stack.TotalBytes += bytes;
+			stack.EstimatedLiveBytes += static_cast<double>(bytes) * scale;
+			stack.EstimatedLiveObjects += scale;
+
+			profiler.Live[ptr] = { it->second, bytes, scale };
+
+			// 计数饱和后不再减少，只会让之后的释放多查找一次
+			std::atomic<U8>& counter = g_heapSampleFilter[HeapSampleFilterIndex(ptr)];
+			U8 value = counter.load(std::memory_order::relaxed);
+			if (value != std::numeric_limits<U8>::max())
+				counter.store(value + 1, std::memory_order::relaxed);
+		}
+	}
+	catch (...)
+	{
+		// 记录失败只会丢失这一次采样
+	}
+
+	t_insideProfiler = false;
+}
+
+void PenFramework::PenEngine::Memory::Detail::ReleaseSample(void* ptr) noexcept
+{
+	Profiler& profiler = GetProfiler();
+	std::scoped_lock lock(profiler.Mutex);
+
+	auto it = profiler.Live.find(ptr);
+	if (it == profiler.Live.end())
+		return;
+
+	const LiveSample& sample = it->second;
+	StackRecord& stack = profiler.Stacks[sample.Stack];
+	--stack.LiveCount;
+	stack.LiveBytes -= sample.Bytes;
+	stack.EstimatedLiveBytes -= static_cast<double>(sample.Bytes) * sample.Scale;
+	stack.EstimatedLiveObjects -= sample.Scale;
+	profiler.Live.erase(it);
+
+	std::atomic<U8>& counter = g_heapSampleFilter[HeapSampleFilterIndex(ptr)];
+	U8 value = counter.load(std::memory_order::relaxed);
+	if (value != std::numeric_limits<U8>::max())
+		counter.store(value - 1, std::memory_order::relaxed);
+}
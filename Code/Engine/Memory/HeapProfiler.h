@@ -0,0 +1,102 @@
+// File /Engine/Memory/HeapProfiler.h
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "MemoryTracker.h"
+#include <array>
+#include <atomic>
+#include <iosfwd>
+
+// 定义MEMORY_HEAP_PROFILER为1后Memory::Allocate/Deallocate会调用采样钩子，仍需要StartHeapProfiler()才开始采样
+#ifndef MEMORY_HEAP_PROFILER
+#define MEMORY_HEAP_PROFILER 0
+#endif // MEMORY_HEAP_PROFILER
+
+namespace PenFramework::PenEngine::Memory
+{
+	// 能记录的最大调用栈深度
+	static constexpr Usize HeapProfilerMaxStackDepth = 64;
+
+	enum class HeapProfileFormat : U8
+	{
+		// gperftools的heap_v2文本格式，地址未符号化，可以交给pprof并指定可执行文件分析
+		Pprof,
+		// 每行为以';'连接的调用栈与估计的存活字节数，可以直接生成火焰图
+		Folded,
+	};
+
+	struct HeapProfilerOptions
+	{
+		// 平均每分配多少字节采样一次，采样间隔服从指数分布，所以小分配也有被采样的机会
+		Usize SampleIntervalBytes = 512 * 1024;
+		Usize MaxStackDepth = 32;
+		// 不为空时在程序退出时写出报告
+		const Ch* ExitReportPath = nullptr;
+		HeapProfileFormat ExitReportFormat = HeapProfileFormat::Folded;
+	};
+
+	struct HeapProfileSummary
+	{
+		Usize LiveSampleCount = 0;
+		// 按采样概率放大后的估计值
+		Usize EstimatedLiveBytes = 0;
+		Usize EstimatedLiveObjects = 0;
+		Usize StackCount = 0;
+	};
+
+	// @brief 开始采样，已经在运行时只更新选项
+	void StartHeapProfiler(const HeapProfilerOptions& options = {});
+	// @brief 停止采样并丢弃所有记录
+	void StopHeapProfiler() noexcept;
+	bool IsHeapProfilerRunning() noexcept;
+
+	// @brief 以format格式写出当前仍存活的被采样分配
+	void DumpHeapProfile(std::ostream& out, HeapProfileFormat format);
+	HeapProfileSummary GetHeapProfileSummary();
+
+	namespace Detail
+	{
+		// 按地址哈希的计数过滤器，释放时只有命中的地址才需要加锁查找
+		static constexpr Usize HeapSampleFilterSize = 1 << 16;
+
+		inline constinit std::atomic<bool> g_heapProfilerRunning = false;
+		inline constinit std::array<std::atomic<U8>, HeapSampleFilterSize> g_heapSampleFilter = {};
+		inline thread_local constinit Isize t_heapSampleCountdown = 0;
+
+		constexpr Usize HeapSampleFilterIndex(const void* ptr) noexcept
+		{
+			u64 address = static_cast<u64>(reinterpret_cast<uintptr_t>(ptr));
+			return static_cast<Usize>((address * 0x9E3779B97F4A7C15ull) >> 48) & (HeapSampleFilterSize - 1);
+		}
+
+		void SampleAllocation(void* ptr, Usize bytes, MemoryTag tag) noexcept;
+		void ReleaseSample(void* ptr) noexcept;
+	}
+
+	// @brief 分配钩子，不采样时的开销为一次原子读取与一次减法
+	inline void HeapProfilerRecordAllocate(void* ptr, Usize bytes, MemoryTag tag = MemoryTag::General) noexcept
+	{
+		if (!Detail::g_heapProfilerRunning.load(std::memory_order::relaxed))
+			return;
+
+		Detail::t_heapSampleCountdown -= static_cast<Isize>(bytes);
+		if (Detail::t_heapSampleCountdown < 0)
+			Detail::SampleAllocation(ptr, bytes, tag);
+	}
+
+	// @brief 释放钩子，地址没有命中过滤器时只有一次原子读取
+	inline void HeapProfilerRecordDeallocate(void* ptr) noexcept
+	{
+		if (Detail::g_heapSampleFilter[Detail::HeapSampleFilterIndex(ptr)].load(std::memory_order::relaxed) != 0)
+			Detail::ReleaseSample(ptr);
+	}
+}
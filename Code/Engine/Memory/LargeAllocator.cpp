@@ -0,0 +1,183 @@
+// File /Engine/Memory/LargeAllocator.cpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "LargeAllocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+
+#ifdef _WIN32
+#include "../Environment/Win32Environment.h"
+#else // _WIN32
+#include <sys/mman.h>
+#endif // _WIN32
+
+namespace
+{
+	using namespace PenFramework::PenEngine;
+	using namespace PenFramework::PenEngine::Memory;
+
+	std::atomic<LargeAllocationOptionFlag> g_largeAllocationOptions = LargeAllocationOptionFlag(LargeAllocationOption::TransparentHugePage);
+
+	// 系统一旦拒绝预留大页，之后就不再尝试，避免每次分配都多一次失败的系统调用
+	std::atomic<bool> g_explicitHugePageUnavailable = false;
+
+	void PrefaultPages(void* ptr, Usize bytes) noexcept
+	{
+		// 每页写入一次，强制建立页表项
+		volatile U8* page = static_cast<volatile U8*>(ptr);
+		for (Usize offset = 0; offset < bytes; offset += LargeAllocationPageBytes)
+			page[offset] = 0;
+	}
+
+	#ifdef _WIN32
+	void* MapPages(Usize bytes, LargeAllocationOptionFlag options) noexcept
+	{
+		if (options.Test(LargeAllocationOption::ExplicitHugePage) && bytes % LargeAllocationHugePageBytes == 0 && !g_explicitHugePageUnavailable.load(std::memory_order::relaxed))
+		{
+			// 大页需要SeLockMemoryPrivilege权限，没有权限时失败
+			if (void* res = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE))
+				return res;
+			g_explicitHugePageUnavailable.store(true, std::memory_order::relaxed);
+		}
+
+		void* res = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+		if (res != nullptr && options.Test(LargeAllocationOption::Prefault))
+			PrefaultPages(res, bytes);
+		return res;
+	}
+
+	void UnmapPages(void* ptr, Usize) noexcept
+	{
+		VirtualFree(ptr, 0, MEM_RELEASE);
+	}
+	#else // _WIN32
+	void* MapPages(Usize bytes, LargeAllocationOptionFlag options) noexcept
+	{
+		int populate = 0;
+		#ifdef MAP_POPULATE
+		populate = options.Test(LargeAllocationOption::Prefault) ? MAP_POPULATE : 0;
+		#endif // MAP_POPULATE
+
+		#ifdef MAP_HUGETLB
+		if (options.Test(LargeAllocationOption::ExplicitHugePage) && bytes % LargeAllocationHugePageBytes == 0 && !g_explicitHugePageUnavailable.load(std::memory_order::relaxed))
+		{
+			// 系统没有预留大页时失败
+			void* res = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | populate, -1, 0);
+			if (res != MAP_FAILED)
+				return res;
+			g_explicitHugePageUnavailable.store(true, std::memory_order::relaxed);
+		}
+		#endif // MAP_HUGETLB
+
+		bool hugePage = options.Test(LargeAllocationOption::TransparentHugePage) && bytes >= LargeAllocationHugePageBytes;
+		if (!hugePage)
+		{
+			void* res = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | populate, -1, 0);
+			if (res == MAP_FAILED)
+				return nullptr;
+
+			#ifndef MAP_POPULATE
+			if (options.Test(LargeAllocationOption::Prefault))
+				PrefaultPages(res, bytes);
+			#endif // MAP_POPULATE
+			return res;
+		}
+
+		// 多映射一个大页再裁掉首尾，保证起始地址按大页对齐，内核才能用大页填充整个区域
+		Usize reserved = bytes + LargeAllocationHugePageBytes;
+		U8* base = static_cast<U8*>(mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+		if (base == MAP_FAILED)
+			return nullptr;
+
+		U8* aligned = reinterpret_cast<U8*>((reinterpret_cast<uintptr_t>(base) + LargeAllocationHugePageBytes - 1) & ~(LargeAllocationHugePageBytes - 1));
+		if (aligned != base)
+			munmap(base, static_cast<Usize>(aligned - base));
+		if (Usize tail = static_cast<Usize>(base + reserved - (aligned + bytes)); tail != 0)
+			munmap(aligned + bytes, tail);
+
+		#ifdef MADV_HUGEPAGE
+		madvise(aligned, bytes, MADV_HUGEPAGE);
+		#endif // MADV_HUGEPAGE
+
+		#ifdef MADV_POPULATE_WRITE
+		// 在建议使用大页之后再预先建立页表，才能直接得到大页
+		if (options.Test(LargeAllocationOption::Prefault) && madvise(aligned, bytes, MADV_POPULATE_WRITE) == 0)
+			return aligned;
+		#endif // MADV_POPULATE_WRITE
+
+		if (options.Test(LargeAllocationOption::Prefault))
+			PrefaultPages(aligned, bytes);
+		return aligned;
+	}
+
+	void UnmapPages(void* ptr, Usize bytes) noexcept
+	{
+		munmap(ptr, bytes);
+	}
+	#endif // _WIN32
+}
+
+void PenFramework::PenEngine::Memory::SetLargeAllocationOptions(LargeAllocationOptionFlag options) noexcept
+{
+	g_largeAllocationOptions.store(options, std::memory_order::relaxed);
+}
+
+PenFramework::PenEngine::Memory::LargeAllocationOptionFlag PenFramework::PenEngine::Memory::GetLargeAllocationOptions() noexcept
+{
+	return g_largeAllocationOptions.load(std::memory_order::relaxed);
+}
+
+void* PenFramework::PenEngine::Memory::LargeAllocate(Usize bytes)
+{
+	return LargeAllocate(bytes, GetLargeAllocationOptions());
+}
+
+void* PenFramework::PenEngine::Memory::LargeAllocate(Usize bytes, LargeAllocationOptionFlag options)
+{
+	void* res = MapPages(LargeAllocationMappingBytes(std::max<Usize>(bytes, 1)), options);
+	if (res == nullptr)
+		throw std::bad_alloc();
+	return res;
+}
+
+void PenFramework::PenEngine::Memory::LargeDeallocate(void* ptr, Usize bytes) noexcept
+{
+	if (ptr != nullptr)
+		UnmapPages(ptr, LargeAllocationMappingBytes(std::max<Usize>(bytes, 1)));
+}
+
+void* PenFramework::PenEngine::Memory::LargeReallocate(void* ptr, Usize oldBytes, Usize newBytes)
+{
+	Usize oldMapping = LargeAllocationMappingBytes(std::max<Usize>(oldBytes, 1));
+	Usize newMapping = LargeAllocationMappingBytes(std::max<Usize>(newBytes, 1));
+	if (oldMapping == newMapping)
+		return ptr;
+
+	#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+	// 内核直接移动页表项，原有的物理页保持不变，不需要复制数据
+	void* res = mremap(ptr, oldMapping, newMapping, MREMAP_MAYMOVE);
+	if (res != MAP_FAILED)
+	{
+		#ifdef MADV_HUGEPAGE
+		if (newMapping >= LargeAllocationHugePageBytes && GetLargeAllocationOptions().Test(LargeAllocationOption::TransparentHugePage))
+			madvise(res, newMapping, MADV_HUGEPAGE);
+		#endif // MADV_HUGEPAGE
+		return res;
+	}
+	#endif // __linux__ && MREMAP_MAYMOVE
+
+	void* moved = LargeAllocate(newBytes);
+	std::memcpy(moved, ptr, std::min(oldBytes, newBytes));
+	LargeDeallocate(ptr, oldBytes);
+	return moved;
+}
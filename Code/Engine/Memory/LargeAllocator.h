@@ -0,0 +1,65 @@
+// File /Engine/Memory/LargeAllocator.h
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Utils/Flag.hpp"
+
+// 默认开启，Memory::Allocate/Deallocate在请求不小于LargeAllocationThresholdBytes时直接向系统映射内存
+// 定义MEMORY_LARGE_ALLOCATOR为0可以关闭
+#ifndef MEMORY_LARGE_ALLOCATOR
+#define MEMORY_LARGE_ALLOCATOR 1
+#endif // MEMORY_LARGE_ALLOCATOR
+
+namespace PenFramework::PenEngine::Memory
+{
+	enum class LargeAllocationOption : U8
+	{
+		None = 0,
+		// 映射按大页对齐并通过madvise(MADV_HUGEPAGE)请求透明大页
+		TransparentHugePage = 1 << 0,
+		// 优先使用MAP_HUGETLB或MEM_LARGE_PAGES的预留大页，系统没有可用的大页时退回普通映射
+		ExplicitHugePage = 1 << 1,
+		// 映射时立即建立全部页表项，避免之后首次访问时逐页触发缺页
+		Prefault = 1 << 2,
+	};
+
+	DECL_ENUM_FLAG_TYPE(LargeAllocationOption)
+
+	// 不小于该字节数的请求经由系统映射分配
+	static constexpr Usize LargeAllocationThresholdBytes = 1 << 20;
+	static constexpr Usize LargeAllocationPageBytes = 4 * 1024;
+	static constexpr Usize LargeAllocationHugePageBytes = 2 * 1024 * 1024;
+
+	// @brief 一次分配实际映射的字节数，只由bytes决定，所以释放时不需要额外记录
+	// @note 不小于一个大页的请求按大页取整，否则按普通页取整
+	constexpr Usize LargeAllocationMappingBytes(Usize bytes) noexcept
+	{
+		Usize granularity = bytes >= LargeAllocationHugePageBytes ? LargeAllocationHugePageBytes : LargeAllocationPageBytes;
+		return (bytes + granularity - 1) & ~(granularity - 1);
+	}
+
+	// @brief 设置之后的大块分配使用的选项，默认为TransparentHugePage
+	void SetLargeAllocationOptions(LargeAllocationOptionFlag options) noexcept;
+	LargeAllocationOptionFlag GetLargeAllocationOptions() noexcept;
+
+	// @brief 直接向系统映射至少bytes字节，起始地址至少按页对齐，内容为零
+	// @note 映射失败时抛出std::bad_alloc
+	void* LargeAllocate(Usize bytes);
+	void* LargeAllocate(Usize bytes, LargeAllocationOptionFlag options);
+
+	// @brief 归还LargeAllocate得到的内存，bytes必须与分配时相同
+	void LargeDeallocate(void* ptr, Usize bytes) noexcept;
+
+	// @brief 将映射从oldBytes调整为newBytes，保留前min(oldBytes, newBytes)字节的内容
+	// @note Linux上通过mremap调整，不需要复制数据，其他平台上重新映射并复制
+	void* LargeReallocate(void* ptr, Usize oldBytes, Usize newBytes);
+}
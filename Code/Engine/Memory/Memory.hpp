@@ -9,32 +9,129 @@
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #pragma once
 
-#include <atomic>
-
 #include "../Common/Type.hpp"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include "HeapProfiler.h"
+#include "LargeAllocator.h"
+#include "MemoryTracker.h"
+#include "PoolAllocator.h"
+#include "Relocation.hpp"
 
 namespace PenFramework::PenEngine::Memory
 {
-	static std::atomic<Usize> g_currentMemoryAllocatedBytes;
+	namespace Detail
+	{
+		template <typename T>
+		static T* RawAllocate(Usize count)
+		{
+			#if MEMORY_LARGE_ALLOCATOR
+			if (count * sizeof(T) >= LargeAllocationThresholdBytes)
+				return static_cast<T*>(LargeAllocate(count * sizeof(T)));
+			#endif // MEMORY_LARGE_ALLOCATOR
 
+			#if MEMORY_POOL_ALLOCATOR
+			if constexpr (alignof(T) <= PoolAlignment)
+				return static_cast<T*>(PoolAllocate(count * sizeof(T)));
+			else
+			#endif // MEMORY_POOL_ALLOCATOR
+			// 默认对齐已经足够时不使用带align_val_t的版本，多数运行库中它走的是较慢的路径
+			if constexpr (alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+				return static_cast<T*>(operator new(count * sizeof(T)));
+			else
+				return static_cast<T*>(operator new(count * sizeof(T), std::align_val_t{alignof(T)}));
+		}
+
+		template <typename T>
+		static void RawDeallocate(T* buffer, Usize count) noexcept
+		{
+			#if MEMORY_LARGE_ALLOCATOR
+			if (count * sizeof(T) >= LargeAllocationThresholdBytes)
+			{
+				LargeDeallocate(buffer, count * sizeof(T));
+				return;
+			}
+			#endif // MEMORY_LARGE_ALLOCATOR
+
+			#if MEMORY_POOL_ALLOCATOR
+			if constexpr (alignof(T) <= PoolAlignment)
+				PoolDeallocate(buffer, count * sizeof(T));
+			else
+			#endif // MEMORY_POOL_ALLOCATOR
+			if constexpr (alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+				operator delete(buffer, count * sizeof(T));
+			else
+				operator delete(buffer, count * sizeof(T), std::align_val_t{alignof(T)});
+		}
+	}
+
+	// @brief 分配count个T大小的未初始化内存，并计入tag对应子系统的统计
 	template <typename T>
-	static T* Allocate(Usize count)
+	static T* Allocate(Usize count, MemoryTag tag = MemoryTag::General)
 	{
-		#ifdef _DEBUG
-		g_currentMemoryAllocatedBytes.fetch_add(count * sizeof(T), std::memory_order::relaxed);
-		#endif // _DEBUG
+		T* res = Detail::RawAllocate<T>(count);
+
+		// 分配成功后再计入统计，分配抛出异常时计数不变
+		#if MEMORY_TRACKING
+		TrackAllocate(tag, count * sizeof(T));
+		#endif // MEMORY_TRACKING
 
-		return static_cast<T*>(operator new(count * sizeof(T), std::align_val_t{alignof(T)}));
+		#if MEMORY_HEAP_PROFILER
+		HeapProfilerRecordAllocate(res, count * sizeof(T), tag);
+		#endif // MEMORY_HEAP_PROFILER
+
+		return res;
 	}
 
+	// @brief 归还Allocate得到的内存，count与tag必须与分配时相同
 	template <typename T>
-	static void Deallocate(T* buffer, Usize count) noexcept
+	static void Deallocate(T* buffer, Usize count, MemoryTag tag = MemoryTag::General) noexcept
+	{
+		#if MEMORY_TRACKING
+		TrackDeallocate(tag, count * sizeof(T));
+		#endif // MEMORY_TRACKING
+
+		#if MEMORY_HEAP_PROFILER
+		HeapProfilerRecordDeallocate(buffer);
+		#endif // MEMORY_HEAP_PROFILER
+
+		Detail::RawDeallocate(buffer, count);
+	}
+
+	// @brief 将Allocate得到的buffer调整为newCount个元素，保留前validCount个元素
+	// @note 新旧大小都经由大块映射时原地调整映射，不复制数据
+	// @note 元素按字节搬到新的缓冲区，T需要可平凡搬动
+	template <typename T> requires IsTriviallyRelocatableV<T>
+	static T* Reallocate(T* buffer, Usize oldCount, Usize newCount, Usize validCount, MemoryTag tag = MemoryTag::General)
 	{
-		#ifdef _DEBUG
-		g_currentMemoryAllocatedBytes.fetch_sub(count * sizeof(T), std::memory_order::relaxed);
-		#endif // _DEBUG
+		#if MEMORY_LARGE_ALLOCATOR
+		if (oldCount * sizeof(T) >= LargeAllocationThresholdBytes && newCount * sizeof(T) >= LargeAllocationThresholdBytes)
+		{
+			// 旧地址释放后可能立即被其他线程的分配使用，必须在调整之前撤销采样记录
+			#if MEMORY_HEAP_PROFILER
+			HeapProfilerRecordDeallocate(buffer);
+			#endif // MEMORY_HEAP_PROFILER
+
+			T* res = static_cast<T*>(LargeReallocate(buffer, oldCount * sizeof(T), newCount * sizeof(T)));
+
+			#if MEMORY_TRACKING
+			TrackDeallocate(tag, oldCount * sizeof(T));
+			TrackAllocate(tag, newCount * sizeof(T));
+			#endif // MEMORY_TRACKING
+
+			#if MEMORY_HEAP_PROFILER
+			HeapProfilerRecordAllocate(res, newCount * sizeof(T), tag);
+			#endif // MEMORY_HEAP_PROFILER
+
+			return res;
+		}
+		#endif // MEMORY_LARGE_ALLOCATOR
 
-		operator delete(buffer, count * sizeof(T), std::align_val_t{alignof(T)});
+		T* res = Allocate<T>(newCount, tag);
+		RelocateRange(buffer, buffer + std::min(validCount, newCount), res);
+		Deallocate(buffer, oldCount, tag);
+		return res;
 	}
 
 	template <typename T, typename... Args>
@@ -0,0 +1,46 @@
+// File /Engine/Memory/MemoryReport.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../String/Format.hpp"
+#include "MemoryTracker.h"
+
+namespace PenFramework::PenEngine::Memory
+{
+	// @brief 将统计结果格式化为每个标签一行的文本，跳过从未分配过的标签
+	// @param earlier 不为空时附加从earlier到statistics之间的分配速率
+	inline String FormatMemoryStatistics(const MemoryStatistics& statistics, const MemoryStatistics* earlier = nullptr)
+	{
+		String res;
+		for (Usize i = 0; i < MemoryTagCount; ++i)
+		{
+			MemoryTag tag = static_cast<MemoryTag>(i);
+			const MemoryTagStatistics& current = statistics[tag];
+			if (current.AllocationCount == 0)
+				continue;
+
+			res.Append(Format("{}: 当前 {} B 峰值 {} B 分配 {} 次 / {} B 释放 {} 次", MemoryTagName(tag), current.CurrentBytes, current.PeakBytes,
+				current.AllocationCount, current.AllocatedBytes, current.DeallocationCount));
+
+			if (earlier != nullptr)
+				res.Append(Format(" 速率 {:.0f} 次/s {:.0f} B/s", statistics.AllocationRate(*earlier, tag), statistics.AllocatedBytesRate(*earlier, tag)));
+
+			res.Append(" 直方图");
+			for (Usize bucket = 0; bucket < MemoryHistogramBucketCount; ++bucket)
+			{
+				if (current.Histogram[bucket] != 0)
+					res.Append(Format(" [{}+]={}", MemoryHistogramBucketLowerBound(bucket), current.Histogram[bucket]));
+			}
+			res.Append('\n');
+		}
+		return res;
+	}
+}
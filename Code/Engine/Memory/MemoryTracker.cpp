@@ -0,0 +1,244 @@
+// File /Engine/Memory/MemoryTracker.cpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "MemoryTracker.h"
+
+#include <mutex>
+
+namespace
+{
+	using namespace PenFramework::PenEngine;
+	using namespace PenFramework::PenEngine::Memory;
+	using namespace PenFramework::PenEngine::Memory::Detail;
+
+	struct GlobalTagCounter
+	{
+		std::atomic<Isize> CurrentBytes;
+		std::atomic<Isize> PeakBytes;
+
+		// 线程的分片已经析构之后的分配直接记录在这里
+		std::atomic<u64> AllocationCount;
+		std::atomic<u64> DeallocationCount;
+		std::atomic<u64> AllocatedBytes;
+		std::array<std::atomic<u64>, MemoryHistogramBucketCount> Histogram;
+	};
+
+	struct Registry
+	{
+		std::mutex Mutex;
+		MemoryShard* Head = nullptr;
+		std::array<GlobalTagCounter, MemoryTagCount> Tags;
+	};
+
+	Registry& GetRegistry()
+	{
+		return ImmortalInstance<Registry>();
+	}
+
+	void UpdatePeak(std::atomic<Isize>& peak, Isize value) noexcept
+	{
+		Isize current = peak.load(std::memory_order::relaxed);
+		while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order::relaxed))
+		{
+		}
+	}
+
+	// 线程退出时合并未提交的字节数，并把分片交给之后创建的线程复用
+	void ReleaseShard() noexcept
+	{
+		MemoryShard* shard = t_memoryShard;
+		t_memoryShard = nullptr;
+
+		if (shard == nullptr)
+			return;
+
+		for (Usize tag = 0; tag < MemoryTagCount; ++tag)
+			FlushPendingBytes(shard->Tags[tag], static_cast<MemoryTag>(tag));
+
+		Registry& registry = GetRegistry();
+		std::scoped_lock lock(registry.Mutex);
+		shard->InUse = false;
+	}
+
+	using ShardExitHook = ThreadExitHook<ReleaseShard>;
+
+	// @retval 分片已经析构时返回false
+	bool AcquireShard()
+	{
+		if (ShardExitHook::State() == ThreadExitState::Destroyed)
+			return false;
+
+		Registry& registry = GetRegistry();
+		{
+			std::scoped_lock lock(registry.Mutex);
+
+			MemoryShard* shard = registry.Head;
+			while (shard != nullptr && shard->InUse)
+				shard = shard->Next;
+
+			if (shard == nullptr)
+			{
+				shard = new MemoryShard();
+				shard->Next = registry.Head;
+				registry.Head = shard;
+			}
+
+			shard->InUse = true;
+			t_memoryShard = shard;
+		}
+
+		ShardExitHook::Activate();
+		return true;
+	}
+
+	Isize PendingBytes(const Registry& registry, Usize tag) noexcept
+	{
+		Isize res = 0;
+		for (const MemoryShard* shard = registry.Head; shard != nullptr; shard = shard->Next)
+			res += shard->Tags[tag].PendingBytes.load(std::memory_order::relaxed);
+		return res;
+	}
+}
+
+const PenFramework::PenEngine::Ch* PenFramework::PenEngine::Memory::MemoryTagName(MemoryTag tag) noexcept
+{
+	switch (tag)
+	{
+	case MemoryTag::General:
+		return "General";
+	case MemoryTag::String:
+		return "String";
+	case MemoryTag::Object:
+		return "Object";
+	case MemoryTag::Container:
+		return "Container";
+	case MemoryTag::Coroutine:
+		return "Coroutine";
+	default:
+		return "Unknown";
+	}
+}
+
+PenFramework::PenEngine::Memory::MemoryTagStatistics PenFramework::PenEngine::Memory::MemoryStatistics::Total() const noexcept
+{
+	MemoryTagStatistics res;
+	for (const MemoryTagStatistics& tag : Tags)
+	{
+		res.CurrentBytes += tag.CurrentBytes;
+		res.PeakBytes += tag.PeakBytes;
+		res.AllocationCount += tag.AllocationCount;
+		res.DeallocationCount += tag.DeallocationCount;
+		res.AllocatedBytes += tag.AllocatedBytes;
+		for (Usize i = 0; i < MemoryHistogramBucketCount; ++i)
+			res.Histogram[i] += tag.Histogram[i];
+	}
+	return res;
+}
+
+double PenFramework::PenEngine::Memory::MemoryStatistics::AllocationRate(const MemoryStatistics& earlier, MemoryTag tag) const noexcept
+{
+	double seconds = std::chrono::duration<double>(Time - earlier.Time).count();
+	return seconds <= 0 ? 0 : static_cast<double>((*this)[tag].AllocationCount - earlier[tag].AllocationCount) / seconds;
+}
+
+double PenFramework::PenEngine::Memory::MemoryStatistics::AllocatedBytesRate(const MemoryStatistics& earlier, MemoryTag tag) const noexcept
+{
+	double seconds = std::chrono::duration<double>(Time - earlier.Time).count();
+	return seconds <= 0 ? 0 : static_cast<double>((*this)[tag].AllocatedBytes - earlier[tag].AllocatedBytes) / seconds;
+}
+
+PenFramework::PenEngine::Memory::MemoryStatistics PenFramework::PenEngine::Memory::GetMemoryStatistics()
+{
+	MemoryStatistics res;
+	res.Time = std::chrono::steady_clock::now();
+
+	Registry& registry = GetRegistry();
+	std::scoped_lock lock(registry.Mutex);
+
+	for (Usize tag = 0; tag < MemoryTagCount; ++tag)
+	{
+		const GlobalTagCounter& global = registry.Tags[tag];
+		MemoryTagStatistics& statistics = res.Tags[tag];
+
+		statistics.CurrentBytes = global.CurrentBytes.load(std::memory_order::relaxed) + PendingBytes(registry, tag);
+		statistics.PeakBytes = std::max(global.PeakBytes.load(std::memory_order::relaxed), statistics.CurrentBytes);
+		statistics.AllocationCount = global.AllocationCount.load(std::memory_order::relaxed);
+		statistics.DeallocationCount = global.DeallocationCount.load(std::memory_order::relaxed);
+		statistics.AllocatedBytes = global.AllocatedBytes.load(std::memory_order::relaxed);
+		for (Usize i = 0; i < MemoryHistogramBucketCount; ++i)
+			statistics.Histogram[i] = global.Histogram[i].load(std::memory_order::relaxed);
+
+		for (const MemoryShard* shard = registry.Head; shard != nullptr; shard = shard->Next)
+		{
+			const MemoryTagCounter& counter = shard->Tags[tag];
+			statistics.AllocationCount += counter.AllocationCount.load(std::memory_order::relaxed);
+			statistics.DeallocationCount += counter.DeallocationCount.load(std::memory_order::relaxed);
+			statistics.AllocatedBytes += counter.AllocatedBytes.load(std::memory_order::relaxed);
+			for (Usize i = 0; i < MemoryHistogramBucketCount; ++i)
+				statistics.Histogram[i] += counter.Histogram[i].load(std::memory_order::relaxed);
+		}
+	}
+
+	return res;
+}
+
+void PenFramework::PenEngine::Memory::ResetMemoryPeak() noexcept
+{
+	Registry& registry = GetRegistry();
+	std::scoped_lock lock(registry.Mutex);
+
+	for (Usize tag = 0; tag < MemoryTagCount; ++tag)
+	{
+		GlobalTagCounter& global = registry.Tags[tag];
+		global.PeakBytes.store(global.CurrentBytes.load(std::memory_order::relaxed) + PendingBytes(registry, tag), std::memory_order::relaxed);
+	}
+}
+
+void PenFramework::PenEngine::Memory::Detail::FlushPendingBytes(MemoryTagCounter& counter, MemoryTag tag) noexcept
+{
+	Isize pending = counter.PendingBytes.load(std::memory_order::relaxed);
+	if (pending == 0)
+		return;
+
+	counter.PendingBytes.store(0, std::memory_order::relaxed);
+
+	GlobalTagCounter& global = GetRegistry().Tags[static_cast<Usize>(tag)];
+	Isize current = global.CurrentBytes.fetch_add(pending, std::memory_order::relaxed) + pending;
+	UpdatePeak(global.PeakBytes, current);
+}
+
+void PenFramework::PenEngine::Memory::Detail::TrackAllocateSlow(MemoryTag tag, Usize bytes) noexcept
+{
+	if (AcquireShard())
+	{
+		TrackAllocate(tag, bytes);
+		return;
+	}
+
+	GlobalTagCounter& global = GetRegistry().Tags[static_cast<Usize>(tag)];
+	global.AllocationCount.fetch_add(1, std::memory_order::relaxed);
+	global.AllocatedBytes.fetch_add(bytes, std::memory_order::relaxed);
+	global.Histogram[MemoryHistogramBucket(bytes)].fetch_add(1, std::memory_order::relaxed);
+	Isize current = global.CurrentBytes.fetch_add(static_cast<Isize>(bytes), std::memory_order::relaxed) + static_cast<Isize>(bytes);
+	UpdatePeak(global.PeakBytes, current);
+}
+
+void PenFramework::PenEngine::Memory::Detail::TrackDeallocateSlow(MemoryTag tag, Usize bytes) noexcept
+{
+	if (AcquireShard())
+	{
+		TrackDeallocate(tag, bytes);
+		return;
+	}
+
+	GlobalTagCounter& global = GetRegistry().Tags[static_cast<Usize>(tag)];
+	global.DeallocationCount.fetch_add(1, std::memory_order::relaxed);
+	global.CurrentBytes.fetch_sub(static_cast<Isize>(bytes), std::memory_order::relaxed);
+}
@@ -0,0 +1,155 @@
+// File /Engine/Memory/MemoryTracker.h
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Utils/ThreadLocal.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+
+// 默认在所有构建中统计经过Memory::Allocate/Deallocate的内存，定义MEMORY_TRACKING为0可以关闭
+#ifndef MEMORY_TRACKING
+#define MEMORY_TRACKING 1
+#endif // MEMORY_TRACKING
+
+namespace PenFramework::PenEngine::Memory
+{
+	// 分配所属的子系统
+	enum class MemoryTag : U8
+	{
+		General,
+		String,
+		Object,
+		Container,
+		Coroutine,
+		Count,
+	};
+
+	static constexpr Usize MemoryTagCount = static_cast<Usize>(MemoryTag::Count);
+
+	// 大小直方图按2的幂划分，第0个桶为[0, 16)，第i个桶为[2^(i + 3), 2^(i + 4))，最后一个桶包含更大的分配
+	static constexpr Usize MemoryHistogramBucketCount = 16;
+
+	// 每个线程累计的字节变化超过该值时才合并到全局计数，峰值的误差不超过线程数乘以该值
+	static constexpr Usize MemoryTrackerFlushBytes = 64 * 1024;
+
+	const Ch* MemoryTagName(MemoryTag tag) noexcept;
+
+	constexpr Usize MemoryHistogramBucket(Usize bytes) noexcept
+	{
+		Usize width = static_cast<Usize>(std::bit_width(bytes));
+		return width <= 4 ? 0 : std::min(width - 4, MemoryHistogramBucketCount - 1);
+	}
+
+	// @brief 第bucket个桶包含的最小字节数
+	constexpr Usize MemoryHistogramBucketLowerBound(Usize bucket) noexcept
+	{
+		return bucket == 0 ? 0 : Usize(1) << (bucket + 3);
+	}
+
+	struct MemoryTagStatistics
+	{
+		// 多个线程同时分配时当前值与峰值是近似值
+		Isize CurrentBytes = 0;
+		Isize PeakBytes = 0;
+		u64 AllocationCount = 0;
+		u64 DeallocationCount = 0;
+		u64 AllocatedBytes = 0;
+		std::array<u64, MemoryHistogramBucketCount> Histogram = {};
+	};
+
+	struct MemoryStatistics
+	{
+		std::chrono::steady_clock::time_point Time;
+		std::array<MemoryTagStatistics, MemoryTagCount> Tags;
+
+		const MemoryTagStatistics& operator[](MemoryTag tag) const noexcept { return Tags[static_cast<Usize>(tag)]; }
+
+		// @brief 所有标签的合计，峰值为各标签峰值之和，是真实峰值的上界
+		MemoryTagStatistics Total() const noexcept;
+
+		// @brief 从earlier到当前快照之间每秒的分配次数
+		double AllocationRate(const MemoryStatistics& earlier, MemoryTag tag) const noexcept;
+		// @brief 从earlier到当前快照之间每秒分配的字节数
+		double AllocatedBytesRate(const MemoryStatistics& earlier, MemoryTag tag) const noexcept;
+	};
+
+	// @brief 汇总所有线程的计数
+	MemoryStatistics GetMemoryStatistics();
+
+	// @brief 将每个标签的峰值重置为当前值
+	void ResetMemoryPeak() noexcept;
+
+	namespace Detail
+	{
+		// 每个计数只由所属的线程写入，其他线程汇总时读取，所以写入时不需要原子的读改写
+		struct MemoryTagCounter
+		{
+			std::atomic<Isize> PendingBytes;
+			std::atomic<u64> AllocationCount;
+			std::atomic<u64> DeallocationCount;
+			std::atomic<u64> AllocatedBytes;
+			std::array<std::atomic<u64>, MemoryHistogramBucketCount> Histogram;
+		};
+
+		struct MemoryShard
+		{
+			std::array<MemoryTagCounter, MemoryTagCount> Tags;
+			MemoryShard* Next = nullptr;
+			bool InUse = false;
+		};
+
+		inline thread_local constinit MemoryShard* t_memoryShard = nullptr;
+
+		void FlushPendingBytes(MemoryTagCounter& counter, MemoryTag tag) noexcept;
+		void TrackAllocateSlow(MemoryTag tag, Usize bytes) noexcept;
+		void TrackDeallocateSlow(MemoryTag tag, Usize bytes) noexcept;
+	}
+
+	inline void TrackAllocate(MemoryTag tag, Usize bytes) noexcept
+	{
+		Detail::MemoryShard* shard = Detail::t_memoryShard;
+		if (shard == nullptr)
+		{
+			Detail::TrackAllocateSlow(tag, bytes);
+			return;
+		}
+
+		Detail::MemoryTagCounter& counter = shard->Tags[static_cast<Usize>(tag)];
+		OwnerAdd<u64>(counter.AllocationCount, 1);
+		OwnerAdd<u64>(counter.AllocatedBytes, bytes);
+		OwnerAdd<u64>(counter.Histogram[MemoryHistogramBucket(bytes)], 1);
+		OwnerAdd<Isize>(counter.PendingBytes, static_cast<Isize>(bytes));
+
+		if (counter.PendingBytes.load(std::memory_order::relaxed) >= static_cast<Isize>(MemoryTrackerFlushBytes))
+			Detail::FlushPendingBytes(counter, tag);
+	}
+
+	inline void TrackDeallocate(MemoryTag tag, Usize bytes) noexcept
+	{
+		Detail::MemoryShard* shard = Detail::t_memoryShard;
+		if (shard == nullptr)
+		{
+			Detail::TrackDeallocateSlow(tag, bytes);
+			return;
+		}
+
+		Detail::MemoryTagCounter& counter = shard->Tags[static_cast<Usize>(tag)];
+		OwnerAdd<u64>(counter.DeallocationCount, 1);
+		OwnerAdd<Isize>(counter.PendingBytes, -static_cast<Isize>(bytes));
+
+		if (counter.PendingBytes.load(std::memory_order::relaxed) <= -static_cast<Isize>(MemoryTrackerFlushBytes))
+			Detail::FlushPendingBytes(counter, tag);
+	}
+}
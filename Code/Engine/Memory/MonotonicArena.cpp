@@ -0,0 +1,93 @@
+// File /Engine/Memory/MonotonicArena.cpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "MonotonicArena.h"
+
+PenFramework::PenEngine::MonotonicArena::MonotonicArena(Usize blockBytes, Memory::MemoryTag tag) noexcept :
+	m_blockBytes(std::max<Usize>(blockBytes, sizeof(BlockUnit))), m_tag(tag)
+{
+}
+
+PenFramework::PenEngine::MonotonicArena::~MonotonicArena() noexcept
+{
+	Release();
+}
+
+void* PenFramework::PenEngine::MonotonicArena::AllocateSlow(Usize bytes, Usize alignment)
+{
+	// 当前块放不下时前往下一个块，Reset()或Rewind()之后优先复用已有的块
+	Usize next = m_blocks.empty() ? 0 : m_current + 1;
+	Usize worstCase = bytes + (alignment > alignof(BlockUnit) ? alignment - alignof(BlockUnit) : 0);
+
+	if (next == m_blocks.size() || m_blocks[next].Capacity < worstCase)
+	{
+		// 超过块大小的请求单独得到一个足够大的块，插入到当前块之后
+		Usize units = (std::max(worstCase, m_blockBytes) + sizeof(BlockUnit) - 1) / sizeof(BlockUnit);
+		std::byte* data = reinterpret_cast<std::byte*>(Memory::Allocate<BlockUnit>(units, m_tag));
+		m_blocks.insert(m_blocks.begin() + static_cast<Isize>(next), { data, units * sizeof(BlockUnit) });
+	}
+
+	// 被跳过的块尾部不计入已分配的字节数
+	m_current = next;
+	m_offset = 0;
+	return Allocate(bytes, alignment);
+}
+
+PenFramework::PenEngine::MonotonicArena::Marker PenFramework::PenEngine::MonotonicArena::GetMarker() const noexcept
+{
+	return { m_current, m_offset, m_usedBytes };
+}
+
+void PenFramework::PenEngine::MonotonicArena::Rewind(const Marker& marker) noexcept
+{
+	DEBUG_VERIFY_REPORT(marker.UsedBytes <= m_usedBytes, "MonotonicArena can only rewind to an earlier marker")
+
+	m_current = marker.Block;
+	m_offset = marker.Offset;
+	m_usedBytes = marker.UsedBytes;
+}
+
+void PenFramework::PenEngine::MonotonicArena::Reset() noexcept
+{
+	m_current = 0;
+	m_offset = 0;
+	m_usedBytes = 0;
+}
+
+void PenFramework::PenEngine::MonotonicArena::Release() noexcept
+{
+	for (const Block& block : m_blocks)
+		Memory::Deallocate(reinterpret_cast<BlockUnit*>(block.Data), block.Capacity / sizeof(BlockUnit), m_tag);
+
+	m_blocks.clear();
+	Reset();
+}
+
+PenFramework::PenEngine::Usize PenFramework::PenEngine::MonotonicArena::ReservedBytes() const noexcept
+{
+	Usize res = 0;
+	for (const Block& block : m_blocks)
+		res += block.Capacity;
+	return res;
+}
+
+void* PenFramework::PenEngine::MonotonicArena::do_allocate(Usize bytes, Usize alignment)
+{
+	return Allocate(bytes, alignment);
+}
+
+void PenFramework::PenEngine::MonotonicArena::do_deallocate(void*, Usize, Usize)
+{
+}
+
+bool PenFramework::PenEngine::MonotonicArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+	return this == &other;
+}
@@ -0,0 +1,175 @@
+// File /Engine/Memory/MonotonicArena.h
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../DebugTools/Verify.hpp"
+#include "../String/StringView.hpp"
+#include "Memory.hpp"
+#include <algorithm>
+#include <memory_resource>
+#include <vector>
+
+namespace PenFramework::PenEngine
+{
+	// 默认每个块的字节数
+	static constexpr Usize MonotonicArenaDefaultBlockBytes = 64 * 1024;
+
+	// 单调增长的区域分配器，适合每帧或每个请求内生命周期相同的临时数据
+	// 分配只移动块内的游标，单独释放是空操作，通过Reset()或回退到标记一次性回收
+	// 内存来自若干个依次链接的块，Reset()与Rewind()之后保留所有块供之后复用
+	// 继承自std::pmr::memory_resource，可以直接作为std::pmr容器的内存来源
+	// @note 分配器不会调用对象的析构函数，非平凡析构的对象需要使用者在回收前自行销毁
+	// @note 非线程安全
+	class MonotonicArena : public std::pmr::memory_resource
+	{
+	public:
+		// 记录某一时刻的分配位置，回退后之后分配的内存全部失效
+		struct Marker
+		{
+			Usize Block;
+			Usize Offset;
+			Usize UsedBytes;
+		};
+
+		// @param tag 块的内存计入哪个子系统的统计
+		explicit MonotonicArena(Usize blockBytes = MonotonicArenaDefaultBlockBytes, Memory::MemoryTag tag = Memory::MemoryTag::General) noexcept;
+		~MonotonicArena() noexcept override;
+
+		MonotonicArena(const MonotonicArena&) = delete;
+		MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+		// @brief 分配bytes字节，起始地址按alignment对齐
+		// @note alignment必须是2的幂
+		void* Allocate(Usize bytes, Usize alignment = alignof(std::max_align_t));
+
+		// @brief 分配count个T大小的未初始化内存
+		template <typename T>
+		T* Allocate(Usize count);
+
+		// @brief 在区域中构造一个T
+		template <typename T, typename... Args>
+		T* New(Args&&... args);
+
+		// @brief 将str复制到区域中并在结尾加上空字符
+		// @retval 指向区域内副本的视图
+		template <typename CharType>
+		BasicStringView<CharType> CopyString(BasicStringView<CharType> str);
+
+		Marker GetMarker() const noexcept;
+		// @brief 回退到marker记录的位置，marker必须来自当前区域且晚于最近一次Reset()
+		void Rewind(const Marker& marker) noexcept;
+
+		// @brief 回收所有分配，保留已申请的块
+		void Reset() noexcept;
+		// @brief 回收所有分配并归还全部块
+		void Release() noexcept;
+
+		// @brief 当前已分配的字节数，包括对齐产生的空隙
+		Usize UsedBytes() const noexcept { return m_usedBytes; }
+		// @brief 自构造以来UsedBytes()达到过的最大值
+		Usize HighWaterBytes() const noexcept { return m_highWaterBytes; }
+		// @brief 向Memory申请的总字节数
+		Usize ReservedBytes() const noexcept;
+		Usize BlockCount() const noexcept { return m_blocks.size(); }
+	protected:
+		void* do_allocate(Usize bytes, Usize alignment) override;
+		void do_deallocate(void* ptr, Usize bytes, Usize alignment) override;
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+	private:
+		// 块以max_align_t为单位申请，保证块的起始地址满足基本对齐
+		using BlockUnit = std::max_align_t;
+
+		struct Block
+		{
+			std::byte* Data;
+			Usize Capacity;
+		};
+
+		void* AllocateSlow(Usize bytes, Usize alignment);
+
+		std::vector<Block> m_blocks;
+		Usize m_current = 0;
+		Usize m_offset = 0;
+		Usize m_blockBytes;
+		Usize m_usedBytes = 0;
+		Usize m_highWaterBytes = 0;
+		Memory::MemoryTag m_tag;
+	};
+
+	inline void* MonotonicArena::Allocate(Usize bytes, Usize alignment)
+	{
+		DEBUG_VERIFY_REPORT((alignment & (alignment - 1)) == 0, "MonotonicArena alignment must be a power of two")
+
+		if (m_current < m_blocks.size())
+		{
+			const Block& block = m_blocks[m_current];
+			Usize address = reinterpret_cast<Usize>(block.Data) + m_offset;
+			Usize padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+			if (padding + bytes <= block.Capacity - m_offset)
+			{
+				m_offset += padding + bytes;
+				m_usedBytes += padding + bytes;
+				m_highWaterBytes = std::max(m_highWaterBytes, m_usedBytes);
+				return reinterpret_cast<void*>(address + padding);
+			}
+		}
+
+		return AllocateSlow(bytes, alignment);
+	}
+
+	template <typename T>
+	T* MonotonicArena::Allocate(Usize count)
+	{
+		return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	template <typename T, typename... Args>
+	T* MonotonicArena::New(Args&&... args)
+	{
+		T* res = Allocate<T>(1);
+		Memory::Construct(res, std::forward<Args>(args)...);
+		return res;
+	}
+
+	template <typename CharType>
+	BasicStringView<CharType> MonotonicArena::CopyString(BasicStringView<CharType> str)
+	{
+		CharType* buffer = Allocate<CharType>(str.Size() + 1);
+		std::char_traits<CharType>::copy(buffer, str.Data(), str.Size());
+		buffer[str.Size()] = CharType();
+		return BasicStringView<CharType>(buffer, str.Size());
+	}
+
+	// 从MonotonicArena分配的标准分配器，用于不接受std::pmr::memory_resource的标准容器
+	// 复制后的分配器指向同一个区域，只有区域相同的分配器才相等
+	template <typename T>
+	class ArenaAllocator
+	{
+	public:
+		using value_type = T;
+
+		explicit ArenaAllocator(MonotonicArena& arena) noexcept : m_arena(&arena) {}
+
+		template <typename U>
+		ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_arena(other.Arena()) {}
+
+		T* allocate(Usize count) { return m_arena->Allocate<T>(count); }
+		void deallocate(T*, Usize) noexcept {}
+
+		MonotonicArena* Arena() const noexcept { return m_arena; }
+
+		template <typename U>
+		bool operator==(const ArenaAllocator<U>& other) const noexcept { return m_arena == other.Arena(); }
+	private:
+		MonotonicArena* m_arena;
+	};
+}
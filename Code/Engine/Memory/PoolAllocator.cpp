@@ -0,0 +1,217 @@
+// File /Engine/Memory/PoolAllocator.cpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "PoolAllocator.h"
+#include "../Utils/ThreadLocal.hpp"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace
+{
+	using namespace PenFramework::PenEngine;
+	using namespace PenFramework::PenEngine::Memory;
+	using namespace PenFramework::PenEngine::Memory::Detail;
+
+	static_assert(__STDCPP_DEFAULT_NEW_ALIGNMENT__ >= PoolAlignment, "PoolAllocator requires operator new to return PoolAlignment aligned memory");
+
+	struct FreeNode
+	{
+		FreeNode* Next;
+	};
+
+	// 线程缓存与共享链表之间每次转移的块数，小块转移得多一些以摊薄加锁的开销
+	constexpr Usize BatchCount(Usize sizeClass) noexcept
+	{
+		return std::clamp<Usize>(8 * 1024 / PoolClassBytes(sizeClass), 8, 64);
+	}
+
+	struct FreeList
+	{
+		FreeNode* Head = nullptr;
+		Usize Count = 0;
+	};
+
+	struct CentralList
+	{
+		std::mutex Mutex;
+		FreeList List;
+	};
+
+	std::array<CentralList, PoolSizeClassCount>& CentralLists()
+	{
+		return ImmortalInstance<std::array<CentralList, PoolSizeClassCount>>();
+	}
+
+	// 线程缓存是平凡的，访问时不需要经过thread_local的初始化检查
+	// 线程退出时由CacheExitHook交还缓存，只在第一次补充缓存时注册
+	thread_local constinit std::array<FreeList, PoolSizeClassCount> t_cache = {};
+
+	using CacheExitHook = ThreadExitHook<PoolFlushThreadCache>;
+
+	// 从链表头部摘下至多count个块
+	FreeList PopBatch(FreeList& list, Usize count) noexcept
+	{
+		FreeList res;
+		if (list.Head == nullptr)
+			return res;
+
+		FreeNode* tail = list.Head;
+		res.Count = 1;
+		while (res.Count < count && tail->Next != nullptr)
+		{
+			tail = tail->Next;
+			++res.Count;
+		}
+
+		res.Head = list.Head;
+		list.Head = tail->Next;
+		list.Count -= res.Count;
+		tail->Next = nullptr;
+		return res;
+	}
+
+	void ReleaseToCentral(Usize sizeClass, FreeList batch) noexcept
+	{
+		if (batch.Head == nullptr)
+			return;
+
+		// 在加锁之前找到链尾
+		FreeNode* tail = batch.Head;
+		while (tail->Next != nullptr)
+			tail = tail->Next;
+
+		CentralList& central = CentralLists()[sizeClass];
+		std::scoped_lock lock(central.Mutex);
+		tail->Next = central.List.Head;
+		central.List.Head = batch.Head;
+		central.List.Count += batch.Count;
+	}
+
+	// 将一整段内存切分为同一级的块
+	FreeList CarveSpan(Usize sizeClass)
+	{
+		Usize blockBytes = PoolClassBytes(sizeClass);
+		Usize count = PoolSpanBytes / blockBytes;
+		std::byte* span = static_cast<std::byte*>(::operator new(PoolSpanBytes));
+
+		for (Usize i = 0; i + 1 < count; ++i)
+			reinterpret_cast<FreeNode*>(span + i * blockBytes)->Next = reinterpret_cast<FreeNode*>(span + (i + 1) * blockBytes);
+		reinterpret_cast<FreeNode*>(span + (count - 1) * blockBytes)->Next = nullptr;
+
+		return { reinterpret_cast<FreeNode*>(span), count };
+	}
+
+	FreeList AcquireBatch(Usize sizeClass)
+	{
+		{
+			CentralList& central = CentralLists()[sizeClass];
+			std::scoped_lock lock(central.Mutex);
+			FreeList batch = PopBatch(central.List, BatchCount(sizeClass));
+			if (batch.Head != nullptr)
+				return batch;
+		}
+
+		return CarveSpan(sizeClass);
+	}
+
+	void* AllocateSlow(Usize sizeClass)
+	{
+		if (CacheExitHook::State() == ThreadExitState::Destroyed)
+		{
+			// 线程缓存已经析构，只从共享链表取出一个块
+			FreeList batch = AcquireBatch(sizeClass);
+			FreeNode* node = batch.Head;
+			batch.Head = node->Next;
+			--batch.Count;
+			ReleaseToCentral(sizeClass, batch);
+			return node;
+		}
+
+		CacheExitHook::Activate();
+
+		FreeList& list = t_cache[sizeClass];
+		list = AcquireBatch(sizeClass);
+
+		FreeNode* node = list.Head;
+		list.Head = node->Next;
+		--list.Count;
+		return node;
+	}
+}
+
+void* PenFramework::PenEngine::Memory::PoolAllocate(Usize bytes)
+{
+	if (bytes > PoolMaxBlockBytes)
+		return ::operator new(bytes);
+
+	Usize sizeClass = PoolSizeClass(bytes);
+	FreeList& list = t_cache[sizeClass];
+	if (FreeNode* node = list.Head)
+	{
+		list.Head = node->Next;
+		--list.Count;
+		return node;
+	}
+
+	return AllocateSlow(sizeClass);
+}
+
+void PenFramework::PenEngine::Memory::PoolDeallocate(void* ptr, Usize bytes) noexcept
+{
+	if (ptr == nullptr)
+		return;
+
+	if (bytes > PoolMaxBlockBytes)
+	{
+		::operator delete(ptr, bytes);
+		return;
+	}
+
+	Usize sizeClass = PoolSizeClass(bytes);
+	FreeNode* node = static_cast<FreeNode*>(ptr);
+
+	ThreadExitState state = CacheExitHook::State();
+	if (state != ThreadExitState::Active)
+	{
+		if (state == ThreadExitState::Destroyed)
+		{
+			// 缓存已经析构的线程直接归还到共享链表
+			node->Next = nullptr;
+			ReleaseToCentral(sizeClass, { node, 1 });
+			return;
+		}
+
+		CacheExitHook::Activate();
+	}
+
+	FreeList& list = t_cache[sizeClass];
+	node->Next = list.Head;
+	list.Head = node;
+	++list.Count;
+
+	// 缓存超过两批时交还一批，避免只释放不分配的线程无限囤积内存
+	Usize batchCount = BatchCount(sizeClass);
+	if (list.Count > 2 * batchCount)
+		ReleaseToCentral(sizeClass, PopBatch(list, batchCount));
+}
+
+void PenFramework::PenEngine::Memory::PoolFlushThreadCache() noexcept
+{
+	for (Usize sizeClass = 0; sizeClass < PoolSizeClassCount; ++sizeClass)
+	{
+		FreeList& list = t_cache[sizeClass];
+		if (list.Head != nullptr)
+			ReleaseToCentral(sizeClass, std::exchange(list, {}));
+	}
+}
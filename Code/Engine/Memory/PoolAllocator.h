@@ -0,0 +1,63 @@
+// File /Engine/Memory/PoolAllocator.h
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+
+// 默认关闭，定义MEMORY_POOL_ALLOCATOR为1后Memory::Allocate/Deallocate的小块请求改为经过按大小分级的内存池
+// 关闭时仍可以直接调用PoolAllocate/PoolDeallocate
+#ifndef MEMORY_POOL_ALLOCATOR
+#define MEMORY_POOL_ALLOCATOR 0
+#endif // MEMORY_POOL_ALLOCATOR
+
+namespace PenFramework::PenEngine::Memory
+{
+	// 池中每个块的对齐，也是大小分级的最小粒度，覆盖BasicString各种字符类型的AllocateMask + 1
+	static constexpr Usize PoolAlignment = 16;
+	// 超过该字节数的请求直接交给全局operator new
+	static constexpr Usize PoolMaxBlockBytes = 1024;
+	// 每次从系统申请、再切分为同一级块的内存大小
+	static constexpr Usize PoolSpanBytes = 64 * 1024;
+
+	namespace Detail
+	{
+		// 256字节以内按16字节分级，之后按64字节分级
+		static constexpr Usize PoolFineClassLimit = 256;
+		static constexpr Usize PoolFineClassCount = PoolFineClassLimit / PoolAlignment;
+		static constexpr Usize PoolCoarseGranularity = 64;
+		static constexpr Usize PoolSizeClassCount = PoolFineClassCount + (PoolMaxBlockBytes - PoolFineClassLimit) / PoolCoarseGranularity;
+
+		constexpr Usize PoolSizeClass(Usize bytes) noexcept
+		{
+			if (bytes <= PoolFineClassLimit)
+				return bytes == 0 ? 0 : (bytes - 1) / PoolAlignment;
+			return PoolFineClassCount + (bytes - PoolFineClassLimit - 1) / PoolCoarseGranularity;
+		}
+
+		constexpr Usize PoolClassBytes(Usize sizeClass) noexcept
+		{
+			if (sizeClass < PoolFineClassCount)
+				return (sizeClass + 1) * PoolAlignment;
+			return PoolFineClassLimit + (sizeClass - PoolFineClassCount + 1) * PoolCoarseGranularity;
+		}
+	}
+
+	// @brief 从当前线程的缓存中分配至少bytes字节，起始地址按PoolAlignment对齐
+	// @note 超过PoolMaxBlockBytes的请求转交给全局operator new
+	void* PoolAllocate(Usize bytes);
+
+	// @brief 归还PoolAllocate得到的内存，bytes必须与分配时相同，可以在任意线程调用
+	// @note 其他线程归还的块进入当前线程的缓存，缓存过多时成批交还给所有线程共享的链表
+	void PoolDeallocate(void* ptr, Usize bytes) noexcept;
+
+	// @brief 将当前线程缓存的块全部交还给共享链表，线程退出时会自动调用
+	void PoolFlushThreadCache() noexcept;
+}
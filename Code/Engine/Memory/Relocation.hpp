@@ -0,0 +1,74 @@
+// File /Engine/Memory/Relocation.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace PenFramework::PenEngine::Memory
+{
+	// @brief 标记T的对象可以按字节搬到新的地址，搬动之后旧地址上的对象视为已经析构，不再调用析构函数
+	// @note 默认只包含平凡复制的类型
+	// @note 对象不保存指向自身或依赖自身地址的指针时，可以在T所在的头文件中特化为std::true_type
+	template <typename T>
+	struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+	template <typename T>
+	inline constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<std::remove_cv_t<T>>::value;
+
+	// @brief 搬动不会抛出异常，可平凡搬动或者移动构造不抛出异常
+	template <typename T>
+	inline constexpr bool IsNothrowRelocatableV = IsTriviallyRelocatableV<T> || std::is_nothrow_move_constructible_v<T>;
+
+	// @brief 把from处的对象搬到未初始化的to，之后from视为未初始化
+	template <typename T>
+	static void Relocate(T* from, T* to) noexcept(IsNothrowRelocatableV<T>)
+	{
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), sizeof(T));
+		}
+		else
+		{
+			std::construct_at(to, std::move(*from));
+			std::destroy_at(from);
+		}
+	}
+
+	// @brief 把[begin, end)中的对象搬到未初始化的to，之后[begin, end)视为未初始化
+	// @note 两段内存不能重叠
+	// @note 移动构造抛出异常时已经搬到to的对象被析构，[begin, end)中的对象保持有效
+	template <typename T>
+	static void RelocateRange(T* begin, T* end, T* to) noexcept(IsNothrowRelocatableV<T>)
+	{
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			if (begin != end)
+				std::memcpy(static_cast<void*>(to), static_cast<const void*>(begin), static_cast<Usize>(end - begin) * sizeof(T));
+		}
+		else
+		{
+			std::uninitialized_move(begin, end, to);
+			std::destroy(begin, end);
+		}
+	}
+
+	// @brief 与RelocateRange相同，但两段内存可以重叠，只用于可平凡搬动的类型
+	// @note 用于在容器中间插入或删除元素时整体平移后面的元素
+	template <typename T> requires IsTriviallyRelocatableV<T>
+	static void RelocateOverlappingRange(T* begin, T* end, T* to) noexcept
+	{
+		if (begin != end)
+			std::memmove(static_cast<void*>(to), static_cast<const void*>(begin), static_cast<Usize>(end - begin) * sizeof(T));
+	}
+}
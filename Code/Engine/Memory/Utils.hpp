@@ -1,7 +1,7 @@
 // File /Engine/Memory/Utils.hpp
 // This file is a part of PenFramework Project
 // https://github.com/PenNineCat/PenFramework
-// 
+//
 // Copyright (C) 2025 - Present PenNineCat. All rights reserved
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
@@ -11,22 +11,487 @@
 #pragma once
 
 #include "../Common/Type.hpp"
+#include "../Utils/Simd.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <memory>
 #include <type_traits>
 
+#if defined(__linux__)
+#include <unistd.h>
+#endif // __linux__
+
+// glibc的memcpy/memmove超过共享缓存的一部分后已经改用非临时存储，并且交错读取多个页，比这里的实现更快
+// 其他C运行库（例如MSVC）不会这样做，大块复制由这里的实现接管
+#if defined(SIMD_SSE2_SUPPORT) && !defined(__GLIBC__)
+#define MEMORY_STREAMING_COPY_SUPPORT 1
+#endif // SIMD_SSE2_SUPPORT && !__GLIBC__
+
+// 按字节数分派的内存原语
+// 小于两个向量的请求用首尾两次可能重叠的读写完成，没有循环与分支预测失败
+// 超过末级缓存的复制与填充使用非临时存储，写入的数据绕过缓存，不会把其他数据挤出缓存
+// 其余大小交给C运行库，它们针对具体的处理器已经有很好的实现
+
 namespace PenFramework::PenEngine
 {
+	namespace Detail
+	{
+		// 无法获取末级缓存大小时使用的阈值
+		static constexpr Usize DefaultNonTemporalThresholdBytes = 8 * 1024 * 1024;
+		// 首尾重叠读写能处理的最大字节数
+		static constexpr Usize SmallMemoryBytes = 2 * Simd::MaxVectorBytes;
+
+		inline constinit std::atomic<Usize> g_nonTemporalThresholdBytes = 0;
+
+		inline Usize DetectLastLevelCacheBytes() noexcept
+		{
+			#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+			// glibc从cpuid中读取，其他C运行库可能返回0或-1
+			for (int name : { _SC_LEVEL3_CACHE_SIZE, _SC_LEVEL2_CACHE_SIZE })
+			{
+				long bytes = sysconf(name);
+				if (bytes > 0)
+					return static_cast<Usize>(bytes);
+			}
+			#endif // __linux__ && _SC_LEVEL3_CACHE_SIZE
+			return DefaultNonTemporalThresholdBytes;
+		}
+	}
+
+	// @brief 不小于该字节数的复制与填充使用非临时存储，第一次调用时取末级缓存的大小
+	inline Usize GetNonTemporalThresholdBytes() noexcept
+	{
+		Usize bytes = Detail::g_nonTemporalThresholdBytes.load(std::memory_order::relaxed);
+		if (bytes == 0)
+		{
+			bytes = Detail::DetectLastLevelCacheBytes();
+			Detail::g_nonTemporalThresholdBytes.store(bytes, std::memory_order::relaxed);
+		}
+		return bytes;
+	}
+
+	// @brief 覆盖自动检测的阈值，传入0则重新检测
+	inline void SetNonTemporalThresholdBytes(Usize bytes) noexcept
+	{
+		Detail::g_nonTemporalThresholdBytes.store(bytes, std::memory_order::relaxed);
+	}
+
+	namespace Detail
+	{
+		template <typename T>
+		T LoadUnaligned(const U8* ptr) noexcept
+		{
+			T v;
+			std::memcpy(&v, ptr, sizeof(T));
+			return v;
+		}
+
+		template <typename T>
+		void StoreUnaligned(U8* ptr, T v) noexcept
+		{
+			std::memcpy(ptr, &v, sizeof(T));
+		}
+
+		// @brief 复制不超过SmallMemoryBytes的字节
+		// @note 先读取全部数据再写入，所以源与目标重叠时也是正确的
+		inline void CopySmallBytes(U8* to, const U8* from, Usize bytes) noexcept
+		{
+			#if defined(SIMD_AVX2_SUPPORT)
+			if (bytes >= 32)
+			{
+				__m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from));
+				__m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + bytes - 32));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(to), head);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(to + bytes - 32), tail);
+				return;
+			}
+			#endif // SIMD_AVX2_SUPPORT
+
+			#if defined(SIMD_SSE2_SUPPORT)
+			if (bytes >= 16)
+			{
+				__m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from));
+				__m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + bytes - 16));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(to), head);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(to + bytes - 16), tail);
+				return;
+			}
+			#endif // SIMD_SSE2_SUPPORT
+
+			if (bytes >= 8)
+			{
+				u64 head = LoadUnaligned<u64>(from);
+				u64 tail = LoadUnaligned<u64>(from + bytes - 8);
+				StoreUnaligned(to, head);
+				StoreUnaligned(to + bytes - 8, tail);
+			}
+			else if (bytes >= 4)
+			{
+				U32 head = LoadUnaligned<U32>(from);
+				U32 tail = LoadUnaligned<U32>(from + bytes - 4);
+				StoreUnaligned(to, head);
+				StoreUnaligned(to + bytes - 4, tail);
+			}
+			else if (bytes >= 2)
+			{
+				U16 head = LoadUnaligned<U16>(from);
+				U16 tail = LoadUnaligned<U16>(from + bytes - 2);
+				StoreUnaligned(to, head);
+				StoreUnaligned(to + bytes - 2, tail);
+			}
+			else if (bytes == 1)
+			{
+				*to = *from;
+			}
+		}
+
+		// @brief 用value填充不超过SmallMemoryBytes的字节
+		inline void SetSmallBytes(U8* to, U8 value, Usize bytes) noexcept
+		{
+			#if defined(SIMD_AVX2_SUPPORT)
+			if (bytes >= 32)
+			{
+				__m256i v = _mm256_set1_epi8(static_cast<char>(value));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(to), v);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(to + bytes - 32), v);
+				return;
+			}
+			#endif // SIMD_AVX2_SUPPORT
+
+			#if defined(SIMD_SSE2_SUPPORT)
+			if (bytes >= 16)
+			{
+				__m128i v = _mm_set1_epi8(static_cast<char>(value));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(to), v);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(to + bytes - 16), v);
+				return;
+			}
+			#endif // SIMD_SSE2_SUPPORT
+
+			u64 v = value * 0x0101010101010101ull;
+			if (bytes >= 8)
+			{
+				StoreUnaligned(to, v);
+				StoreUnaligned(to + bytes - 8, v);
+			}
+			else if (bytes >= 4)
+			{
+				StoreUnaligned(to, static_cast<U32>(v));
+				StoreUnaligned(to + bytes - 4, static_cast<U32>(v));
+			}
+			else if (bytes >= 2)
+			{
+				StoreUnaligned(to, static_cast<U16>(v));
+				StoreUnaligned(to + bytes - 2, static_cast<U16>(v));
+			}
+			else if (bytes == 1)
+			{
+				*to = value;
+			}
+		}
+
+		#if defined(SIMD_SSE2_SUPPORT)
+		#if defined(SIMD_AVX2_SUPPORT)
+		using MemoryVector = __m256i;
+		inline MemoryVector LoadVector(const U8* ptr) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)); }
+		inline void StoreVector(U8* ptr, MemoryVector v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), v); }
+		inline void StreamVector(U8* ptr, MemoryVector v) noexcept { _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr), v); }
+		inline MemoryVector BroadcastVector(U8 value) noexcept { return _mm256_set1_epi8(static_cast<char>(value)); }
+		#else // SIMD_AVX2_SUPPORT
+		using MemoryVector = __m128i;
+		inline MemoryVector LoadVector(const U8* ptr) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr)); }
+		inline void StoreVector(U8* ptr, MemoryVector v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), v); }
+		inline void StreamVector(U8* ptr, MemoryVector v) noexcept { _mm_stream_si128(reinterpret_cast<__m128i*>(ptr), v); }
+		inline MemoryVector BroadcastVector(U8 value) noexcept { return _mm_set1_epi8(static_cast<char>(value)); }
+		#endif // SIMD_AVX2_SUPPORT
+
+		// @brief 不经过缓存复制，bytes至少为SmallMemoryBytes，源与目标不能重叠
+		inline void StreamCopyBytes(U8* to, const U8* from, Usize bytes) noexcept
+		{
+			constexpr Usize vectorBytes = sizeof(MemoryVector);
+			constexpr Usize blockBytes = 4 * vectorBytes;
+
+			// 非临时存储要求目标对齐，开头不对齐的部分用一次普通写入补齐
+			MemoryVector tail = LoadVector(from + bytes - vectorBytes);
+			StoreVector(to, LoadVector(from));
+			Usize head = vectorBytes - (reinterpret_cast<uintptr_t>(to) & (vectorBytes - 1));
+			to += head;
+			from += head;
+			bytes -= head;
+
+			for (; bytes >= blockBytes; bytes -= blockBytes, to += blockBytes, from += blockBytes)
+			{
+				MemoryVector v0 = LoadVector(from);
+				MemoryVector v1 = LoadVector(from + vectorBytes);
+				MemoryVector v2 = LoadVector(from + 2 * vectorBytes);
+				MemoryVector v3 = LoadVector(from + 3 * vectorBytes);
+				StreamVector(to, v0);
+				StreamVector(to + vectorBytes, v1);
+				StreamVector(to + 2 * vectorBytes, v2);
+				StreamVector(to + 3 * vectorBytes, v3);
+			}
+			for (; bytes >= vectorBytes; bytes -= vectorBytes, to += vectorBytes, from += vectorBytes)
+				StreamVector(to, LoadVector(from));
+
+			// 非临时存储是弱序的，之后的普通写入与其他线程的读取都需要先经过屏障
+			_mm_sfence();
+			if (bytes != 0)
+				StoreVector(to + bytes - vectorBytes, tail);
+		}
+
+		// @brief 不经过缓存填充，bytes至少为SmallMemoryBytes
+		inline void StreamSetBytes(U8* to, U8 value, Usize bytes) noexcept
+		{
+			constexpr Usize vectorBytes = sizeof(MemoryVector);
+			constexpr Usize blockBytes = 4 * vectorBytes;
+
+			MemoryVector v = BroadcastVector(value);
+			StoreVector(to, v);
+			Usize head = vectorBytes - (reinterpret_cast<uintptr_t>(to) & (vectorBytes - 1));
+			to += head;
+			bytes -= head;
+
+			for (; bytes >= blockBytes; bytes -= blockBytes, to += blockBytes)
+			{
+				StreamVector(to, v);
+				StreamVector(to + vectorBytes, v);
+				StreamVector(to + 2 * vectorBytes, v);
+				StreamVector(to + 3 * vectorBytes, v);
+			}
+			for (; bytes >= vectorBytes; bytes -= vectorBytes, to += vectorBytes)
+				StreamVector(to, v);
+
+			_mm_sfence();
+			if (bytes != 0)
+				StoreVector(to + bytes - vectorBytes, v);
+		}
+		#endif // SIMD_SSE2_SUPPORT
+
+		inline void CopyBytes(U8* to, const U8* from, Usize bytes) noexcept
+		{
+			if (bytes <= SmallMemoryBytes)
+			{
+				CopySmallBytes(to, from, bytes);
+				return;
+			}
+
+			#if defined(SIMD_AVX2_SUPPORT)
+			// 几个向量长的复制在调用memcpy之前就能完成
+			if (bytes <= 4 * Simd::MaxVectorBytes)
+			{
+				for (Usize offset = 0; offset + 32 < bytes; offset += 32)
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(to + offset), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + offset)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(to + bytes - 32), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + bytes - 32)));
+				return;
+			}
+			#endif // SIMD_AVX2_SUPPORT
+
+			#if defined(MEMORY_STREAMING_COPY_SUPPORT)
+			if (bytes >= GetNonTemporalThresholdBytes())
+			{
+				StreamCopyBytes(to, from, bytes);
+				return;
+			}
+			#endif // MEMORY_STREAMING_COPY_SUPPORT
+
+			std::memcpy(to, from, bytes);
+		}
+
+		inline void MoveBytes(U8* to, const U8* from, Usize bytes) noexcept
+		{
+			if (bytes <= SmallMemoryBytes)
+			{
+				CopySmallBytes(to, from, bytes);
+				return;
+			}
+
+			#if defined(MEMORY_STREAMING_COPY_SUPPORT)
+			// 不重叠时与复制相同
+			if (bytes >= GetNonTemporalThresholdBytes() && (to + bytes <= from || from + bytes <= to))
+			{
+				StreamCopyBytes(to, from, bytes);
+				return;
+			}
+			#endif // MEMORY_STREAMING_COPY_SUPPORT
+
+			std::memmove(to, from, bytes);
+		}
+
+		inline void SetBytes(U8* to, U8 value, Usize bytes) noexcept
+		{
+			if (bytes <= SmallMemoryBytes)
+			{
+				SetSmallBytes(to, value, bytes);
+				return;
+			}
+
+			#if defined(SIMD_SSE2_SUPPORT)
+			if (bytes >= GetNonTemporalThresholdBytes())
+			{
+				StreamSetBytes(to, value, bytes);
+				return;
+			}
+			#endif // SIMD_SSE2_SUPPORT
+
+			std::memset(to, value, bytes);
+		}
+
+		// @brief 返回按字节比较的结果，diff中每个不同的字节置位一个比特，不能为0
+		inline int CompareAtFirstDifference(const U8* lhs, const U8* rhs, U32 diff) noexcept
+		{
+			Usize index = static_cast<Usize>(std::countr_zero(diff));
+			return static_cast<int>(lhs[index]) - static_cast<int>(rhs[index]);
+		}
+
+		// @brief 返回按字节比较的结果，diff为两边的异或，不能为0
+		// @note 小端下异或结果最低的非零字节就是内存中第一个不同的字节
+		template <typename T>
+		int CompareAtFirstDifferentWord(const U8* lhs, const U8* rhs, T diff) noexcept
+		{
+			Usize index = static_cast<Usize>(std::countr_zero(diff)) / BitsPerBytes;
+			return static_cast<int>(lhs[index]) - static_cast<int>(rhs[index]);
+		}
+
+		// @brief 按无符号字节比较不超过SmallMemoryBytes的字节，与memcmp的符号相同
+		inline int CompareSmallBytes(const U8* lhs, const U8* rhs, Usize bytes) noexcept
+		{
+			#if defined(SIMD_AVX2_SUPPORT)
+			if (bytes >= 32)
+			{
+				U32 head = ~static_cast<U32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs)))));
+				if (head != 0)
+					return CompareAtFirstDifference(lhs, rhs, head);
+				Usize tailOffset = bytes - 32;
+				U32 tail = ~static_cast<U32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + tailOffset)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + tailOffset)))));
+				return tail == 0 ? 0 : CompareAtFirstDifference(lhs + tailOffset, rhs + tailOffset, tail);
+			}
+			#endif // SIMD_AVX2_SUPPORT
+
+			#if defined(SIMD_SSE2_SUPPORT)
+			if (bytes >= 16)
+			{
+				U32 head = ~static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs))))) & 0xFFFF;
+				if (head != 0)
+					return CompareAtFirstDifference(lhs, rhs, head);
+				Usize tailOffset = bytes - 16;
+				U32 tail = ~static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + tailOffset)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + tailOffset))))) & 0xFFFF;
+				return tail == 0 ? 0 : CompareAtFirstDifference(lhs + tailOffset, rhs + tailOffset, tail);
+			}
+			#endif // SIMD_SSE2_SUPPORT
+
+			if (bytes >= 8)
+			{
+				if (u64 head = LoadUnaligned<u64>(lhs) ^ LoadUnaligned<u64>(rhs); head != 0)
+					return CompareAtFirstDifferentWord(lhs, rhs, head);
+				Usize tailOffset = bytes - 8;
+				u64 tail = LoadUnaligned<u64>(lhs + tailOffset) ^ LoadUnaligned<u64>(rhs + tailOffset);
+				return tail == 0 ? 0 : CompareAtFirstDifferentWord(lhs + tailOffset, rhs + tailOffset, tail);
+			}
+			if (bytes >= 4)
+			{
+				if (U32 head = LoadUnaligned<U32>(lhs) ^ LoadUnaligned<U32>(rhs); head != 0)
+					return CompareAtFirstDifferentWord(lhs, rhs, head);
+				Usize tailOffset = bytes - 4;
+				U32 tail = LoadUnaligned<U32>(lhs + tailOffset) ^ LoadUnaligned<U32>(rhs + tailOffset);
+				return tail == 0 ? 0 : CompareAtFirstDifferentWord(lhs + tailOffset, rhs + tailOffset, tail);
+			}
+			for (Usize i = 0; i < bytes; ++i)
+			{
+				if (lhs[i] != rhs[i])
+					return static_cast<int>(lhs[i]) - static_cast<int>(rhs[i]);
+			}
+			return 0;
+		}
+
+		inline int CompareBytes(const U8* lhs, const U8* rhs, Usize bytes) noexcept
+		{
+			if (bytes <= SmallMemoryBytes)
+				return CompareSmallBytes(lhs, rhs, bytes);
+			return std::memcmp(lhs, rhs, bytes);
+		}
+	}
+
+	// @brief 从from复制count个元素到to，两者不能重叠
 	template <typename T> requires std::is_trivially_copyable_v<T>
-	constexpr T* MemoryCopy(const T* from, T* to, usize bytes) noexcept
+	constexpr T* MemoryCopy(const T* from, T* to, Usize count) noexcept
 	{
 		if consteval
 		{
-			for (usize i = 0; i < bytes; ++i)
-			{
+			for (Usize i = 0; i < count; ++i)
 				to[i] = from[i];
-			}
 			return to;
 		}
 
-		return static_cast<T*>(memcpy(to, from, bytes));
+		Detail::CopyBytes(reinterpret_cast<U8*>(to), reinterpret_cast<const U8*>(from), count * sizeof(T));
+		return to;
+	}
+
+	// @brief 从from复制count个元素到to，两者可以重叠
+	template <typename T> requires std::is_trivially_copyable_v<T>
+	constexpr T* MemoryMove(const T* from, T* to, Usize count) noexcept
+	{
+		if consteval
+		{
+			// 常量求值中不能比较不相关的指针，所以先复制到临时存储
+			std::allocator<T> allocator;
+			T* temp = allocator.allocate(count);
+			for (Usize i = 0; i < count; ++i)
+				std::construct_at(temp + i, from[i]);
+			for (Usize i = 0; i < count; ++i)
+				to[i] = temp[i];
+			std::destroy_n(temp, count);
+			allocator.deallocate(temp, count);
+			return to;
+		}
+
+		Detail::MoveBytes(reinterpret_cast<U8*>(to), reinterpret_cast<const U8*>(from), count * sizeof(T));
+		return to;
+	}
+
+	// @brief 将to开始的count个元素设为value
+	// @note value的所有字节都相同时按字节填充，否则逐个赋值
+	template <typename T> requires std::is_trivially_copyable_v<T>
+	constexpr T* MemorySet(T* to, const T& value, Usize count) noexcept
+	{
+		if consteval
+		{
+			for (Usize i = 0; i < count; ++i)
+				to[i] = value;
+			return to;
+		}
+
+		std::array<U8, sizeof(T)> bytes;
+		std::memcpy(bytes.data(), &value, sizeof(T));
+		if (std::ranges::all_of(bytes, [&](U8 b) { return b == bytes[0]; }))
+			Detail::SetBytes(reinterpret_cast<U8*>(to), bytes[0], count * sizeof(T));
+		else
+			std::fill_n(to, count, value);
+		return to;
+	}
+
+	// @brief 按字节比较lhs与rhs的前count个元素，返回值的符号与memcmp相同
+	// @note 多字节的元素按内存中的字节序比较，结果只适合判断相等或作为一种确定的顺序，不等同于按数值比较
+	template <typename T> requires std::is_trivially_copyable_v<T>
+	constexpr int MemoryCompare(const T* lhs, const T* rhs, Usize count) noexcept
+	{
+		if consteval
+		{
+			for (Usize i = 0; i < count; ++i)
+			{
+				auto l = std::bit_cast<std::array<U8, sizeof(T)>>(lhs[i]);
+				auto r = std::bit_cast<std::array<U8, sizeof(T)>>(rhs[i]);
+				for (Usize j = 0; j < sizeof(T); ++j)
+				{
+					if (l[j] != r[j])
+						return static_cast<int>(l[j]) - static_cast<int>(r[j]);
+				}
+			}
+			return 0;
+		}
+
+		return Detail::CompareBytes(reinterpret_cast<const U8*>(lhs), reinterpret_cast<const U8*>(rhs), count * sizeof(T));
 	}
 }
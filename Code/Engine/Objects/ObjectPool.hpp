@@ -0,0 +1,267 @@
+// File /Engine/Objects/ObjectPool.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Memory/Memory.hpp"
+#include "PObject.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace PenFramework::PenEngine
+{
+	// 对象按块连续存放，块分配后不再移动，对象的地址在销毁前保持不变
+	// 销毁后的位置进入空闲链表，之后创建的对象优先复用，复用时代数增加，旧的ObjectID随之失效
+	// Create与Destroy可以在多个线程中同时调用，空闲链表无锁，只有分配新块时加锁
+	// 对象的构造与析构不持有锁，构造函数中可以继续创建对象
+	// Get不加锁，调用方需要保证使用对象期间它没有在其他线程中被销毁
+	template <typename T>
+	class ObjectPool
+	{
+		static_assert(std::is_base_of_v<PObject, T>, "ObjectPool only stores PObject-derived objects");
+	public:
+		static constexpr U32 ChunkCapacity = 1024;
+		static constexpr U32 MaxChunkCount = 4096;
+
+		ObjectPool();
+		ObjectPool(const ObjectPool&) = delete;
+		ObjectPool& operator=(const ObjectPool&) = delete;
+		~ObjectPool();
+
+		// @brief 构造一个对象并返回它的ID
+		// @note 对象数超过ChunkCapacity * MaxChunkCount时抛出std::bad_alloc
+		template <typename... Args>
+		ObjectID Create(Args&&... args);
+
+		// @brief 析构id对应的对象，id已经失效时返回false
+		bool Destroy(ObjectID id);
+
+		// @brief O(1)地查找id对应的对象，id已经失效时返回nullptr
+		T* Get(ObjectID id) const noexcept;
+		bool Contains(ObjectID id) const noexcept;
+
+		// @brief 按存放顺序遍历所有对象
+		// @note 不与其他线程中的Destroy同步，遍历期间只能在当前线程中创建或销毁对象
+		template <typename Func>
+		void ForEach(Func&& func);
+
+		Usize Size() const noexcept;
+		Usize Capacity() const noexcept;
+	private:
+		static constexpr U32 NoFreeSlot = ~U32(0);
+
+		struct Chunk
+		{
+			// 奇数表示该位置上有对象
+			std::atomic<U32> Generations[ChunkCapacity];
+			std::atomic<U32> NextFree[ChunkCapacity];
+			alignas(T) std::byte Storage[ChunkCapacity * sizeof(T)];
+		};
+
+		Chunk* GetChunk(U32 index) const noexcept;
+		static T* GetSlotObject(Chunk* chunk, U32 index) noexcept;
+
+		// 空闲链表头的低32位为下标，高32位在每次修改时加一，避免ABA问题
+		static constexpr u64 MakeFreeHead(U32 index, u64 oldHead) noexcept { return ((oldHead >> 32) + 1) << 32 | index; }
+
+		U32 AcquireSlot();
+		void ReleaseSlot(U32 index) noexcept;
+
+		std::mutex m_mutex;
+		std::atomic<Chunk*>* m_chunks;
+		// 曾经使用过的位置数，空闲链表为空时从这里取新位置
+		std::atomic<U32> m_slotCount = 0;
+		std::atomic<u64> m_freeHead = NoFreeSlot;
+		std::atomic<Usize> m_size = 0;
+	};
+
+	template <typename T>
+	ObjectPool<T>::ObjectPool() : m_chunks(Memory::Allocate<std::atomic<Chunk*>>(MaxChunkCount, Memory::MemoryTag::Object))
+	{
+		std::uninitialized_fill_n(m_chunks, MaxChunkCount, nullptr);
+	}
+
+	template <typename T>
+	ObjectPool<T>::~ObjectPool()
+	{
+		U32 slotCount = m_slotCount.load(std::memory_order::relaxed);
+		for (U32 i = 0; i < slotCount; i += ChunkCapacity)
+		{
+			Chunk* chunk = GetChunk(i);
+			for (U32 slot = 0; slot < ChunkCapacity; ++slot)
+			{
+				if (chunk->Generations[slot].load(std::memory_order::relaxed) & 1)
+					Memory::Destroy(GetSlotObject(chunk, slot));
+			}
+			Memory::Destroy(chunk);
+			Memory::Deallocate(chunk, 1, Memory::MemoryTag::Object);
+		}
+		Memory::Deallocate(m_chunks, MaxChunkCount, Memory::MemoryTag::Object);
+	}
+
+	template <typename T>
+	template <typename... Args>
+	ObjectID ObjectPool<T>::Create(Args&&... args)
+	{
+		U32 index = AcquireSlot();
+		Chunk* chunk = GetChunk(index);
+		U32 slot = index % ChunkCapacity;
+
+		T* object;
+		try
+		{
+			object = std::construct_at(GetSlotObject(chunk, slot), std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			ReleaseSlot(index);
+			throw;
+		}
+
+		U32 generation = chunk->Generations[slot].load(std::memory_order::relaxed) + 1;
+		ObjectID id = MakeObjectID(index, generation);
+		object->m_objectID = id;
+		m_size.fetch_add(1, std::memory_order::relaxed);
+		// 发布之后其他线程的Get才能看到构造完成的对象
+		chunk->Generations[slot].store(generation, std::memory_order::release);
+		return id;
+	}
+
+	template <typename T>
+	bool ObjectPool<T>::Destroy(ObjectID id)
+	{
+		U32 index = GetObjectIndex(id);
+		U32 generation = GetObjectGeneration(id);
+		if (index >= m_slotCount.load(std::memory_order::acquire) || (generation & 1) == 0)
+			return false;
+
+		Chunk* chunk = GetChunk(index);
+		U32 slot = index % ChunkCapacity;
+		// 只有一个线程能把代数从奇数改为偶数，同一个ID的重复销毁在这里失败
+		if (!chunk->Generations[slot].compare_exchange_strong(generation, generation + 1, std::memory_order::acq_rel))
+			return false;
+
+		m_size.fetch_sub(1, std::memory_order::relaxed);
+		Memory::Destroy(GetSlotObject(chunk, slot));
+		ReleaseSlot(index);
+		return true;
+	}
+
+	template <typename T>
+	T* ObjectPool<T>::Get(ObjectID id) const noexcept
+	{
+		U32 index = GetObjectIndex(id);
+		U32 generation = GetObjectGeneration(id);
+		if (index / ChunkCapacity >= MaxChunkCount || (generation & 1) == 0)
+			return nullptr;
+
+		Chunk* chunk = m_chunks[index / ChunkCapacity].load(std::memory_order::acquire);
+		if (chunk == nullptr)
+			return nullptr;
+
+		U32 slot = index % ChunkCapacity;
+		if (chunk->Generations[slot].load(std::memory_order::acquire) != generation)
+			return nullptr;
+		return GetSlotObject(chunk, slot);
+	}
+
+	template <typename T>
+	bool ObjectPool<T>::Contains(ObjectID id) const noexcept
+	{
+		return Get(id) != nullptr;
+	}
+
+	template <typename T>
+	template <typename Func>
+	void ObjectPool<T>::ForEach(Func&& func)
+	{
+		U32 slotCount = m_slotCount.load(std::memory_order::acquire);
+		for (U32 i = 0; i < slotCount; i += ChunkCapacity)
+		{
+			Chunk* chunk = GetChunk(i);
+			U32 end = std::min(slotCount - i, ChunkCapacity);
+			for (U32 slot = 0; slot < end; ++slot)
+			{
+				if (chunk->Generations[slot].load(std::memory_order::acquire) & 1)
+					func(*GetSlotObject(chunk, slot));
+			}
+		}
+	}
+
+	template <typename T>
+	Usize ObjectPool<T>::Size() const noexcept
+	{
+		return m_size.load(std::memory_order::relaxed);
+	}
+
+	template <typename T>
+	Usize ObjectPool<T>::Capacity() const noexcept
+	{
+		U32 slotCount = m_slotCount.load(std::memory_order::relaxed);
+		return (static_cast<Usize>(slotCount) + ChunkCapacity - 1) / ChunkCapacity * ChunkCapacity;
+	}
+
+	template <typename T>
+	typename ObjectPool<T>::Chunk* ObjectPool<T>::GetChunk(U32 index) const noexcept
+	{
+		return m_chunks[index / ChunkCapacity].load(std::memory_order::acquire);
+	}
+
+	template <typename T>
+	T* ObjectPool<T>::GetSlotObject(Chunk* chunk, U32 index) noexcept
+	{
+		return reinterpret_cast<T*>(chunk->Storage) + index;
+	}
+
+	template <typename T>
+	U32 ObjectPool<T>::AcquireSlot()
+	{
+		u64 head = m_freeHead.load(std::memory_order::acquire);
+		while (static_cast<U32>(head) != NoFreeSlot)
+		{
+			// 读到的下一项可能已经过期，此时链表头的计数也已经改变，下面的交换会失败
+			U32 index = static_cast<U32>(head);
+			U32 next = GetChunk(index)->NextFree[index % ChunkCapacity].load(std::memory_order::relaxed);
+			if (m_freeHead.compare_exchange_weak(head, MakeFreeHead(next, head), std::memory_order::acquire, std::memory_order::acquire))
+				return index;
+		}
+
+		std::scoped_lock lock(m_mutex);
+		U32 index = m_slotCount.load(std::memory_order::relaxed);
+		if (index % ChunkCapacity == 0)
+		{
+			if (index / ChunkCapacity >= MaxChunkCount)
+				throw std::bad_alloc();
+
+			// 默认初始化，只清零代数，不清零对象的存储
+			Chunk* chunk = new (Memory::Allocate<Chunk>(1, Memory::MemoryTag::Object)) Chunk;
+			m_chunks[index / ChunkCapacity].store(chunk, std::memory_order::release);
+		}
+		m_slotCount.store(index + 1, std::memory_order::release);
+		return index;
+	}
+
+	template <typename T>
+	void ObjectPool<T>::ReleaseSlot(U32 index) noexcept
+	{
+		std::atomic<U32>& next = GetChunk(index)->NextFree[index % ChunkCapacity];
+		u64 head = m_freeHead.load(std::memory_order::relaxed);
+		do
+		{
+			next.store(static_cast<U32>(head), std::memory_order::relaxed);
+		}
+		while (!m_freeHead.compare_exchange_weak(head, MakeFreeHead(index, head), std::memory_order::release, std::memory_order::relaxed));
+	}
+}
@@ -29,11 +29,36 @@ namespace PenFramework::PenEngine
 	using ResourceID = u64;
 	using ObjectID = u64;
 
+	// ObjectID的低32位为对象在ObjectPool中的下标，高32位为该位置的代数
+	// 有对象的位置代数总是奇数，所以InvalidObjectID不会是任何对象的ID
+	static constexpr ObjectID InvalidObjectID = 0;
+
+	constexpr ObjectID MakeObjectID(U32 index, U32 generation) noexcept
+	{
+		return static_cast<ObjectID>(generation) << 32 | index;
+	}
+
+	constexpr U32 GetObjectIndex(ObjectID id) noexcept
+	{
+		return static_cast<U32>(id);
+	}
+
+	constexpr U32 GetObjectGeneration(ObjectID id) noexcept
+	{
+		return static_cast<U32>(id >> 32);
+	}
+
+	template <typename T>
+	class ObjectPool;
+
 	class PObject
 	{
 	public:
 		virtual ~PObject() = default;
 
+		// @brief 由ObjectPool在创建时分配，不在池中的对象为InvalidObjectID
+		ObjectID GetObjectID() const noexcept { return m_objectID; }
+
 		//元数据
 		virtual StringView GetMetaType() const noexcept = 0;
 		virtual Usize GetMetaHash() const noexcept = 0;
@@ -50,7 +75,10 @@ namespace PenFramework::PenEngine
 		std::expected<T,TryGetPropertyError> TryGetProperty(StringView propertyName);
 		void SetProperty(StringView propertyName,const std::any& property);
 	private:
-		ObjectID m_objectID = 0;
+		template <typename T>
+		friend class ObjectPool;
+
+		ObjectID m_objectID = InvalidObjectID;
 
 		StringUnorderedMap<std::any> m_properties;
 	};
@@ -0,0 +1,737 @@
+// File /Engine/String/BinaryCodec.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Exception/InvalidArgument.hpp"
+#include "../IO/IInputStream.h"
+#include "../IO/IOutputStream.h"
+#include "../Utils/Simd.hpp"
+#include "String.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <span>
+#include <vector>
+
+// Base64（RFC 4648标准字母表，带填充）与十六进制编解码
+// 编码结果是纯ASCII文本，因此只提供Ch版本；解码结果按字节写入调用方缓冲区或String
+// 所有接口都会先计算精确的输出长度，写入String时只会分配一次
+
+namespace PenFramework::PenEngine
+{
+	enum class HexCase : U8
+	{
+		Lower,
+		Upper
+	};
+
+	namespace Detail
+	{
+		static constexpr Ch Base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+		static constexpr Ch HexLowerAlphabet[] = "0123456789abcdef";
+		static constexpr Ch HexUpperAlphabet[] = "0123456789ABCDEF";
+
+		static constexpr U8 InvalidCodecValue = 0xFF;
+
+		static constexpr std::array<U8, 256> Base64DecodeTable = []
+			{
+				std::array<U8, 256> table{};
+				table.fill(InvalidCodecValue);
+				for (U8 i = 0; i < 64; ++i)
+					table[static_cast<U8>(Base64Alphabet[i])] = i;
+				return table;
+			}();
+
+		static constexpr std::array<U8, 256> HexDecodeTable = []
+			{
+				std::array<U8, 256> table{};
+				table.fill(InvalidCodecValue);
+				for (U8 i = 0; i < 16; ++i)
+				{
+					table[static_cast<U8>(HexLowerAlphabet[i])] = i;
+					table[static_cast<U8>(HexUpperAlphabet[i])] = i;
+				}
+				return table;
+			}();
+
+		[[noreturn]] inline void ThrowInvalidBase64(std::string_view detail)
+		{
+			throw InvalidArgument("Base64", "Function Base64Decode", detail);
+		}
+
+		[[noreturn]] inline void ThrowInvalidHex(std::string_view detail)
+		{
+			throw InvalidArgument("Hex", "Function HexDecode", detail);
+		}
+
+		#ifdef SIMD_SSSE3_SUPPORT
+		// 将12字节拆分为16个6位索引，每个32位通道对应一组3字节
+		inline __m128i Base64Split(__m128i in) noexcept
+		{
+			in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+			__m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+			__m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+			return _mm_or_si128(t0, t1);
+		}
+
+		// 6位索引映射为字母表字符：先把索引归类到5个区间，再查表得到与字符的差值
+		inline __m128i Base64Translate(__m128i indices) noexcept
+		{
+			__m128i category = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+			category = _mm_or_si128(category, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+			const __m128i shift = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+			return _mm_add_epi8(_mm_shuffle_epi8(shift, category), indices);
+		}
+
+		// 字符映射回6位值，遇到非法字符时返回false
+		inline bool Base64Values(__m128i in, __m128i& values) noexcept
+		{
+			const __m128i lowTable = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+			const __m128i highTable = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+			const __m128i rollTable = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+			const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+
+			__m128i highNibble = _mm_and_si128(_mm_srli_epi32(in, 4), nibbleMask);
+			__m128i lowNibble = _mm_and_si128(in, nibbleMask);
+			__m128i invalid = _mm_and_si128(_mm_shuffle_epi8(lowTable, lowNibble), _mm_shuffle_epi8(highTable, highNibble));
+			if (_mm_movemask_epi8(_mm_cmpgt_epi8(invalid, _mm_setzero_si128())) != 0)
+				return false;
+
+			__m128i roll = _mm_shuffle_epi8(rollTable, _mm_add_epi8(_mm_cmpeq_epi8(in, _mm_set1_epi8('/')), highNibble));
+			values = _mm_add_epi8(in, roll);
+			return true;
+		}
+
+		// 16个6位值合并为12字节，位于结果的低12字节
+		inline __m128i Base64Pack(__m128i values) noexcept
+		{
+			__m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+			merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+			return _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		}
+
+		// 16个字符转换为半字节值，(c - '0')或((c | 0x20) - 'a')落在合法区间内即为合法字符
+		inline bool HexValues(__m128i in, __m128i& values) noexcept
+		{
+			__m128i digit = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+			__m128i digitValid = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+			__m128i letter = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+			__m128i letterValid = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+
+			if (_mm_movemask_epi8(_mm_or_si128(digitValid, letterValid)) != 0xFFFF)
+				return false;
+
+			values = _mm_or_si128(_mm_and_si128(digitValid, digit), _mm_and_si128(letterValid, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+			return true;
+		}
+		#endif // SIMD_SSSE3_SUPPORT
+
+		#ifdef SIMD_AVX2_SUPPORT
+		inline __m256i Base64Split(__m256i in) noexcept
+		{
+			in = _mm256_shuffle_epi8(in, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1, 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+			__m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+			__m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+			return _mm256_or_si256(t0, t1);
+		}
+
+		inline __m256i Base64Translate(__m256i indices) noexcept
+		{
+			__m256i category = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+			category = _mm256_or_si256(category, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+			const __m256i shift = _mm256_broadcastsi128_si256(_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0));
+			return _mm256_add_epi8(_mm256_shuffle_epi8(shift, category), indices);
+		}
+
+		inline bool Base64Values(__m256i in, __m256i& values) noexcept
+		{
+			const __m256i lowTable = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A));
+			const __m256i highTable = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10));
+			const __m256i rollTable = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0));
+			const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+
+			__m256i highNibble = _mm256_and_si256(_mm256_srli_epi32(in, 4), nibbleMask);
+			__m256i lowNibble = _mm256_and_si256(in, nibbleMask);
+			__m256i invalid = _mm256_and_si256(_mm256_shuffle_epi8(lowTable, lowNibble), _mm256_shuffle_epi8(highTable, highNibble));
+			if (_mm256_movemask_epi8(_mm256_cmpgt_epi8(invalid, _mm256_setzero_si256())) != 0)
+				return false;
+
+			__m256i roll = _mm256_shuffle_epi8(rollTable, _mm256_add_epi8(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('/')), highNibble));
+			values = _mm256_add_epi8(in, roll);
+			return true;
+		}
+
+		// 32个6位值合并为24字节，位于结果的低24字节
+		inline __m256i Base64Pack(__m256i values) noexcept
+		{
+			__m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+			merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+			merged = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+			return _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+		}
+
+		inline bool HexValues(__m256i in, __m256i& values) noexcept
+		{
+			__m256i digit = _mm256_sub_epi8(in, _mm256_set1_epi8('0'));
+			__m256i digitValid = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+			__m256i letter = _mm256_sub_epi8(_mm256_or_si256(in, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+			__m256i letterValid = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+
+			if (_mm256_movemask_epi8(_mm256_or_si256(digitValid, letterValid)) != -1)
+				return false;
+
+			values = _mm256_or_si256(_mm256_and_si256(digitValid, digit), _mm256_and_si256(letterValid, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+			return true;
+		}
+		#endif // SIMD_AVX2_SUPPORT
+
+		// @brief 编码所有完整的3字节组
+		// @retval 已处理的输入字节数，为3的倍数
+		inline Usize Base64EncodeBlocks(const B8* data, Usize size, Ch* out) noexcept
+		{
+			Usize i = 0;
+			Ch* o = out;
+
+			#ifdef SIMD_AVX2_SUPPORT
+			// 每次读取28字节，使用其中24字节
+			for (; i + 28 <= size; i += 24, o += 32)
+			{
+				__m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				__m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 12));
+				__m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(o), Base64Translate(Base64Split(in)));
+			}
+			#endif // SIMD_AVX2_SUPPORT
+
+			#ifdef SIMD_SSSE3_SUPPORT
+			for (; i + 16 <= size; i += 12, o += 16)
+			{
+				__m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(o), Base64Translate(Base64Split(in)));
+			}
+			#endif // SIMD_SSSE3_SUPPORT
+
+			for (; i + 3 <= size; i += 3, o += 4)
+			{
+				U32 v = static_cast<U32>(data[i]) << 16 | static_cast<U32>(data[i + 1]) << 8 | data[i + 2];
+				o[0] = Base64Alphabet[v >> 18];
+				o[1] = Base64Alphabet[(v >> 12) & 0x3F];
+				o[2] = Base64Alphabet[(v >> 6) & 0x3F];
+				o[3] = Base64Alphabet[v & 0x3F];
+			}
+
+			return i;
+		}
+
+		// @brief 编码不足3字节的尾部并写入填充
+		inline void Base64EncodeTail(const B8* data, Usize size, Ch* out) noexcept
+		{
+			if (size == 0)
+				return;
+
+			U32 v = static_cast<U32>(data[0]) << 16 | (size == 2 ? static_cast<U32>(data[1]) << 8 : 0);
+			out[0] = Base64Alphabet[v >> 18];
+			out[1] = Base64Alphabet[(v >> 12) & 0x3F];
+			out[2] = size == 2 ? Base64Alphabet[(v >> 6) & 0x3F] : '=';
+			out[3] = '=';
+		}
+
+		// @brief 解码quadCount个不含填充的4字符组
+		// @retval 遇到非法字符时返回false
+		inline bool Base64DecodeBlocks(const Ch* src, Usize quadCount, B8* out) noexcept
+		{
+			Usize length = quadCount * 4;
+			Usize outLength = quadCount * 3;
+			Usize i = 0;
+			Usize o = 0;
+
+			// 向量路径每次会多写入4字节，需要保证输出缓冲区仍有余量
+			#ifdef SIMD_AVX2_SUPPORT
+			for (; i + 32 <= length && o + 32 <= outLength; i += 32, o += 24)
+			{
+				__m256i values;
+				if (!Base64Values(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), values))
+					return false;
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + o), Base64Pack(values));
+			}
+			#endif // SIMD_AVX2_SUPPORT
+
+			#ifdef SIMD_SSSE3_SUPPORT
+			for (; i + 16 <= length && o + 16 <= outLength; i += 16, o += 12)
+			{
+				__m128i values;
+				if (!Base64Values(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), values))
+					return false;
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + o), Base64Pack(values));
+			}
+			#endif // SIMD_SSSE3_SUPPORT
+
+			for (; i < length; i += 4, o += 3)
+			{
+				U8 a = Base64DecodeTable[static_cast<U8>(src[i])];
+				U8 b = Base64DecodeTable[static_cast<U8>(src[i + 1])];
+				U8 c = Base64DecodeTable[static_cast<U8>(src[i + 2])];
+				U8 d = Base64DecodeTable[static_cast<U8>(src[i + 3])];
+				if (((a | b | c | d) & 0xC0) != 0)
+					return false;
+
+				U32 v = static_cast<U32>(a) << 18 | static_cast<U32>(b) << 12 | static_cast<U32>(c) << 6 | d;
+				out[o] = static_cast<B8>(v >> 16);
+				out[o + 1] = static_cast<B8>(v >> 8);
+				out[o + 2] = static_cast<B8>(v);
+			}
+
+			return true;
+		}
+
+		// @brief 解码最后一个可能带填充的4字符组
+		// @retval 写入的字节数
+		inline Usize Base64DecodeFinalQuad(const Ch* src, B8* out)
+		{
+			Usize padding = src[3] == '=' ? (src[2] == '=' ? 2 : 1) : 0;
+			U8 a = Base64DecodeTable[static_cast<U8>(src[0])];
+			U8 b = Base64DecodeTable[static_cast<U8>(src[1])];
+			U8 c = padding == 2 ? 0 : Base64DecodeTable[static_cast<U8>(src[2])];
+			U8 d = padding != 0 ? 0 : Base64DecodeTable[static_cast<U8>(src[3])];
+			if (((a | b | c | d) & 0xC0) != 0)
+				ThrowInvalidBase64("invalid base64 character");
+
+			U32 v = static_cast<U32>(a) << 18 | static_cast<U32>(b) << 12 | static_cast<U32>(c) << 6 | d;
+			out[0] = static_cast<B8>(v >> 16);
+			if (padding < 2)
+				out[1] = static_cast<B8>(v >> 8);
+			if (padding < 1)
+				out[2] = static_cast<B8>(v);
+
+			return 3 - padding;
+		}
+
+		inline void HexEncodeBlocks(const B8* data, Usize size, Ch* out, HexCase letterCase) noexcept
+		{
+			const Ch* alphabet = letterCase == HexCase::Lower ? HexLowerAlphabet : HexUpperAlphabet;
+			Usize i = 0;
+
+			#ifdef SIMD_AVX2_SUPPORT
+			{
+				const __m256i table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet)));
+				const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+
+				for (; i + 32 <= size; i += 32)
+				{
+					__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+					__m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibbleMask));
+					__m256i low = _mm256_shuffle_epi8(table, _mm256_and_si256(v, nibbleMask));
+					// unpack只在128位通道内交错，需要重新拼接通道
+					__m256i first = _mm256_unpacklo_epi8(high, low);
+					__m256i second = _mm256_unpackhi_epi8(high, low);
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 2), _mm256_permute2x128_si256(first, second, 0x20));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 2 + 32), _mm256_permute2x128_si256(first, second, 0x31));
+				}
+			}
+			#endif // SIMD_AVX2_SUPPORT
+
+			#ifdef SIMD_SSSE3_SUPPORT
+			{
+				const __m128i table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alphabet));
+				const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+
+				for (; i + 16 <= size; i += 16)
+				{
+					__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					__m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(v, 4), nibbleMask));
+					__m128i low = _mm_shuffle_epi8(table, _mm_and_si128(v, nibbleMask));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2), _mm_unpacklo_epi8(high, low));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2 + 16), _mm_unpackhi_epi8(high, low));
+				}
+			}
+			#endif // SIMD_SSSE3_SUPPORT
+
+			for (; i < size; ++i)
+			{
+				out[i * 2] = alphabet[data[i] >> 4];
+				out[i * 2 + 1] = alphabet[data[i] & 0x0F];
+			}
+		}
+
+		// @brief 将byteCount * 2个字符解码为byteCount字节
+		// @retval 遇到非法字符时返回false
+		inline bool HexDecodeBlocks(const Ch* src, Usize byteCount, B8* out) noexcept
+		{
+			Usize i = 0;
+
+			#ifdef SIMD_AVX2_SUPPORT
+			for (; i + 32 <= byteCount; i += 32)
+			{
+				__m256i first, second;
+				if (!HexValues(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 2)), first)
+					|| !HexValues(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 2 + 32)), second))
+					return false;
+
+				// 高半字节乘16与低半字节相加，packus同样只在通道内进行，需要调整64位块的顺序
+				first = _mm256_maddubs_epi16(first, _mm256_set1_epi16(0x0110));
+				second = _mm256_maddubs_epi16(second, _mm256_set1_epi16(0x0110));
+				__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xD8);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), packed);
+			}
+			#endif // SIMD_AVX2_SUPPORT
+
+			#ifdef SIMD_SSSE3_SUPPORT
+			for (; i + 16 <= byteCount; i += 16)
+			{
+				__m128i first, second;
+				if (!HexValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2)), first)
+					|| !HexValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2 + 16)), second))
+					return false;
+
+				first = _mm_maddubs_epi16(first, _mm_set1_epi16(0x0110));
+				second = _mm_maddubs_epi16(second, _mm_set1_epi16(0x0110));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(first, second));
+			}
+			#endif // SIMD_SSSE3_SUPPORT
+
+			for (; i < byteCount; ++i)
+			{
+				U8 high = HexDecodeTable[static_cast<U8>(src[i * 2])];
+				U8 low = HexDecodeTable[static_cast<U8>(src[i * 2 + 1])];
+				if (((high | low) & 0xF0) != 0)
+					return false;
+				out[i] = static_cast<B8>(high << 4 | low);
+			}
+
+			return true;
+		}
+
+		// @brief 将一段编码结果写入流
+		inline void WriteToStream(IInputStream& sink, B8* data, Usize size)
+		{
+			if (size == 0)
+				return;
+
+			sink.PrepareBuffer(size);
+			sink.WriteBuffer(data, size);
+		}
+	}
+
+	constexpr Usize Base64EncodedSize(Usize byteCount) noexcept
+	{
+		return (byteCount + 2) / 3 * 4;
+	}
+
+	// @brief 根据编码文本计算精确的解码长度
+	// @note 长度不是4的倍数时抛出InvalidArgument
+	inline Usize Base64DecodedSize(StringView src)
+	{
+		if (src.Size() % 4 != 0)
+			Detail::ThrowInvalidBase64("base64 length must be a multiple of 4");
+		if (src.Empty())
+			return 0;
+
+		Usize padding = src[src.Size() - 1] == '=' ? (src[src.Size() - 2] == '=' ? 2 : 1) : 0;
+		return src.Size() / 4 * 3 - padding;
+	}
+
+	constexpr Usize HexEncodedSize(Usize byteCount) noexcept
+	{
+		return byteCount * 2;
+	}
+
+	inline Usize HexDecodedSize(StringView src)
+	{
+		if (src.Size() % 2 != 0)
+			Detail::ThrowInvalidHex("hex length must be a multiple of 2");
+		return src.Size() / 2;
+	}
+
+	// @brief 编码到调用方缓冲区，缓冲区至少需要Base64EncodedSize(size)个字符
+	// @retval 写入的字符数
+	inline Usize Base64Encode(const B8* data, Usize size, Ch* out) noexcept
+	{
+		Usize processed = Detail::Base64EncodeBlocks(data, size, out);
+		Detail::Base64EncodeTail(data + processed, size - processed, out + processed / 3 * 4);
+		return Base64EncodedSize(size);
+	}
+
+	// @brief 编码并追加到out末尾
+	inline void Base64Encode(const B8* data, Usize size, String& out)
+	{
+		Usize oldSize = out.Size();
+		out.Resize(oldSize + Base64EncodedSize(size));
+		Base64Encode(data, size, out.Data() + oldSize);
+	}
+
+	inline String Base64Encode(std::span<const B8> data)
+	{
+		String res;
+		Base64Encode(data.data(), data.size(), res);
+		return res;
+	}
+
+	// @brief 解码到调用方缓冲区，缓冲区至少需要Base64DecodedSize(src)字节
+	// @retval 写入的字节数
+	// @note 输入不合法时抛出InvalidArgument，此时缓冲区内容未定义
+	inline Usize Base64Decode(StringView src, B8* out)
+	{
+		Usize size = Base64DecodedSize(src);
+		if (size == 0)
+			return 0;
+
+		Usize quadCount = src.Size() / 4 - 1;
+		if (!Detail::Base64DecodeBlocks(src.Data(), quadCount, out))
+			Detail::ThrowInvalidBase64("invalid base64 character");
+
+		Detail::Base64DecodeFinalQuad(src.Data() + quadCount * 4, out + quadCount * 3);
+		return size;
+	}
+
+	// @brief 解码并按字节追加到out末尾，失败时out保持不变
+	inline void Base64Decode(StringView src, String& out)
+	{
+		Usize oldSize = out.Size();
+		out.Resize(oldSize + Base64DecodedSize(src));
+
+		try
+		{
+			Base64Decode(src, reinterpret_cast<B8*>(out.Data() + oldSize));
+		}
+		catch (...)
+		{
+			out.Resize(oldSize);
+			throw;
+		}
+	}
+
+	inline String Base64Decode(StringView src)
+	{
+		String res;
+		Base64Decode(src, res);
+		return res;
+	}
+
+	// @brief 编码到调用方缓冲区，缓冲区至少需要HexEncodedSize(size)个字符
+	// @retval 写入的字符数
+	inline Usize HexEncode(const B8* data, Usize size, Ch* out, HexCase letterCase = HexCase::Lower) noexcept
+	{
+		Detail::HexEncodeBlocks(data, size, out, letterCase);
+		return HexEncodedSize(size);
+	}
+
+	inline void HexEncode(const B8* data, Usize size, String& out, HexCase letterCase = HexCase::Lower)
+	{
+		Usize oldSize = out.Size();
+		out.Resize(oldSize + HexEncodedSize(size));
+		HexEncode(data, size, out.Data() + oldSize, letterCase);
+	}
+
+	inline String HexEncode(std::span<const B8> data, HexCase letterCase = HexCase::Lower)
+	{
+		String res;
+		HexEncode(data.data(), data.size(), res, letterCase);
+		return res;
+	}
+
+	// @brief 解码到调用方缓冲区，大小写字母均可接受
+	// @retval 写入的字节数
+	inline Usize HexDecode(StringView src, B8* out)
+	{
+		Usize size = HexDecodedSize(src);
+		if (!Detail::HexDecodeBlocks(src.Data(), size, out))
+			Detail::ThrowInvalidHex("invalid hex character");
+		return size;
+	}
+
+	inline void HexDecode(StringView src, String& out)
+	{
+		Usize oldSize = out.Size();
+		out.Resize(oldSize + HexDecodedSize(src));
+
+		try
+		{
+			HexDecode(src, reinterpret_cast<B8*>(out.Data() + oldSize));
+		}
+		catch (...)
+		{
+			out.Resize(oldSize);
+			throw;
+		}
+	}
+
+	inline String HexDecode(StringView src)
+	{
+		String res;
+		HexDecode(src, res);
+		return res;
+	}
+
+	// 流式接口：不断调用source.ReadBuffer()读取数据块，返回长度为0时视为结束
+	// 每个数据块的编解码结果通过sink.PrepareBuffer()/WriteBuffer()写出，块之间不完整的分组会被暂存
+
+	inline void Base64EncodeStream(IOutputStream& source, IInputStream& sink)
+	{
+		std::vector<B8> buffer;
+		B8 carry[3];
+		Usize carrySize = 0;
+
+		while (true)
+		{
+			auto [data, size] = source.ReadBuffer();
+			if (data == nullptr || size == 0)
+				break;
+
+			buffer.resize(Base64EncodedSize(carrySize + size));
+			Ch* out = reinterpret_cast<Ch*>(buffer.data());
+
+			// 先用新数据补齐上一块遗留的字节
+			if (carrySize != 0)
+			{
+				Usize take = std::min(3 - carrySize, size);
+				std::memcpy(carry + carrySize, data, take);
+				carrySize += take;
+				data += take;
+				size -= take;
+
+				if (carrySize < 3)
+					continue;
+
+				out += Base64Encode(carry, 3, out);
+				carrySize = 0;
+			}
+
+			Usize processed = Detail::Base64EncodeBlocks(data, size, out);
+			out += processed / 3 * 4;
+
+			carrySize = size - processed;
+			std::memcpy(carry, data + processed, carrySize);
+
+			Detail::WriteToStream(sink, buffer.data(), static_cast<Usize>(reinterpret_cast<B8*>(out) - buffer.data()));
+		}
+
+		Ch tail[4];
+		Detail::Base64EncodeTail(carry, carrySize, tail);
+		Detail::WriteToStream(sink, reinterpret_cast<B8*>(tail), carrySize == 0 ? 0 : 4);
+	}
+
+	inline void Base64DecodeStream(IOutputStream& source, IInputStream& sink)
+	{
+		std::vector<B8> buffer;
+		Ch carry[4];
+		Usize carrySize = 0;
+
+		while (true)
+		{
+			auto [data, size] = source.ReadBuffer();
+			if (data == nullptr || size == 0)
+				break;
+
+			const Ch* src = reinterpret_cast<const Ch*>(data);
+			buffer.resize((carrySize + size) / 4 * 3);
+			B8* out = buffer.data();
+
+			if (carrySize != 0)
+			{
+				Usize take = std::min(4 - carrySize, size);
+				std::memcpy(carry + carrySize, src, take);
+				carrySize += take;
+				src += take;
+				size -= take;
+
+				// 完整的分组只有在确认后面还有数据时才能按不含填充的方式解码
+				if (size == 0)
+					continue;
+
+				if (!Detail::Base64DecodeBlocks(carry, 1, out))
+					Detail::ThrowInvalidBase64("invalid base64 character");
+				out += 3;
+				carrySize = 0;
+			}
+
+			// 总是保留最后一个分组，它可能是带填充的结尾
+			Usize keep = size % 4 == 0 ? 4 : size % 4;
+			Usize quadCount = (size - keep) / 4;
+			if (!Detail::Base64DecodeBlocks(src, quadCount, out))
+				Detail::ThrowInvalidBase64("invalid base64 character");
+			out += quadCount * 3;
+
+			carrySize = keep;
+			std::memcpy(carry, src + quadCount * 4, keep);
+
+			Detail::WriteToStream(sink, buffer.data(), static_cast<Usize>(out - buffer.data()));
+		}
+
+		if (carrySize == 0)
+			return;
+		if (carrySize != 4)
+			Detail::ThrowInvalidBase64("base64 length must be a multiple of 4");
+
+		B8 tail[3];
+		Detail::WriteToStream(sink, tail, Detail::Base64DecodeFinalQuad(carry, tail));
+	}
+
+	inline void HexEncodeStream(IOutputStream& source, IInputStream& sink, HexCase letterCase = HexCase::Lower)
+	{
+		std::vector<B8> buffer;
+
+		while (true)
+		{
+			auto [data, size] = source.ReadBuffer();
+			if (data == nullptr || size == 0)
+				break;
+
+			buffer.resize(HexEncodedSize(size));
+			HexEncode(data, size, reinterpret_cast<Ch*>(buffer.data()), letterCase);
+			Detail::WriteToStream(sink, buffer.data(), buffer.size());
+		}
+	}
+
+	inline void HexDecodeStream(IOutputStream& source, IInputStream& sink)
+	{
+		std::vector<B8> buffer;
+		Ch carry[2];
+		Usize carrySize = 0;
+
+		while (true)
+		{
+			auto [data, size] = source.ReadBuffer();
+			if (data == nullptr || size == 0)
+				break;
+
+			const Ch* src = reinterpret_cast<const Ch*>(data);
+			buffer.resize((carrySize + size) / 2);
+			B8* out = buffer.data();
+
+			if (carrySize != 0)
+			{
+				carry[1] = *src++;
+				--size;
+				if (!Detail::HexDecodeBlocks(carry, 1, out))
+					Detail::ThrowInvalidHex("invalid hex character");
+				++out;
+				carrySize = 0;
+			}
+
+			Usize byteCount = size / 2;
+			if (!Detail::HexDecodeBlocks(src, byteCount, out))
+				Detail::ThrowInvalidHex("invalid hex character");
+			out += byteCount;
+
+			if (size % 2 != 0)
+			{
+				carry[0] = src[size - 1];
+				carrySize = 1;
+			}
+
+			Detail::WriteToStream(sink, buffer.data(), static_cast<Usize>(out - buffer.data()));
+		}
+
+		if (carrySize != 0)
+			Detail::ThrowInvalidHex("hex length must be a multiple of 2");
+	}
+}
@@ -0,0 +1,180 @@
+// File /Engine/String/CharSet.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Utils/Simd.hpp"
+#include <string_view>
+
+namespace PenFramework::PenEngine
+{
+	// 单字节字符集合，可在编译期构造，用于批量查找需要特殊处理的字符
+	// 码元值大于255的字符（U32String中的非单字节字符）永远不属于任何CharSet
+	class CharSet
+	{
+	public:
+		constexpr CharSet() noexcept = default;
+		constexpr explicit CharSet(std::string_view chars) noexcept
+		{
+			for (char ch : chars)
+				Add(static_cast<U8>(ch));
+		}
+
+		// @brief 构造包含闭区间[first, last]内所有字符的集合
+		static constexpr CharSet Range(U8 first, U8 last) noexcept
+		{
+			CharSet res;
+			res.AddRange(first, last);
+			return res;
+		}
+
+		constexpr CharSet& Add(U8 ch) noexcept
+		{
+			m_bits[ch >> 6] |= u64(1) << (ch & 63);
+			// 分类表：低半字节为下标，每一位表示对应的高半字节（低8个与高8个分两张表）
+			m_lowNibbleTable[ch >> 7][ch & 0x0F] |= static_cast<U8>(1u << ((ch >> 4) & 7));
+			return *this;
+		}
+
+		constexpr CharSet& AddRange(U8 first, U8 last) noexcept
+		{
+			for (U32 ch = first; ch <= last; ++ch)
+				Add(static_cast<U8>(ch));
+			return *this;
+		}
+
+		constexpr CharSet operator|(const CharSet& other) const noexcept
+		{
+			CharSet res = *this;
+			for (Usize i = 0; i < 4; ++i)
+				res.m_bits[i] |= other.m_bits[i];
+			for (Usize i = 0; i < 2; ++i)
+				for (Usize j = 0; j < 16; ++j)
+					res.m_lowNibbleTable[i][j] |= other.m_lowNibbleTable[i][j];
+			return res;
+		}
+
+		template <typename CharType>
+		constexpr bool Contain(CharType ch) const noexcept
+		{
+			auto value = static_cast<std::make_unsigned_t<CharType>>(ch);
+			return value < 256 && (m_bits[value >> 6] >> (value & 63) & 1) != 0;
+		}
+
+		// @brief 返回第一个属于集合的字符下标，不存在时返回len
+		template <typename CharType>
+		Usize FindFirstIn(const CharType* str, Usize len) const noexcept;
+
+		// @brief 统计属于集合的字符个数
+		template <typename CharType>
+		Usize CountIn(const CharType* str, Usize len) const noexcept;
+	private:
+		#ifdef SIMD_SSSE3_SUPPORT
+		// 返回16个字节中属于集合的字节掩码
+		U32 Classify(__m128i v) const noexcept
+		{
+			const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+			const __m128i lowHalf = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+			const __m128i highHalf = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, -128);
+
+			__m128i low = _mm_and_si128(v, nibbleMask);
+			__m128i high = _mm_and_si128(_mm_srli_epi16(v, 4), nibbleMask);
+
+			__m128i first = _mm_and_si128(_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lowNibbleTable[0])), low), _mm_shuffle_epi8(lowHalf, high));
+			__m128i second = _mm_and_si128(_mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lowNibbleTable[1])), low), _mm_shuffle_epi8(highHalf, high));
+			__m128i hit = _mm_or_si128(first, second);
+
+			return ~static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(hit, _mm_setzero_si128()))) & 0xFFFF;
+		}
+		#endif // SIMD_SSSE3_SUPPORT
+
+		#ifdef SIMD_AVX2_SUPPORT
+		U32 Classify(__m256i v) const noexcept
+		{
+			const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+			const __m256i lowHalf = _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0));
+			const __m256i highHalf = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64, -128));
+			const __m256i firstTable = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lowNibbleTable[0])));
+			const __m256i secondTable = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(m_lowNibbleTable[1])));
+
+			__m256i low = _mm256_and_si256(v, nibbleMask);
+			__m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibbleMask);
+
+			__m256i first = _mm256_and_si256(_mm256_shuffle_epi8(firstTable, low), _mm256_shuffle_epi8(lowHalf, high));
+			__m256i second = _mm256_and_si256(_mm256_shuffle_epi8(secondTable, low), _mm256_shuffle_epi8(highHalf, high));
+			__m256i hit = _mm256_or_si256(first, second);
+
+			return ~static_cast<U32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hit, _mm256_setzero_si256())));
+		}
+		#endif // SIMD_AVX2_SUPPORT
+
+		u64 m_bits[4] = {};
+		U8 m_lowNibbleTable[2][16] = {};
+	};
+
+	template <typename CharType>
+	Usize CharSet::FindFirstIn(const CharType* str, Usize len) const noexcept
+	{
+		Usize i = 0;
+
+		if constexpr (sizeof(CharType) == 1)
+		{
+			#ifdef SIMD_AVX2_SUPPORT
+			for (; i + 32 <= len; i += 32)
+			{
+				if (U32 mask = Classify(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i))); mask != 0)
+					return i + static_cast<Usize>(std::countr_zero(mask));
+			}
+			#endif // SIMD_AVX2_SUPPORT
+
+			#ifdef SIMD_SSSE3_SUPPORT
+			for (; i + 16 <= len; i += 16)
+			{
+				if (U32 mask = Classify(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i))); mask != 0)
+					return i + static_cast<Usize>(std::countr_zero(mask));
+			}
+			#endif // SIMD_SSSE3_SUPPORT
+		}
+
+		for (; i < len; ++i)
+		{
+			if (Contain(str[i]))
+				return i;
+		}
+
+		return len;
+	}
+
+	template <typename CharType>
+	Usize CharSet::CountIn(const CharType* str, Usize len) const noexcept
+	{
+		Usize i = 0;
+		Usize count = 0;
+
+		if constexpr (sizeof(CharType) == 1)
+		{
+			#ifdef SIMD_AVX2_SUPPORT
+			for (; i + 32 <= len; i += 32)
+				count += static_cast<Usize>(std::popcount(Classify(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i)))));
+			#endif // SIMD_AVX2_SUPPORT
+
+			#ifdef SIMD_SSSE3_SUPPORT
+			for (; i + 16 <= len; i += 16)
+				count += static_cast<Usize>(std::popcount(Classify(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i)))));
+			#endif // SIMD_SSSE3_SUPPORT
+		}
+
+		for (; i < len; ++i)
+			count += Contain(str[i]);
+
+		return count;
+	}
+}
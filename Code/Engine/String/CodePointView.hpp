@@ -0,0 +1,806 @@
+// File /Engine/String/CodePointView.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../DebugTools/Verify.hpp"
+#include "../Utils/Simd.hpp"
+#include "StringView.hpp"
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+
+namespace PenFramework::PenEngine
+{
+	template <typename T>
+	concept UtfCharType = IsOneOf<T, Ch, Ch8, Ch16, Ch32>;
+
+	// 非法的编码单元序列解码为替换字符
+	static constexpr Ch32 ReplacementCodePoint = 0xFFFD;
+
+	namespace Detail
+	{
+		// @brief 从p处解码一个码点并将p移动到下一个码点
+		// @note 非法序列按最大合法前缀跳过（至少一个编码单元）并返回ReplacementCodePoint
+		template <typename CharType>
+		Ch32 DecodeCodePoint(const CharType*& p, const CharType* end) noexcept
+		{
+			if constexpr (sizeof(CharType) == 1)
+			{
+				U8 lead = static_cast<U8>(*p++);
+				if (lead < 0x80)
+					return lead;
+
+				Usize length;
+				Ch32 cp;
+				U8 low = 0x80;
+				U8 high = 0xBF;
+				if (lead >= 0xC2 && lead <= 0xDF)
+				{
+					length = 2;
+					cp = lead & 0x1F;
+				}
+				else if (lead >= 0xE0 && lead <= 0xEF)
+				{
+					length = 3;
+					cp = lead & 0x0F;
+					// 排除过长编码与代理项
+					if (lead == 0xE0)
+						low = 0xA0;
+					else if (lead == 0xED)
+						high = 0x9F;
+				}
+				else if (lead >= 0xF0 && lead <= 0xF4)
+				{
+					length = 4;
+					cp = lead & 0x07;
+					if (lead == 0xF0)
+						low = 0x90;
+					else if (lead == 0xF4)
+						high = 0x8F;
+				}
+				else
+					return ReplacementCodePoint;
+
+				for (Usize i = 1; i < length; ++i)
+				{
+					if (p == end)
+						return ReplacementCodePoint;
+
+					U8 trail = static_cast<U8>(*p);
+					if (trail < low || trail > high)
+						return ReplacementCodePoint;
+
+					low = 0x80;
+					high = 0xBF;
+					cp = cp << 6 | (trail & 0x3F);
+					++p;
+				}
+
+				return cp;
+			}
+			else if constexpr (sizeof(CharType) == 2)
+			{
+				Ch32 unit = static_cast<U16>(*p++);
+				if (unit < 0xD800 || unit > 0xDFFF)
+					return unit;
+
+				if (unit <= 0xDBFF && p != end && static_cast<U16>(*p) >= 0xDC00 && static_cast<U16>(*p) <= 0xDFFF)
+					return 0x10000 + ((unit - 0xD800) << 10 | (static_cast<U16>(*p++) - 0xDC00));
+
+				return ReplacementCodePoint;
+			}
+			else
+			{
+				Ch32 cp = static_cast<Ch32>(*p++);
+				return cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF) ? ReplacementCodePoint : cp;
+			}
+		}
+
+		// @brief 返回开头连续ASCII编码单元的个数
+		template <typename CharType>
+		Usize AsciiPrefixLength(const CharType* source, Usize sourceLength) noexcept
+		{
+			Usize i = 0;
+
+			if constexpr (sizeof(CharType) == 1)
+			{
+				#ifdef SIMD_AVX2_SUPPORT
+				for (; i + 32 <= sourceLength; i += 32)
+				{
+					if (U32 mask = static_cast<U32>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i)))); mask != 0)
+						return i + std::countr_zero(mask);
+				}
+				#endif // SIMD_AVX2_SUPPORT
+
+				#ifdef SIMD_SSE2_SUPPORT
+				for (; i + 16 <= sourceLength; i += 16)
+				{
+					if (U32 mask = static_cast<U32>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i)))); mask != 0)
+						return i + std::countr_zero(mask);
+				}
+				#endif // SIMD_SSE2_SUPPORT
+
+				for (; i + 8 <= sourceLength; i += 8)
+				{
+					if (u64 mask = Simd::LoadU64(source + i) & 0x8080808080808080ull; mask != 0)
+						return i + std::countr_zero(mask) / BitsPerBytes;
+				}
+			}
+			else if constexpr (sizeof(CharType) == 2)
+			{
+				#ifdef SIMD_SSE2_SUPPORT
+				const __m128i nonAscii = _mm_set1_epi16(static_cast<short>(0xFF80));
+				for (; i + 8 <= sourceLength; i += 8)
+				{
+					__m128i v = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i)), nonAscii);
+					if (U32 mask = static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi16(v, _mm_setzero_si128()))) ^ 0xFFFF; mask != 0)
+						return i + std::countr_zero(mask) / 2;
+				}
+				#endif // SIMD_SSE2_SUPPORT
+			}
+
+			for (; i < sourceLength; ++i)
+			{
+				if (static_cast<std::make_unsigned_t<CharType>>(source[i]) >= 0x80)
+					return i;
+			}
+
+			return i;
+		}
+
+		// @brief 返回编码单元是否为一个码点的起始单元
+		template <typename CharType>
+		constexpr bool IsCodePointLead(CharType ch) noexcept
+		{
+			if constexpr (sizeof(CharType) == 1)
+				return (static_cast<U8>(ch) & 0xC0) != 0x80;
+			else if constexpr (sizeof(CharType) == 2)
+				return (static_cast<U16>(ch) & 0xFC00) != 0xDC00;
+			else
+				return true;
+		}
+
+		// 一次得到一个向量宽度内每个起始单元一位的掩码，Width为0表示没有向量路径
+		template <typename CharType>
+		struct SimdLeadMask
+		{
+			static constexpr Usize Width = 0;
+		};
+
+		#if defined(SIMD_AVX2_SUPPORT)
+		template <typename CharType> requires(sizeof(CharType) == 1)
+		struct SimdLeadMask<CharType>
+		{
+			static constexpr Usize Width = 32;
+			static u64 Get(const CharType* p) noexcept
+			{
+				// 延续字节0x80~0xBF按有符号数解释为-128~-65，大于-65的都是起始字节
+				__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+				return static_cast<U32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(static_cast<char>(0xBF)))));
+			}
+		};
+
+		template <typename CharType> requires(sizeof(CharType) == 2)
+		struct SimdLeadMask<CharType>
+		{
+			static constexpr Usize Width = 16;
+			static u64 Get(const CharType* p) noexcept
+			{
+				__m256i v = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), _mm256_set1_epi16(static_cast<short>(0xFC00)));
+				__m256i trail = _mm256_cmpeq_epi16(v, _mm256_set1_epi16(static_cast<short>(0xDC00)));
+				// packs在每个128位通道内把16位结果压缩为8位，两个通道的结果分别位于掩码的低8位与16~23位
+				U32 mask = static_cast<U32>(_mm256_movemask_epi8(_mm256_packs_epi16(trail, trail)));
+				return ((mask & 0xFF) | (mask >> 8 & 0xFF00)) ^ 0xFFFF;
+			}
+		};
+		#elif defined(SIMD_SSE2_SUPPORT)
+		template <typename CharType> requires(sizeof(CharType) == 1)
+		struct SimdLeadMask<CharType>
+		{
+			static constexpr Usize Width = 16;
+			static u64 Get(const CharType* p) noexcept
+			{
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+				return static_cast<U32>(_mm_movemask_epi8(_mm_cmpgt_epi8(v, _mm_set1_epi8(static_cast<char>(0xBF)))));
+			}
+		};
+
+		template <typename CharType> requires(sizeof(CharType) == 2)
+		struct SimdLeadMask<CharType>
+		{
+			static constexpr Usize Width = 8;
+			static u64 Get(const CharType* p) noexcept
+			{
+				__m128i v = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi16(static_cast<short>(0xFC00)));
+				__m128i trail = _mm_cmpeq_epi16(v, _mm_set1_epi16(static_cast<short>(0xDC00)));
+				// packs把每个16位结果压缩为8位，movemask的低8位即每个编码单元一位
+				return (static_cast<U32>(_mm_movemask_epi8(_mm_packs_epi16(trail, trail))) & 0xFF) ^ 0xFF;
+			}
+		};
+		#endif // SIMD_AVX2_SUPPORT
+	}
+
+	// @brief 统计码点个数
+	// @note 只统计起始编码单元，对合法的UTF序列结果精确；非法序列的计数可能与逐个解码得到的替换字符个数不同
+	template <UtfCharType CharType>
+	Usize CodePointCount(const CharType* source, Usize sourceLength) noexcept
+	{
+		if constexpr (sizeof(CharType) == 4)
+			return sourceLength;
+		else
+		{
+			using Block = Detail::SimdLeadMask<CharType>;
+			Usize i = 0;
+			Usize count = 0;
+
+			if constexpr (Block::Width != 0)
+			{
+				for (; i + Block::Width <= sourceLength; i += Block::Width)
+					count += static_cast<Usize>(std::popcount(Block::Get(source + i)));
+			}
+
+			if constexpr (sizeof(CharType) == 1)
+			{
+				// 统计每个字节最高两位为10的延续字节
+				for (; i + 8 <= sourceLength; i += 8)
+				{
+					u64 v = Simd::LoadU64(source + i);
+					count += 8 - static_cast<Usize>(std::popcount((v >> 7) & ~(v >> 6) & 0x0101010101010101ull));
+				}
+			}
+
+			for (; i < sourceLength; ++i)
+				count += Detail::IsCodePointLead(source[i]);
+
+			return count;
+		}
+	}
+
+	// @brief 返回第index个码点（从0开始）起始处的编码单元偏移
+	// @retval index等于码点个数时返回sourceLength，超过时返回NPos
+	template <UtfCharType CharType>
+	Usize CodePointOffset(const CharType* source, Usize sourceLength, Usize index) noexcept
+	{
+		if constexpr (sizeof(CharType) == 4)
+			return index <= sourceLength ? index : NPos;
+		else
+		{
+			using Block = Detail::SimdLeadMask<CharType>;
+			Usize i = 0;
+
+			if constexpr (Block::Width != 0)
+			{
+				for (; i + Block::Width <= sourceLength; i += Block::Width)
+				{
+					u64 mask = Block::Get(source + i);
+					Usize count = static_cast<Usize>(std::popcount(mask));
+					if (index < count)
+					{
+						// 清除前index个起始单元后，最低位即目标位置
+						for (Usize n = 0; n < index; ++n)
+							mask &= mask - 1;
+						return i + std::countr_zero(mask);
+					}
+					index -= count;
+				}
+			}
+
+			for (; i < sourceLength; ++i)
+			{
+				if (Detail::IsCodePointLead(source[i]) && index-- == 0)
+					return i;
+			}
+
+			return index == 0 ? sourceLength : NPos;
+		}
+	}
+
+	// @brief 返回不超过maxLength个编码单元、且结束于码点边界的最长前缀长度
+	template <UtfCharType CharType>
+	Usize TruncateToCodePointBoundary(const CharType* source, Usize sourceLength, Usize maxLength) noexcept
+	{
+		if (maxLength >= sourceLength)
+			return sourceLength;
+
+		// 合法UTF-8最多回退3个字节，UTF-16最多回退1个编码单元
+		Usize length = maxLength;
+		while (length != 0 && !Detail::IsCodePointLead(source[length]))
+			--length;
+		return length;
+	}
+
+	// @brief 返回前maxCount个码点占用的编码单元个数
+	template <UtfCharType CharType>
+	Usize TruncateToCodePoints(const CharType* source, Usize sourceLength, Usize maxCount) noexcept
+	{
+		Usize offset = CodePointOffset(source, sourceLength, maxCount);
+		return offset == NPos ? sourceLength : offset;
+	}
+
+	// 构造时接受的视图类型，BasicStringView不支持的字符类型使用std::basic_string_view
+	template <typename CharType>
+	using UtfSourceView = std::conditional_t<CurrentStringSupportCharType<CharType>, BasicStringView<CharType>, std::basic_string_view<CharType>>;
+
+	namespace Detail
+	{
+		template <typename CharType>
+		const CharType* UtfViewData(const BasicStringView<CharType>& str) noexcept { return str.Data(); }
+		template <typename CharType>
+		const CharType* UtfViewData(const std::basic_string_view<CharType>& str) noexcept { return str.data(); }
+
+		template <typename CharType>
+		Usize UtfViewSize(const BasicStringView<CharType>& str) noexcept { return str.Size(); }
+		template <typename CharType>
+		Usize UtfViewSize(const std::basic_string_view<CharType>& str) noexcept { return str.size(); }
+	}
+
+	// 按码点遍历UTF-8/16/32文本，惰性解码且不分配内存
+	// 连续的ASCII编码单元会被整段识别，之后逐个给出时不再经过解码
+	template <UtfCharType CharType>
+	class BasicCodePointView
+	{
+	public:
+		using SourceView = UtfSourceView<CharType>;
+
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using iterator_concept = std::forward_iterator_tag;
+
+			using value_type = Ch32;
+			using difference_type = Isize;
+			using pointer = const Ch32*;
+			using reference = Ch32;
+
+			Iterator() noexcept = default;
+			Iterator(const CharType* pos, const CharType* end) noexcept : m_pos(pos), m_end(end), m_asciiEnd(pos) { Load(); }
+
+			Ch32 operator*() const noexcept
+			{
+				DEBUG_VERIFY_REPORT(m_pos != m_end, "cannot dereference end code point iterator")
+					return m_value;
+			}
+
+			Iterator& operator++() noexcept
+			{
+				DEBUG_VERIFY_REPORT(m_pos != m_end, "cannot increment end code point iterator")
+					m_pos = m_next;
+				Load();
+				return *this;
+			}
+
+			Iterator operator++(int) noexcept
+			{
+				Iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			bool operator==(const Iterator& other) const noexcept
+			{
+				return m_pos == other.m_pos;
+			}
+
+			// @brief 当前码点起始编码单元的地址
+			const CharType* Data() const noexcept { return m_pos; }
+			// @brief 当前码点占用的编码单元个数
+			Usize Length() const noexcept { return static_cast<Usize>(m_next - m_pos); }
+		private:
+			// 每次最多向前探测的ASCII长度，避免提前结束遍历时扫描整个文本
+			static constexpr Usize AsciiProbeLength = 64;
+
+			void Load() noexcept
+			{
+				if (m_pos == m_end)
+				{
+					m_next = m_end;
+					return;
+				}
+
+				if (m_pos < m_asciiEnd || (static_cast<std::make_unsigned_t<CharType>>(*m_pos) < 0x80
+					&& (m_asciiEnd = m_pos + Detail::AsciiPrefixLength(m_pos, std::min<Usize>(m_end - m_pos, AsciiProbeLength))) != m_pos))
+				{
+					m_value = static_cast<Ch32>(*m_pos);
+					m_next = m_pos + 1;
+					return;
+				}
+
+				m_next = m_pos;
+				m_value = Detail::DecodeCodePoint(m_next, m_end);
+			}
+
+			const CharType* m_pos = nullptr;
+			const CharType* m_end = nullptr;
+			const CharType* m_next = nullptr;
+			const CharType* m_asciiEnd = nullptr;
+			Ch32 m_value = 0;
+		};
+
+		using iterator = Iterator;
+		using const_iterator = Iterator;
+		using ConstIterator = Iterator;
+
+		BasicCodePointView() noexcept = default;
+		BasicCodePointView(const CharType* str, Usize len) noexcept : m_str(str), m_size(len) {}
+		explicit BasicCodePointView(SourceView str) noexcept : m_str(Detail::UtfViewData(str)), m_size(Detail::UtfViewSize(str)) {}
+
+		ConstIterator begin() const noexcept { return Begin(); }
+		ConstIterator end() const noexcept { return End(); }
+
+		ConstIterator Begin() const noexcept { return ConstIterator(m_str, m_str + m_size); }
+		ConstIterator End() const noexcept { return ConstIterator(m_str + m_size, m_str + m_size); }
+
+		SourceView Text() const noexcept { return SourceView(m_str, m_size); }
+		bool Empty() const noexcept { return m_size == 0; }
+
+		Usize Count() const noexcept { return CodePointCount(m_str, m_size); }
+		Usize Offset(Usize index) const noexcept { return CodePointOffset(m_str, m_size, index); }
+
+		// @brief 保留前maxCount个码点
+		BasicCodePointView Truncate(Usize maxCount) const noexcept { return BasicCodePointView(m_str, TruncateToCodePoints(m_str, m_size, maxCount)); }
+		// @brief 保留不超过maxLength个编码单元的完整码点
+		BasicCodePointView TruncateUnits(Usize maxLength) const noexcept { return BasicCodePointView(m_str, TruncateToCodePointBoundary(m_str, m_size, maxLength)); }
+	private:
+		const CharType* m_str = nullptr;
+		Usize m_size = 0;
+	};
+
+	namespace Detail
+	{
+		enum class GraphemeBreakProperty : U8
+		{
+			Other,
+			CR,
+			LF,
+			Control,
+			Extend,
+			ZWJ,
+			RegionalIndicator,
+			Prepend,
+			SpacingMark,
+			L,
+			V,
+			T,
+			LV,
+			LVT,
+			ExtendedPictographic
+		};
+
+		struct GraphemeBreakRange
+		{
+			Ch32 First;
+			Ch32 Last;
+			GraphemeBreakProperty Property;
+		};
+
+		// 常用文字与表情的断字属性，按码点升序排列
+		// 覆盖组合附加符号、天城文/泰文等常见的元音符号、谚文音节与表情符号，未列出的码点视为Other
+		inline constexpr GraphemeBreakRange GraphemeBreakTable[] =
+		{
+			{ 0x0000, 0x0009, GraphemeBreakProperty::Control },
+			{ 0x000A, 0x000A, GraphemeBreakProperty::LF },
+			{ 0x000B, 0x000C, GraphemeBreakProperty::Control },
+			{ 0x000D, 0x000D, GraphemeBreakProperty::CR },
+			{ 0x000E, 0x001F, GraphemeBreakProperty::Control },
+			{ 0x007F, 0x009F, GraphemeBreakProperty::Control },
+			{ 0x00A9, 0x00A9, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x00AD, 0x00AD, GraphemeBreakProperty::Control },
+			{ 0x00AE, 0x00AE, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x0300, 0x036F, GraphemeBreakProperty::Extend },
+			{ 0x0483, 0x0489, GraphemeBreakProperty::Extend },
+			{ 0x0591, 0x05BD, GraphemeBreakProperty::Extend },
+			{ 0x05BF, 0x05BF, GraphemeBreakProperty::Extend },
+			{ 0x05C1, 0x05C2, GraphemeBreakProperty::Extend },
+			{ 0x05C4, 0x05C5, GraphemeBreakProperty::Extend },
+			{ 0x05C7, 0x05C7, GraphemeBreakProperty::Extend },
+			{ 0x0600, 0x0605, GraphemeBreakProperty::Prepend },
+			{ 0x0610, 0x061A, GraphemeBreakProperty::Extend },
+			{ 0x061C, 0x061C, GraphemeBreakProperty::Control },
+			{ 0x064B, 0x065F, GraphemeBreakProperty::Extend },
+			{ 0x0670, 0x0670, GraphemeBreakProperty::Extend },
+			{ 0x06D6, 0x06DC, GraphemeBreakProperty::Extend },
+			{ 0x06DD, 0x06DD, GraphemeBreakProperty::Prepend },
+			{ 0x06DF, 0x06E4, GraphemeBreakProperty::Extend },
+			{ 0x06E7, 0x06E8, GraphemeBreakProperty::Extend },
+			{ 0x06EA, 0x06ED, GraphemeBreakProperty::Extend },
+			{ 0x070F, 0x070F, GraphemeBreakProperty::Prepend },
+			{ 0x0900, 0x0902, GraphemeBreakProperty::Extend },
+			{ 0x0903, 0x0903, GraphemeBreakProperty::SpacingMark },
+			{ 0x093A, 0x093A, GraphemeBreakProperty::Extend },
+			{ 0x093B, 0x093B, GraphemeBreakProperty::SpacingMark },
+			{ 0x093C, 0x093C, GraphemeBreakProperty::Extend },
+			{ 0x093E, 0x0940, GraphemeBreakProperty::SpacingMark },
+			{ 0x0941, 0x0948, GraphemeBreakProperty::Extend },
+			{ 0x0949, 0x094C, GraphemeBreakProperty::SpacingMark },
+			{ 0x094D, 0x094D, GraphemeBreakProperty::Extend },
+			{ 0x094E, 0x094F, GraphemeBreakProperty::SpacingMark },
+			{ 0x0951, 0x0957, GraphemeBreakProperty::Extend },
+			{ 0x0962, 0x0963, GraphemeBreakProperty::Extend },
+			{ 0x0E31, 0x0E31, GraphemeBreakProperty::Extend },
+			{ 0x0E33, 0x0E33, GraphemeBreakProperty::SpacingMark },
+			{ 0x0E34, 0x0E3A, GraphemeBreakProperty::Extend },
+			{ 0x0E47, 0x0E4E, GraphemeBreakProperty::Extend },
+			{ 0x1100, 0x115F, GraphemeBreakProperty::L },
+			{ 0x1160, 0x11A7, GraphemeBreakProperty::V },
+			{ 0x11A8, 0x11FF, GraphemeBreakProperty::T },
+			{ 0x1AB0, 0x1AFF, GraphemeBreakProperty::Extend },
+			{ 0x1DC0, 0x1DFF, GraphemeBreakProperty::Extend },
+			{ 0x200B, 0x200B, GraphemeBreakProperty::Control },
+			{ 0x200C, 0x200C, GraphemeBreakProperty::Extend },
+			{ 0x200D, 0x200D, GraphemeBreakProperty::ZWJ },
+			{ 0x200E, 0x200F, GraphemeBreakProperty::Control },
+			{ 0x2028, 0x202E, GraphemeBreakProperty::Control },
+			{ 0x203C, 0x203C, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x2049, 0x2049, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x2060, 0x206F, GraphemeBreakProperty::Control },
+			{ 0x20D0, 0x20FF, GraphemeBreakProperty::Extend },
+			{ 0x2122, 0x2122, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x2139, 0x2139, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x2194, 0x2199, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x21A9, 0x21AA, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x231A, 0x231B, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x2328, 0x2328, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x23CF, 0x23CF, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x23E9, 0x23F3, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x23F8, 0x23FA, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x24C2, 0x24C2, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x25AA, 0x25AB, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x25B6, 0x25B6, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x25C0, 0x25C0, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x25FB, 0x25FE, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x2600, 0x27BF, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x2934, 0x2935, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x2B05, 0x2B07, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x2B1B, 0x2B1C, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x2B50, 0x2B50, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x2B55, 0x2B55, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x302A, 0x302F, GraphemeBreakProperty::Extend },
+			{ 0x3030, 0x3030, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x303D, 0x303D, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x3099, 0x309A, GraphemeBreakProperty::Extend },
+			{ 0x3297, 0x3297, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x3299, 0x3299, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0xA960, 0xA97C, GraphemeBreakProperty::L },
+			{ 0xD7B0, 0xD7C6, GraphemeBreakProperty::V },
+			{ 0xD7CB, 0xD7FB, GraphemeBreakProperty::T },
+			{ 0xFE00, 0xFE0F, GraphemeBreakProperty::Extend },
+			{ 0xFE20, 0xFE2F, GraphemeBreakProperty::Extend },
+			{ 0xFEFF, 0xFEFF, GraphemeBreakProperty::Control },
+			{ 0xFFF0, 0xFFFB, GraphemeBreakProperty::Control },
+			{ 0x1F000, 0x1F0FF, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F10D, 0x1F10F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F12F, 0x1F12F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F16C, 0x1F171, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F17E, 0x1F17F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F18E, 0x1F18E, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F191, 0x1F19A, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F1AD, 0x1F1E5, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F1E6, 0x1F1FF, GraphemeBreakProperty::RegionalIndicator },
+			{ 0x1F201, 0x1F20F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F21A, 0x1F21A, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F22F, 0x1F22F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F232, 0x1F23A, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F23C, 0x1F23F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F249, 0x1F3FA, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F3FB, 0x1F3FF, GraphemeBreakProperty::Extend },
+			{ 0x1F400, 0x1F53D, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F546, 0x1F64F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F680, 0x1F6FF, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F774, 0x1F77F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F7D5, 0x1F7FF, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F80C, 0x1F80F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F848, 0x1F84F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F85A, 0x1F85F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F888, 0x1F88F, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F8AE, 0x1F8FF, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F90C, 0x1F93A, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F93C, 0x1F945, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1F947, 0x1FAFF, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0x1FC00, 0x1FFFD, GraphemeBreakProperty::ExtendedPictographic },
+			{ 0xE0000, 0xE001F, GraphemeBreakProperty::Control },
+			{ 0xE0020, 0xE007F, GraphemeBreakProperty::Extend },
+			{ 0xE0080, 0xE00FF, GraphemeBreakProperty::Control },
+			{ 0xE0100, 0xE01EF, GraphemeBreakProperty::Extend },
+		};
+
+		inline GraphemeBreakProperty GetGraphemeBreakProperty(Ch32 cp) noexcept
+		{
+			if (cp >= 0x20 && cp < 0x7F)
+				return GraphemeBreakProperty::Other;
+
+			// 谚文音节按规律区分LV与LVT，不需要查表
+			if (cp >= 0xAC00 && cp <= 0xD7A3)
+				return (cp - 0xAC00) % 28 == 0 ? GraphemeBreakProperty::LV : GraphemeBreakProperty::LVT;
+
+			const GraphemeBreakRange* it = std::upper_bound(std::begin(GraphemeBreakTable), std::end(GraphemeBreakTable), cp,
+				[](Ch32 value, const GraphemeBreakRange& range) { return value < range.First; });
+			if (it == std::begin(GraphemeBreakTable) || cp > (--it)->Last)
+				return GraphemeBreakProperty::Other;
+			return it->Property;
+		}
+
+		// @brief 判断两个相邻码点之间是否不可断开，规则编号对应UAX #29
+		inline bool IsGraphemeJoin(GraphemeBreakProperty prev, GraphemeBreakProperty next, bool zwjAfterPictographic, Usize regionalCount) noexcept
+		{
+			using enum GraphemeBreakProperty;
+
+			// GB3 / GB4 / GB5
+			if (prev == CR && next == LF)
+				return true;
+			if (prev == CR || prev == LF || prev == Control || next == CR || next == LF || next == Control)
+				return false;
+
+			// GB6 / GB7 / GB8
+			if (prev == L && (next == L || next == V || next == LV || next == LVT))
+				return true;
+			if ((prev == LV || prev == V) && (next == V || next == T))
+				return true;
+			if ((prev == LVT || prev == T) && next == T)
+				return true;
+
+			// GB9 / GB9a / GB9b
+			if (next == Extend || next == ZWJ || next == SpacingMark || prev == Prepend)
+				return true;
+
+			// GB11
+			if (prev == ZWJ && next == ExtendedPictographic)
+				return zwjAfterPictographic;
+
+			// GB12 / GB13
+			if (prev == RegionalIndicator && next == RegionalIndicator)
+				return regionalCount % 2 == 1;
+
+			return false;
+		}
+
+		// @brief 返回从first开始的字素簇的结束位置，按UAX #29的扩展字素簇规则判断
+		template <typename CharType>
+		const CharType* NextGraphemeBoundary(const CharType* first, const CharType* last) noexcept
+		{
+			using enum GraphemeBreakProperty;
+			using Unsigned = std::make_unsigned_t<CharType>;
+
+			// ASCII之间只有CR LF不会断开，连续ASCII不必解码与查表
+			if (static_cast<Unsigned>(*first) < 0x80 && (first + 1 == last || (static_cast<Unsigned>(first[1]) < 0x80 && !(*first == CharType('\r') && first[1] == CharType('\n')))))
+				return first + 1;
+
+			const CharType* p = first;
+			GraphemeBreakProperty prev = GetGraphemeBreakProperty(DecodeCodePoint(p, last));
+			// 用于GB11：是否处于“表情符号 Extend*”之后，以及最近的ZWJ是否紧跟在这样的序列之后
+			bool pictographicRun = prev == ExtendedPictographic;
+			bool zwjAfterPictographic = false;
+			// 用于GB12/13：当前簇末尾连续区域指示符的个数
+			Usize regionalCount = prev == RegionalIndicator;
+
+			while (p != last)
+			{
+				const CharType* current = p;
+				GraphemeBreakProperty next = GetGraphemeBreakProperty(DecodeCodePoint(p, last));
+
+				if (!IsGraphemeJoin(prev, next, zwjAfterPictographic, regionalCount))
+					return current;
+
+				if (next == ZWJ)
+					zwjAfterPictographic = pictographicRun;
+				if (next == ExtendedPictographic)
+					pictographicRun = true;
+				else if (next != Extend)
+					pictographicRun = false;
+
+				regionalCount = next == RegionalIndicator ? regionalCount + 1 : 0;
+				prev = next;
+			}
+
+			return last;
+		}
+	}
+
+	// 按用户感知的字符（扩展字素簇）遍历文本，每个字素簇以原文本的子视图给出
+	// 断字规则遵循UAX #29，属性表覆盖常用文字与表情符号，未收录的码点按Other处理
+	template <UtfCharType CharType>
+	class BasicGraphemeView
+	{
+	public:
+		using SourceView = UtfSourceView<CharType>;
+
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using iterator_concept = std::forward_iterator_tag;
+
+			using value_type = SourceView;
+			using difference_type = Isize;
+			using pointer = const value_type*;
+			using reference = value_type;
+
+			Iterator() noexcept = default;
+			Iterator(const CharType* pos, const CharType* end) noexcept : m_pos(pos), m_end(end) { Load(); }
+
+			value_type operator*() const noexcept
+			{
+				DEBUG_VERIFY_REPORT(m_pos != m_end, "cannot dereference end grapheme iterator")
+					return value_type(m_pos, static_cast<Usize>(m_next - m_pos));
+			}
+
+			Iterator& operator++() noexcept
+			{
+				DEBUG_VERIFY_REPORT(m_pos != m_end, "cannot increment end grapheme iterator")
+					m_pos = m_next;
+				Load();
+				return *this;
+			}
+
+			Iterator operator++(int) noexcept
+			{
+				Iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			bool operator==(const Iterator& other) const noexcept
+			{
+				return m_pos == other.m_pos;
+			}
+		private:
+			void Load() noexcept
+			{
+				m_next = m_pos == m_end ? m_end : Detail::NextGraphemeBoundary(m_pos, m_end);
+			}
+
+			const CharType* m_pos = nullptr;
+			const CharType* m_end = nullptr;
+			const CharType* m_next = nullptr;
+		};
+
+		using iterator = Iterator;
+		using const_iterator = Iterator;
+		using ConstIterator = Iterator;
+
+		BasicGraphemeView() noexcept = default;
+		BasicGraphemeView(const CharType* str, Usize len) noexcept : m_str(str), m_size(len) {}
+		explicit BasicGraphemeView(SourceView str) noexcept : m_str(Detail::UtfViewData(str)), m_size(Detail::UtfViewSize(str)) {}
+
+		ConstIterator begin() const noexcept { return Begin(); }
+		ConstIterator end() const noexcept { return End(); }
+
+		ConstIterator Begin() const noexcept { return ConstIterator(m_str, m_str + m_size); }
+		ConstIterator End() const noexcept { return ConstIterator(m_str + m_size, m_str + m_size); }
+
+		SourceView Text() const noexcept { return SourceView(m_str, m_size); }
+		bool Empty() const noexcept { return m_size == 0; }
+
+		// @brief 统计字素簇个数
+		Usize Count() const noexcept;
+	private:
+		const CharType* m_str = nullptr;
+		Usize m_size = 0;
+	};
+
+	template <UtfCharType CharType>
+	Usize BasicGraphemeView<CharType>::Count() const noexcept
+	{
+		Usize count = 0;
+		for (const CharType* p = m_str, *end = m_str + m_size; p != end; p = Detail::NextGraphemeBoundary(p, end))
+			++count;
+		return count;
+	}
+
+	using CodePointView = BasicCodePointView<Ch>;
+	using U16CodePointView = BasicCodePointView<Ch16>;
+	using U32CodePointView = BasicCodePointView<Ch32>;
+
+	using GraphemeView = BasicGraphemeView<Ch>;
+	using U16GraphemeView = BasicGraphemeView<Ch16>;
+	using U32GraphemeView = BasicGraphemeView<Ch32>;
+}
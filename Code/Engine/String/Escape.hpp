@@ -0,0 +1,397 @@
+// File /Engine/String/Escape.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Exception/InvalidArgument.hpp"
+#include "CharSet.hpp"
+#include "String.hpp"
+#include <type_traits>
+
+namespace PenFramework::PenEngine
+{
+	enum class EscapeStyle : U8
+	{
+		// 转义'"'、'\\'与所有控制字符，结果可以直接放入JSON字符串字面量
+		Json,
+		// 转义'\\'、控制字符与DEL，保证一条日志只占一行且不含不可见字符
+		Log,
+		// 使用单引号包裹，内部的'\''写为'\''\\'''，结果可以作为POSIX shell的单个参数
+		Shell
+	};
+
+	namespace Detail
+	{
+		static constexpr Ch EscapeHexDigits[] = "0123456789abcdef";
+
+		static constexpr CharSet JsonEscapeCharSet = CharSet::Range(0x00, 0x1F) | CharSet("\"\\");
+		static constexpr CharSet LogEscapeCharSet = CharSet::Range(0x00, 0x1F) | CharSet("\\\x7F");
+		static constexpr CharSet ShellEscapeCharSet = CharSet("'");
+
+		static constexpr CharSet BackslashCharSet = CharSet("\\");
+		static constexpr CharSet ShellUnquoteCharSet = CharSet("'\\");
+
+		constexpr const CharSet& EscapeCharSetOf(EscapeStyle style) noexcept
+		{
+			switch (style)
+			{
+				case EscapeStyle::Json: return JsonEscapeCharSet;
+				case EscapeStyle::Log: return LogEscapeCharSet;
+				default: return ShellEscapeCharSet;
+			}
+		}
+
+		// @brief 返回单个需要转义的字符转义后的长度
+		template <typename CharType>
+		constexpr Usize EscapeLength(CharType ch, EscapeStyle style) noexcept
+		{
+			switch (ch)
+			{
+				case CharType('\n'):
+				case CharType('\r'):
+				case CharType('\t'):
+				case CharType('\\'):
+				case CharType('"'):
+					return 2;
+				case CharType('\b'):
+				case CharType('\f'):
+					return style == EscapeStyle::Json ? 2 : 4;
+				case CharType('\''):
+					return 4;
+				default:
+					return style == EscapeStyle::Json ? 6 : 4;
+			}
+		}
+
+		template <typename CharType>
+		void AppendEscape(BasicString<CharType>& out, CharType ch, EscapeStyle style)
+		{
+			switch (ch)
+			{
+				case CharType('\n'): out.Append(CharType('\\')); out.Append(CharType('n')); return;
+				case CharType('\r'): out.Append(CharType('\\')); out.Append(CharType('r')); return;
+				case CharType('\t'): out.Append(CharType('\\')); out.Append(CharType('t')); return;
+				case CharType('\\'): out.Append(CharType('\\')); out.Append(CharType('\\')); return;
+				case CharType('"'): out.Append(CharType('\\')); out.Append(CharType('"')); return;
+				case CharType('\''):
+					// 先结束引用，再输出转义后的单引号，最后重新开始引用
+					out.Append(CharType('\''));
+					out.Append(CharType('\\'));
+					out.Append(CharType('\''));
+					out.Append(CharType('\''));
+					return;
+				default:
+					break;
+			}
+
+			auto value = static_cast<U8>(ch);
+			if (style == EscapeStyle::Json)
+			{
+				if (ch == CharType('\b') || ch == CharType('\f'))
+				{
+					out.Append(CharType('\\'));
+					out.Append(ch == CharType('\b') ? CharType('b') : CharType('f'));
+					return;
+				}
+
+				out.Append(CharType('\\'));
+				out.Append(CharType('u'));
+				out.Append(CharType('0'));
+				out.Append(CharType('0'));
+			}
+			else
+			{
+				out.Append(CharType('\\'));
+				out.Append(CharType('x'));
+			}
+
+			out.Append(CharType(EscapeHexDigits[value >> 4]));
+			out.Append(CharType(EscapeHexDigits[value & 0x0F]));
+		}
+
+		[[noreturn]] inline void ThrowInvalidEscape(std::string_view detail)
+		{
+			throw InvalidArgument("Escape", "Function Unescape", detail);
+		}
+
+		template <typename CharType>
+		U32 ParseEscapeHex(const CharType* str, Usize count)
+		{
+			U32 value = 0;
+			for (Usize i = 0; i < count; ++i)
+			{
+				U32 ch = static_cast<U32>(str[i]);
+				U32 digit;
+				if (ch >= '0' && ch <= '9')
+					digit = ch - '0';
+				else if ((ch | 0x20) >= 'a' && (ch | 0x20) <= 'f')
+					digit = (ch | 0x20) - 'a' + 10;
+				else
+					ThrowInvalidEscape("invalid hex digit in escape sequence");
+				value = value << 4 | digit;
+			}
+			return value;
+		}
+
+		// @brief 追加一个码点，Ch按UTF-8编码，Ch32直接写入
+		template <typename CharType>
+		void AppendCodePoint(BasicString<CharType>& out, U32 codePoint)
+		{
+			if constexpr (sizeof(CharType) == 4)
+				out.Append(static_cast<CharType>(codePoint));
+			else if (codePoint < 0x80)
+				out.Append(static_cast<CharType>(codePoint));
+			else if (codePoint < 0x800)
+			{
+				out.Append(static_cast<CharType>(0xC0 | codePoint >> 6));
+				out.Append(static_cast<CharType>(0x80 | (codePoint & 0x3F)));
+			}
+			else if (codePoint < 0x10000)
+			{
+				out.Append(static_cast<CharType>(0xE0 | codePoint >> 12));
+				out.Append(static_cast<CharType>(0x80 | (codePoint >> 6 & 0x3F)));
+				out.Append(static_cast<CharType>(0x80 | (codePoint & 0x3F)));
+			}
+			else
+			{
+				out.Append(static_cast<CharType>(0xF0 | codePoint >> 18));
+				out.Append(static_cast<CharType>(0x80 | (codePoint >> 12 & 0x3F)));
+				out.Append(static_cast<CharType>(0x80 | (codePoint >> 6 & 0x3F)));
+				out.Append(static_cast<CharType>(0x80 | (codePoint & 0x3F)));
+			}
+		}
+
+		// @brief 解析一个以'\\'开头的转义序列
+		// @retval 转义序列的长度
+		template <typename CharType>
+		Usize AppendUnescape(BasicString<CharType>& out, const CharType* str, Usize len, EscapeStyle style)
+		{
+			if (len < 2)
+				ThrowInvalidEscape("incomplete escape sequence");
+
+			switch (str[1])
+			{
+				case CharType('n'): out.Append(CharType('\n')); return 2;
+				case CharType('r'): out.Append(CharType('\r')); return 2;
+				case CharType('t'): out.Append(CharType('\t')); return 2;
+				case CharType('\\'): out.Append(CharType('\\')); return 2;
+				default: break;
+			}
+
+			if (style == EscapeStyle::Log)
+			{
+				if (str[1] != CharType('x') || len < 4)
+					ThrowInvalidEscape("unknown escape sequence");
+				out.Append(static_cast<CharType>(ParseEscapeHex(str + 2, 2)));
+				return 4;
+			}
+
+			switch (str[1])
+			{
+				case CharType('"'): out.Append(CharType('"')); return 2;
+				case CharType('/'): out.Append(CharType('/')); return 2;
+				case CharType('b'): out.Append(CharType('\b')); return 2;
+				case CharType('f'): out.Append(CharType('\f')); return 2;
+				case CharType('u'): break;
+				default: ThrowInvalidEscape("unknown escape sequence");
+			}
+
+			if (len < 6)
+				ThrowInvalidEscape("incomplete unicode escape sequence");
+
+			U32 codePoint = ParseEscapeHex(str + 2, 4);
+			if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+				ThrowInvalidEscape("unpaired low surrogate");
+
+			if (codePoint < 0xD800 || codePoint > 0xDBFF)
+			{
+				AppendCodePoint(out, codePoint);
+				return 6;
+			}
+
+			// 高代理项后必须紧跟低代理项
+			if (len < 12 || str[6] != CharType('\\') || str[7] != CharType('u'))
+				ThrowInvalidEscape("unpaired high surrogate");
+
+			U32 low = ParseEscapeHex(str + 8, 4);
+			if (low < 0xDC00 || low > 0xDFFF)
+				ThrowInvalidEscape("unpaired high surrogate");
+
+			AppendCodePoint(out, 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00));
+			return 12;
+		}
+
+		template <typename CharType>
+		void ShellUnescape(BasicStringView<CharType> src, BasicString<CharType>& out)
+		{
+			const CharType* ptr = src.Data();
+			Usize remaining = src.Size();
+
+			while (remaining != 0)
+			{
+				Usize clean = ShellUnquoteCharSet.FindFirstIn(ptr, remaining);
+				out.Append(ptr, clean);
+				if (clean == remaining)
+					return;
+
+				ptr += clean;
+				remaining -= clean;
+
+				if (*ptr == CharType('\\'))
+				{
+					if (remaining < 2)
+						ThrowInvalidEscape("incomplete escape sequence");
+					out.Append(ptr[1]);
+					ptr += 2;
+					remaining -= 2;
+					continue;
+				}
+
+				// 单引号内的所有字符都按字面处理，直到下一个单引号
+				Usize quoted = ShellEscapeCharSet.FindFirstIn(ptr + 1, remaining - 1);
+				if (quoted == remaining - 1)
+					ThrowInvalidEscape("unterminated quote");
+
+				out.Append(ptr + 1, quoted);
+				ptr += quoted + 2;
+				remaining -= quoted + 2;
+			}
+		}
+	}
+
+	// @brief 计算转义后的精确长度
+	template <typename CharType>
+	Usize EscapedSize(std::type_identity_t<BasicStringView<CharType>> src, EscapeStyle style) noexcept
+	{
+		const CharSet& charSet = Detail::EscapeCharSetOf(style);
+		const CharType* ptr = src.Data();
+		Usize remaining = src.Size();
+		Usize size = style == EscapeStyle::Shell ? src.Size() + 2 : src.Size();
+
+		while (true)
+		{
+			Usize clean = charSet.FindFirstIn(ptr, remaining);
+			if (clean == remaining)
+				return size;
+
+			size += Detail::EscapeLength(ptr[clean], style) - 1;
+			ptr += clean + 1;
+			remaining -= clean + 1;
+		}
+	}
+
+	inline Usize EscapedSize(StringView src, EscapeStyle style) noexcept
+	{
+		return EscapedSize<Ch>(src, style);
+	}
+
+	inline Usize EscapedSize(U32View src, EscapeStyle style) noexcept
+	{
+		return EscapedSize<Ch32>(src, style);
+	}
+
+	// @brief 转义并追加到out末尾，只分配一次
+	// @note 不需要转义的片段整段复制，只在需要的位置写入转义序列
+	template <typename CharType>
+	void Escape(std::type_identity_t<BasicStringView<CharType>> src, BasicString<CharType>& out, EscapeStyle style)
+	{
+		const CharSet& charSet = Detail::EscapeCharSetOf(style);
+		const CharType* ptr = src.Data();
+		Usize remaining = src.Size();
+
+		out.ReserveExtra(EscapedSize<CharType>(src, style));
+
+		if (style == EscapeStyle::Shell)
+			out.Append(CharType('\''));
+
+		while (true)
+		{
+			Usize clean = charSet.FindFirstIn(ptr, remaining);
+			out.Append(ptr, clean);
+			if (clean == remaining)
+				break;
+
+			Detail::AppendEscape(out, ptr[clean], style);
+			ptr += clean + 1;
+			remaining -= clean + 1;
+		}
+
+		if (style == EscapeStyle::Shell)
+			out.Append(CharType('\''));
+	}
+
+	inline String Escape(StringView src, EscapeStyle style)
+	{
+		String res;
+		Escape<Ch>(src, res, style);
+		return res;
+	}
+
+	inline U32String Escape(U32View src, EscapeStyle style)
+	{
+		U32String res;
+		Escape<Ch32>(src, res, style);
+		return res;
+	}
+
+	// @brief 还原转义序列并追加到out末尾
+	// @note 还原后的长度不会超过src，因此按src的长度预留一次空间；序列不合法时抛出InvalidArgument，此时out保持不变
+	// Json会把\uXXXX（包括代理对）还原为码点，String中按UTF-8编码
+	template <typename CharType>
+	void Unescape(std::type_identity_t<BasicStringView<CharType>> src, BasicString<CharType>& out, EscapeStyle style)
+	{
+		Usize oldSize = out.Size();
+		out.ReserveExtra(src.Size());
+
+		try
+		{
+			if (style == EscapeStyle::Shell)
+			{
+				Detail::ShellUnescape(src, out);
+				return;
+			}
+
+			const CharType* ptr = src.Data();
+			Usize remaining = src.Size();
+
+			while (true)
+			{
+				Usize clean = Detail::BackslashCharSet.FindFirstIn(ptr, remaining);
+				out.Append(ptr, clean);
+				if (clean == remaining)
+					break;
+
+				Usize consumed = clean + Detail::AppendUnescape(out, ptr + clean, remaining - clean, style);
+				ptr += consumed;
+				remaining -= consumed;
+			}
+		}
+		catch (...)
+		{
+			out.Resize(oldSize);
+			throw;
+		}
+	}
+
+	inline String Unescape(StringView src, EscapeStyle style)
+	{
+		String res;
+		Unescape<Ch>(src, res, style);
+		return res;
+	}
+
+	inline U32String Unescape(U32View src, EscapeStyle style)
+	{
+		U32String res;
+		Unescape<Ch32>(src, res, style);
+		return res;
+	}
+}
@@ -0,0 +1,251 @@
+// File /Engine/String/LineView.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Utils/Parallel.hpp"
+#include "../Utils/Simd.hpp"
+#include "StringView.hpp"
+#include <atomic>
+#include <iterator>
+#include <vector>
+
+namespace PenFramework::PenEngine
+{
+	// 并行处理时每个分块的最小字节数，文本较小时拆分带来的线程开销大于收益
+	static constexpr Usize LineViewParallelChunkBytes = 1 << 20;
+
+	namespace Detail
+	{
+		// @brief 返回[first, last)中第一个'\n'的位置，不存在时返回last
+		template <typename CharType>
+		const CharType* FindNewline(const CharType* first, const CharType* last) noexcept
+		{
+			const CharType* p = first;
+
+			if constexpr (sizeof(CharType) == 1)
+			{
+				#ifdef SIMD_AVX2_SUPPORT
+				const __m256i newline = _mm256_set1_epi8('\n');
+				// 每次处理64字节，两次比较的掩码合并后只需要一次分支
+				for (; last - p >= 64; p += 64)
+				{
+					u64 low = static_cast<U32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), newline)));
+					u64 high = static_cast<U32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32)), newline)));
+					if (u64 mask = low | high << 32; mask != 0)
+						return p + std::countr_zero(mask);
+				}
+				#endif // SIMD_AVX2_SUPPORT
+
+				#ifdef SIMD_SSE2_SUPPORT
+				const __m128i newline128 = _mm_set1_epi8('\n');
+				for (; last - p >= 16; p += 16)
+				{
+					if (U32 mask = static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), newline128))); mask != 0)
+						return p + std::countr_zero(mask);
+				}
+				#endif // SIMD_SSE2_SUPPORT
+			}
+			else if constexpr (sizeof(CharType) == 4)
+			{
+				#ifdef SIMD_AVX2_SUPPORT
+				const __m256i newline = _mm256_set1_epi32('\n');
+				for (; last - p >= 8; p += 8)
+				{
+					if (U32 mask = static_cast<U32>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), newline))); mask != 0)
+						return p + std::countr_zero(mask) / 4;
+				}
+				#endif // SIMD_AVX2_SUPPORT
+			}
+
+			for (; p != last; ++p)
+			{
+				if (*p == CharType('\n'))
+					return p;
+			}
+
+			return last;
+		}
+	}
+
+	// 按行遍历文本，每一行以不含换行符的BasicStringView给出，不会分配内存
+	// 行以'\n'分隔，行尾的'\r'会被去掉；文本以换行符结尾时不会产生额外的空行
+	template <typename CharType>
+	class BasicLineView
+	{
+	public:
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using iterator_concept = std::forward_iterator_tag;
+
+			using value_type = BasicStringView<CharType>;
+			using difference_type = Isize;
+			using pointer = const value_type*;
+			using reference = value_type;
+
+			Iterator() noexcept = default;
+			Iterator(const CharType* pos, const CharType* end) noexcept : m_pos(pos), m_end(end) { Load(); }
+
+			value_type operator*() const noexcept
+			{
+				DEBUG_VERIFY_REPORT(m_pos != m_end, "cannot dereference end line iterator")
+					return m_line;
+			}
+
+			pointer operator->() const noexcept
+			{
+				DEBUG_VERIFY_REPORT(m_pos != m_end, "cannot dereference end line iterator")
+					return &m_line;
+			}
+
+			Iterator& operator++() noexcept
+			{
+				DEBUG_VERIFY_REPORT(m_pos != m_end, "cannot increment end line iterator")
+					m_pos = m_next;
+				Load();
+				return *this;
+			}
+
+			Iterator operator++(int) noexcept
+			{
+				Iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			bool operator==(const Iterator& other) const noexcept
+			{
+				return m_pos == other.m_pos;
+			}
+		private:
+			void Load() noexcept
+			{
+				if (m_pos == m_end)
+				{
+					m_next = m_end;
+					m_line = value_type();
+					return;
+				}
+
+				const CharType* newline = Detail::FindNewline(m_pos, m_end);
+				const CharType* lineEnd = newline;
+				if (lineEnd != m_pos && lineEnd[-1] == CharType('\r'))
+					--lineEnd;
+
+				m_line = value_type(m_pos, lineEnd);
+				m_next = newline == m_end ? m_end : newline + 1;
+			}
+
+			const CharType* m_pos = nullptr;
+			const CharType* m_end = nullptr;
+			const CharType* m_next = nullptr;
+			value_type m_line;
+		};
+
+		using iterator = Iterator;
+		using const_iterator = Iterator;
+		using ConstIterator = Iterator;
+
+		BasicLineView() noexcept = default;
+		explicit BasicLineView(BasicStringView<CharType> text) noexcept : m_text(text) {}
+
+		ConstIterator begin() const noexcept { return Begin(); }
+		ConstIterator end() const noexcept { return End(); }
+
+		ConstIterator Begin() const noexcept { return ConstIterator(m_text.Data(), m_text.EndData()); }
+		ConstIterator End() const noexcept { return ConstIterator(m_text.EndData(), m_text.EndData()); }
+
+		BasicStringView<CharType> Text() const noexcept { return m_text; }
+		bool Empty() const noexcept { return m_text.Empty(); }
+
+		// @brief 统计行数，只扫描换行符而不会逐行构造视图
+		Usize Count() const noexcept;
+
+		// @brief 在换行符处将文本切分为最多chunkCount块，每一块都只包含完整的行
+		std::vector<BasicLineView> Chunks(Usize chunkCount = HardwareConcurrency()) const;
+
+		// @brief 将文本按行边界切分后并行处理，每个线程处理一块
+		// @param func 形如void(Usize chunkIndex, BasicLineView chunk)的可调用对象，不应抛出异常
+		// @note 块数量由文本大小与maxWorkerCount共同决定，小于LineViewParallelChunkBytes的文本只会产生一块
+		template <typename Func>
+		void ParallelForEachChunk(Func&& func, Usize maxWorkerCount = HardwareConcurrency()) const;
+
+		// @brief 并行统计行数
+		Usize ParallelCount(Usize maxWorkerCount = HardwareConcurrency()) const;
+	private:
+		BasicStringView<CharType> m_text;
+	};
+
+	template <typename CharType>
+	Usize BasicLineView<CharType>::Count() const noexcept
+	{
+		if (m_text.Empty())
+			return 0;
+
+		Usize count = ChCount(CharType('\n'), m_text.Data(), m_text.Size());
+		return m_text.Back() == CharType('\n') ? count : count + 1;
+	}
+
+	template <typename CharType>
+	std::vector<BasicLineView<CharType>> BasicLineView<CharType>::Chunks(Usize chunkCount) const
+	{
+		std::vector<BasicLineView> res;
+		chunkCount = std::max<Usize>(1, chunkCount);
+		res.reserve(chunkCount);
+
+		const CharType* begin = m_text.Data();
+		const CharType* end = m_text.EndData();
+		const CharType* chunkBegin = begin;
+
+		for (Usize i = 1; i <= chunkCount && chunkBegin != end; ++i)
+		{
+			// 从理想的切分点向后找到第一个换行符，保证不会把一行拆开
+			const CharType* target = begin + m_text.Size() / chunkCount * i;
+			const CharType* chunkEnd = end;
+			if (i != chunkCount && target > chunkBegin)
+			{
+				const CharType* newline = Detail::FindNewline(target - 1, end);
+				chunkEnd = newline == end ? end : newline + 1;
+			}
+			else if (i != chunkCount)
+				continue;
+
+			res.emplace_back(BasicStringView<CharType>(chunkBegin, chunkEnd));
+			chunkBegin = chunkEnd;
+		}
+
+		return res;
+	}
+
+	template <typename CharType>
+	template <typename Func>
+	void BasicLineView<CharType>::ParallelForEachChunk(Func&& func, Usize maxWorkerCount) const
+	{
+		Usize chunkCount = std::clamp<Usize>(m_text.Size() * sizeof(CharType) / LineViewParallelChunkBytes, 1, std::max<Usize>(1, maxWorkerCount));
+		std::vector<BasicLineView> chunks = Chunks(chunkCount);
+
+		ParallelFor(chunks.size(), [&](Usize index) { func(index, chunks[index]); }, maxWorkerCount);
+	}
+
+	template <typename CharType>
+	Usize BasicLineView<CharType>::ParallelCount(Usize maxWorkerCount) const
+	{
+		// 每一块都以换行符结尾（最后一块除外），所以各块的行数之和就是总行数
+		std::atomic<Usize> count = 0;
+		ParallelForEachChunk([&](Usize, BasicLineView chunk) { count.fetch_add(chunk.Count(), std::memory_order::relaxed); }, maxWorkerCount);
+		return count.load(std::memory_order::relaxed);
+	}
+
+	using LineView = BasicLineView<Ch>;
+	using U32LineView = BasicLineView<Ch32>;
+}
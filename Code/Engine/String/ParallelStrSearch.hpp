@@ -0,0 +1,303 @@
+// File /Engine/String/ParallelStrSearch.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Utils/Parallel.hpp"
+#include "StrSearchUtils.hpp"
+#include <atomic>
+#include <vector>
+
+namespace PenFramework::PenEngine
+{
+	// 并行查找的执行策略
+	struct ParallelSearchOptions
+	{
+		// 源串字节数小于该值时直接串行查找，拆分带来的线程开销大于收益
+		Usize SerialThreshold = 4 << 20;
+		// 每个分块的最小字节数
+		Usize MinChunkBytes = 1 << 20;
+		Usize MaxWorkerCount = HardwareConcurrency();
+	};
+
+	namespace Detail
+	{
+		// 将匹配的起始位置[0, startCount)均分为若干块，每块在查找时向后多读len - 1个码元，保证跨块的匹配不会丢失
+		class ParallelSearchChunks
+		{
+		public:
+			ParallelSearchChunks(Usize startCount, Usize charSize, const ParallelSearchOptions& options) noexcept :
+				m_startCount(startCount)
+			{
+				if (startCount * charSize < options.SerialThreshold)
+					return;
+
+				Usize minChunkSize = std::max<Usize>(1, options.MinChunkBytes / charSize);
+				m_chunkCount = std::clamp<Usize>(startCount / minChunkSize, 1, std::max<Usize>(1, options.MaxWorkerCount));
+			}
+
+			Usize Count() const noexcept { return m_chunkCount; }
+			Usize Begin(Usize index) const noexcept { return m_startCount / m_chunkCount * index; }
+			Usize End(Usize index) const noexcept { return index + 1 == m_chunkCount ? m_startCount : Begin(index + 1); }
+		private:
+			Usize m_startCount;
+			Usize m_chunkCount = 1;
+		};
+
+		// @brief 在起始位置位于[begin, end)的范围内按顺序枚举匹配，func返回false时停止
+		template <typename CharType, typename Func>
+		void StrForEachMatchInRange(const CharType* str, Usize len, const CharType* source, Usize begin, Usize end, MatchMode mode, Func&& func)
+		{
+			StrForEachMatch(str, len, source + begin, end - begin + len - 1, mode, [&](Usize pos) { return func(begin + pos); });
+		}
+
+		// 子串的匹配有两种合并方式：
+		// 查找第一个/最后一个匹配时，每块独立查找后取最小/最大位置，已经落后于当前结果的块会直接跳过
+		// 不重叠的匹配依赖于前一个匹配的结束位置，所以每块先假设从块首开始贪心匹配，
+		// 合并时若前一块最后一个匹配越过了本块的第一个匹配，则从正确的位置重新扫描本块
+
+		template <typename CharType>
+		Usize ParallelStrFindFirst(const CharType* str, Usize len, const CharType* source, Usize sourceLength, const ParallelSearchOptions& options)
+		{
+			ParallelSearchChunks chunks(sourceLength - len + 1, sizeof(CharType), options);
+			std::atomic<Usize> best = NPos;
+
+			ParallelFor(chunks.Count(), [&](Usize index)
+				{
+					Usize begin = chunks.Begin(index);
+					if (begin >= best.load(std::memory_order::relaxed))
+						return;
+
+					StrForEachMatchInRange(str, len, source, begin, chunks.End(index), MatchMode::Overlapping, [&](Usize pos)
+						{
+							for (Usize current = best.load(std::memory_order::relaxed); pos < current && !best.compare_exchange_weak(current, pos, std::memory_order::relaxed);) {}
+							return false;
+						});
+				}, options.MaxWorkerCount);
+
+			return best.load(std::memory_order::relaxed);
+		}
+
+		template <typename CharType>
+		Usize ParallelStrFindLast(const CharType* str, Usize len, const CharType* source, Usize sourceLength, const ParallelSearchOptions& options)
+		{
+			ParallelSearchChunks chunks(sourceLength - len + 1, sizeof(CharType), options);
+			std::atomic<Usize> best = NPos;
+
+			// 任务按下标顺序领取，这里让靠后的块先执行
+			ParallelFor(chunks.Count(), [&](Usize task)
+				{
+					Usize index = chunks.Count() - 1 - task;
+					Usize end = chunks.End(index);
+					if (Usize current = best.load(std::memory_order::relaxed); current != NPos && end <= current)
+						return;
+
+					Usize last = NPos;
+					StrForEachMatchInRange(str, len, source, chunks.Begin(index), end, MatchMode::Overlapping, [&](Usize pos) { last = pos; return true; });
+					if (last == NPos)
+						return;
+
+					for (Usize current = best.load(std::memory_order::relaxed); (current == NPos || last > current) && !best.compare_exchange_weak(current, last, std::memory_order::relaxed);) {}
+				}, options.MaxWorkerCount);
+
+			return best.load(std::memory_order::relaxed);
+		}
+
+		// @brief 并行枚举全部匹配，sink形如void(Usize chunkIndex, Usize pos)，同一块内的位置按顺序给出
+		// @param rescan 形如void(Usize chunkIndex)的回调，不重叠模式下该块需要重新串行扫描时调用，回调中应丢弃该块已有的结果
+		template <typename CharType, typename Sink, typename Rescan>
+		void ParallelStrForEachMatch(const CharType* str, Usize len, const CharType* source, Usize sourceLength, MatchMode mode, const ParallelSearchOptions& options, Sink&& sink, Rescan&& rescan)
+		{
+			ParallelSearchChunks chunks(sourceLength - len + 1, sizeof(CharType), options);
+
+			struct ChunkState
+			{
+				Usize First = NPos;
+				Usize Last = NPos;
+			};
+			std::vector<ChunkState> states(chunks.Count());
+
+			ParallelFor(chunks.Count(), [&](Usize index)
+				{
+					ChunkState& state = states[index];
+					StrForEachMatchInRange(str, len, source, chunks.Begin(index), chunks.End(index), mode, [&](Usize pos)
+						{
+							if (state.First == NPos)
+								state.First = pos;
+							state.Last = pos;
+							sink(index, pos);
+							return true;
+						});
+				}, options.MaxWorkerCount);
+
+			if (mode == MatchMode::Overlapping || len == 1)
+				return;
+
+			// 串行修正不重叠模式下跨块的贪心匹配
+			Usize next = 0;
+			for (Usize index = 0; index < chunks.Count(); ++index)
+			{
+				ChunkState& state = states[index];
+				if (state.First != NPos && state.First < next)
+				{
+					state.First = NPos;
+					state.Last = NPos;
+					rescan(index);
+					if (next < chunks.End(index))
+					{
+						StrForEachMatchInRange(str, len, source, next, chunks.End(index), mode, [&](Usize pos)
+							{
+								state.Last = pos;
+								sink(index, pos);
+								return true;
+							});
+					}
+				}
+
+				if (state.Last != NPos)
+					next = state.Last + len;
+			}
+		}
+	}
+
+	// @brief 并行查找子串第一次出现的位置，空串返回0
+	template <typename CharType>
+	Usize ParallelStrFind(const CharType* str, Usize len, const CharType* source, Usize sourceLength, const ParallelSearchOptions& options = {})
+	{
+		if (len > sourceLength)
+			return NPos;
+		if (len == 0)
+			return 0;
+
+		return Detail::ParallelStrFindFirst(str, len, source, sourceLength, options);
+	}
+
+	// @brief 并行查找ch第一次出现的位置
+	template <typename CharType>
+	Usize ParallelChFind(CharType ch, const CharType* source, Usize sourceLength, const ParallelSearchOptions& options = {})
+	{
+		return ParallelStrFind(&ch, 1, source, sourceLength, options);
+	}
+
+	// @brief 并行查找子串最后一次出现的位置，空串返回sourceLength
+	template <typename CharType>
+	Usize ParallelStrFindLast(const CharType* str, Usize len, const CharType* source, Usize sourceLength, const ParallelSearchOptions& options = {})
+	{
+		if (len > sourceLength)
+			return NPos;
+		if (len == 0)
+			return sourceLength;
+
+		return Detail::ParallelStrFindLast(str, len, source, sourceLength, options);
+	}
+
+	// @brief 并行查找ch最后一次出现的位置
+	template <typename CharType>
+	Usize ParallelChFindLast(CharType ch, const CharType* source, Usize sourceLength, const ParallelSearchOptions& options = {})
+	{
+		return ParallelStrFindLast(&ch, 1, source, sourceLength, options);
+	}
+
+	// @brief 并行查找第一个属于str的字符
+	template <typename CharType>
+	Usize ParallelStrFindFirstOf(const CharType* str, Usize len, const CharType* source, Usize sourceLength, const ParallelSearchOptions& options = {})
+	{
+		if (len == 0 || sourceLength == 0)
+			return NPos;
+
+		Detail::ParallelSearchChunks chunks(sourceLength, sizeof(CharType), options);
+		std::atomic<Usize> best = NPos;
+
+		ParallelFor(chunks.Count(), [&](Usize index)
+			{
+				Usize begin = chunks.Begin(index);
+				if (begin >= best.load(std::memory_order::relaxed))
+					return;
+
+				Usize pos = StrFindFirstOf(str, 0, len, source + begin, chunks.End(index) - begin);
+				if (pos == NPos)
+					return;
+
+				pos += begin;
+				for (Usize current = best.load(std::memory_order::relaxed); pos < current && !best.compare_exchange_weak(current, pos, std::memory_order::relaxed);) {}
+			}, options.MaxWorkerCount);
+
+		return best.load(std::memory_order::relaxed);
+	}
+
+	// @brief 并行统计ch出现的次数
+	template <typename CharType>
+	Usize ParallelChCount(CharType ch, const CharType* source, Usize sourceLength, const ParallelSearchOptions& options = {})
+	{
+		Detail::ParallelSearchChunks chunks(sourceLength, sizeof(CharType), options);
+		std::atomic<Usize> count = 0;
+
+		ParallelFor(chunks.Count(), [&](Usize index)
+			{
+				Usize begin = chunks.Begin(index);
+				count.fetch_add(ChCount(ch, source + begin, chunks.End(index) - begin), std::memory_order::relaxed);
+			}, options.MaxWorkerCount);
+
+		return count.load(std::memory_order::relaxed);
+	}
+
+	// @brief 并行统计子串出现的次数，空串的次数为0
+	template <typename CharType>
+	Usize ParallelStrCount(const CharType* str, Usize len, const CharType* source, Usize sourceLength, MatchMode mode, const ParallelSearchOptions& options = {})
+	{
+		if (len == 0 || len > sourceLength)
+			return 0;
+		if (len == 1)
+			return ParallelChCount(*str, source, sourceLength, options);
+
+		Detail::ParallelSearchChunks chunks(sourceLength - len + 1, sizeof(CharType), options);
+		std::vector<Usize> counts(chunks.Count());
+
+		Detail::ParallelStrForEachMatch(str, len, source, sourceLength, mode, options,
+			[&](Usize index, Usize) { ++counts[index]; },
+			[&](Usize index) { counts[index] = 0; });
+
+		Usize count = 0;
+		for (Usize n : counts)
+			count += n;
+		return count;
+	}
+
+	// @brief 并行查找子串出现的全部位置并按顺序追加到out末尾
+	template <typename CharType>
+	void ParallelStrFindAll(const CharType* str, Usize len, const CharType* source, Usize sourceLength, MatchMode mode, std::vector<Usize>& out, const ParallelSearchOptions& options = {})
+	{
+		if (len == 0 || len > sourceLength)
+			return;
+
+		Detail::ParallelSearchChunks chunks(sourceLength - len + 1, sizeof(CharType), options);
+		std::vector<std::vector<Usize>> positions(chunks.Count());
+
+		Detail::ParallelStrForEachMatch(str, len, source, sourceLength, mode, options,
+			[&](Usize index, Usize pos) { positions[index].push_back(pos); },
+			[&](Usize index) { positions[index].clear(); });
+
+		Usize total = 0;
+		for (const std::vector<Usize>& chunk : positions)
+			total += chunk.size();
+
+		out.reserve(out.size() + total);
+		for (const std::vector<Usize>& chunk : positions)
+			out.insert(out.end(), chunk.begin(), chunk.end());
+	}
+
+	// @brief 并行查找ch出现的全部位置并追加到out末尾
+	template <typename CharType>
+	void ParallelChFindAll(CharType ch, const CharType* source, Usize sourceLength, std::vector<Usize>& out, const ParallelSearchOptions& options = {})
+	{
+		ParallelStrFindAll(&ch, 1, source, sourceLength, MatchMode::Overlapping, out, options);
+	}
+}
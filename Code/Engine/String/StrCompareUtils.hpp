@@ -0,0 +1,204 @@
+// File /Engine/String/StrCompareUtils.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Utils/Simd.hpp"
+#include <algorithm>
+#include <compare>
+#include <string>
+
+namespace PenFramework::PenEngine
+{
+	struct StringCompareResult
+	{
+		std::strong_ordering Ordering;
+		// 第一个不同码元的下标，一方是另一方的前缀时为较短一方的长度，两者相等时为字符串长度
+		Usize MismatchIndex;
+	};
+
+	// @brief 返回两段内存中第一个不同字节的下标，完全相同时返回byteCount
+	inline Usize ByteMismatch(const void* lhs, const void* rhs, Usize byteCount) noexcept
+	{
+		const U8* l = static_cast<const U8*>(lhs);
+		const U8* r = static_cast<const U8*>(rhs);
+		Usize i = 0;
+
+		#ifdef SIMD_AVX2_SUPPORT
+		for (; i + 32 <= byteCount; i += 32)
+		{
+			__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(l + i));
+			__m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(r + i));
+			U32 mask = ~static_cast<U32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+			if (mask != 0)
+				return i + static_cast<Usize>(std::countr_zero(mask));
+		}
+		#endif // SIMD_AVX2_SUPPORT
+
+		#ifdef SIMD_SSE2_SUPPORT
+		for (; i + 16 <= byteCount; i += 16)
+		{
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(l + i));
+			__m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r + i));
+			U32 mask = ~static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) & 0xFFFF;
+			if (mask != 0)
+				return i + static_cast<Usize>(std::countr_zero(mask));
+		}
+		#endif // SIMD_SSE2_SUPPORT
+
+		for (; i + 8 <= byteCount; i += 8)
+		{
+			u64 diff = Simd::LoadU64(l + i) ^ Simd::LoadU64(r + i);
+			if (diff != 0)
+				return i + static_cast<Usize>(std::countr_zero(diff)) / BitsPerBytes;
+		}
+
+		for (; i < byteCount; ++i)
+		{
+			if (l[i] != r[i])
+				return i;
+		}
+
+		return byteCount;
+	}
+
+	// @brief 返回两个字符串中第一个不同码元的下标，完全相同时返回len
+	template <typename CharType>
+	Usize StrMismatch(const CharType* lhs, const CharType* rhs, Usize len) noexcept
+	{
+		// 按字节比较后换算成码元下标，所有字符宽度共用同一个向量化内核
+		return ByteMismatch(lhs, rhs, len * sizeof(CharType)) / sizeof(CharType);
+	}
+
+	template <typename CharType>
+	StringCompareResult StrCompare(const CharType* lhs, Usize lhsLength, const CharType* rhs, Usize rhsLength) noexcept
+	{
+		Usize len = std::min(lhsLength, rhsLength);
+		Usize index = StrMismatch(lhs, rhs, len);
+
+		if (index != len)
+		{
+			bool less = std::char_traits<CharType>::lt(lhs[index], rhs[index]);
+			return { less ? std::strong_ordering::less : std::strong_ordering::greater,index };
+		}
+
+		return { lhsLength <=> rhsLength,index };
+	}
+
+	template <typename CharType>
+	constexpr bool IsAsciiDigit(CharType ch) noexcept
+	{
+		return ch >= CharType('0') && ch <= CharType('9');
+	}
+
+	// @brief 返回从off开始的连续ASCII数字的结束位置
+	template <typename CharType>
+	Usize DigitRunEnd(const CharType* source, Usize off, Usize sourceLength) noexcept
+	{
+		Usize i = off;
+
+		#ifdef SIMD_SSE2_SUPPORT
+		if constexpr (sizeof(CharType) == 1)
+		{
+			// (c - '0')按无符号饱和减9后为0，说明c是数字
+			const __m128i zero = _mm_set1_epi8('0');
+			const __m128i nine = _mm_set1_epi8(9);
+
+			for (; i + 16 <= sourceLength; i += 16)
+			{
+				__m128i v = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i)), zero);
+				U32 digitMask = static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(v, nine), _mm_setzero_si128())));
+				if (digitMask != 0xFFFF)
+					return i + static_cast<Usize>(std::countr_zero(~digitMask));
+			}
+		}
+		#endif // SIMD_SSE2_SUPPORT
+
+		while (i < sourceLength && IsAsciiDigit(source[i]))
+			++i;
+
+		return i;
+	}
+
+	// @brief 自然顺序比较，连续的数字按数值比较，例如"file9" < "file10"
+	// 数值相同时前导0较少的一方较小，其余部分按码元比较
+	template <typename CharType>
+	std::strong_ordering StrNaturalCompare(const CharType* lhs, Usize lhsLength, const CharType* rhs, Usize rhsLength) noexcept
+	{
+		Usize i = 0;
+		Usize j = 0;
+		std::strong_ordering tieBreak = std::strong_ordering::equal;
+
+		while (true)
+		{
+			// 快速跳过完全相同的片段
+			Usize common = StrMismatch(lhs + i, rhs + j, std::min(lhsLength - i, rhsLength - j));
+			i += common;
+			j += common;
+
+			bool lhsDigit = i < lhsLength && IsAsciiDigit(lhs[i]);
+			bool rhsDigit = j < rhsLength && IsAsciiDigit(rhs[j]);
+
+			// 不同点落在数字串中间时，需要回退到数字串开头再按数值比较
+			if (lhsDigit || rhsDigit)
+			{
+				while (common > 0 && IsAsciiDigit(lhs[i - 1]))
+				{
+					--i;
+					--j;
+					--common;
+				}
+
+				lhsDigit = i < lhsLength && IsAsciiDigit(lhs[i]);
+				rhsDigit = j < rhsLength && IsAsciiDigit(rhs[j]);
+			}
+
+			if (!lhsDigit || !rhsDigit)
+			{
+				if (i == lhsLength || j == rhsLength)
+				{
+					if (i == lhsLength && j == rhsLength)
+						return tieBreak;
+					return i == lhsLength ? std::strong_ordering::less : std::strong_ordering::greater;
+				}
+
+				return std::char_traits<CharType>::lt(lhs[i], rhs[j]) ? std::strong_ordering::less : std::strong_ordering::greater;
+			}
+
+			Usize lhsEnd = DigitRunEnd(lhs, i, lhsLength);
+			Usize rhsEnd = DigitRunEnd(rhs, j, rhsLength);
+
+			Usize lhsSignificant = i;
+			while (lhsSignificant + 1 < lhsEnd && lhs[lhsSignificant] == CharType('0'))
+				++lhsSignificant;
+
+			Usize rhsSignificant = j;
+			while (rhsSignificant + 1 < rhsEnd && rhs[rhsSignificant] == CharType('0'))
+				++rhsSignificant;
+
+			// 有效位数多的数值更大，位数相同时逐位比较
+			Usize lhsDigits = lhsEnd - lhsSignificant;
+			Usize rhsDigits = rhsEnd - rhsSignificant;
+			if (lhsDigits != rhsDigits)
+				return lhsDigits <=> rhsDigits;
+
+			Usize index = StrMismatch(lhs + lhsSignificant, rhs + rhsSignificant, lhsDigits);
+			if (index != lhsDigits)
+				return lhs[lhsSignificant + index] <=> rhs[rhsSignificant + index];
+
+			if (tieBreak == std::strong_ordering::equal)
+				tieBreak = (lhsSignificant - i) <=> (rhsSignificant - j);
+
+			i = lhsEnd;
+			j = rhsEnd;
+		}
+	}
+}
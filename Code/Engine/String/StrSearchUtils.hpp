@@ -12,7 +12,10 @@
 
 #include "../Common/Type.hpp"
 #include "../Utils/Concept.hpp"
+#include "../Utils/Simd.hpp"
+#include <span>
 #include <string>
+#include <vector>
 
 namespace PenFramework::PenEngine
 {
@@ -46,7 +49,7 @@ namespace PenFramework::PenEngine
 		return static_cast<Usize>(res - source);
 		#endif // _USE_STD_VECTOR_ALGORITHMS
 
-		const CharType* match = std::char_traits<CharType>::find(source, sourceLength, ch);
+		const CharType* match = std::char_traits<CharType>::find(sourceStart, static_cast<Usize>(sourceEnd - sourceStart), ch);
 		if (match == nullptr)
 			return NPos;
 
@@ -107,7 +110,7 @@ namespace PenFramework::PenEngine
 		return static_cast<Usize>(res - source);
 		#endif // _USE_STD_VECTOR_ALGORITHMS
 
-		const CharType* match = std::char_traits<CharType>::find(source, sourceLength, ch);
+		const CharType* match = std::char_traits<CharType>::find(sourceStart, static_cast<Usize>(sourceEnd - sourceStart), ch);
 		if (match == nullptr)
 			return NPos;
 
@@ -359,4 +362,225 @@ namespace PenFramework::PenEngine
 		return NPos;
 	}
 
+	// 子串批量查找时相邻匹配之间的关系
+	enum class MatchMode : U8
+	{
+		// 匹配之间不重叠，找到一个匹配后从其末尾继续查找，例如在"aaaa"中查找"aa"得到0, 2
+		NonOverlapping,
+		// 每个位置都会被检查，例如在"aaaa"中查找"aa"得到0, 1, 2
+		Overlapping
+	};
+
+	namespace Detail
+	{
+		// 一次比较一个向量宽度的码元，得到每个码元一位的相等掩码
+		// Width为0表示当前字符宽度或指令集没有向量路径
+		template <typename CharType>
+		struct SimdCharBlock
+		{
+			static constexpr Usize Width = 0;
+		};
+
+		#if defined(SIMD_AVX2_SUPPORT)
+		template <typename CharType> requires(sizeof(CharType) == 1)
+		struct SimdCharBlock<CharType>
+		{
+			static constexpr Usize Width = 32;
+			static __m256i Broadcast(CharType ch) noexcept { return _mm256_set1_epi8(static_cast<char>(ch)); }
+			static U32 EqualMask(const CharType* p, __m256i v) noexcept
+			{
+				return static_cast<U32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), v)));
+			}
+		};
+
+		template <typename CharType> requires(sizeof(CharType) == 4)
+		struct SimdCharBlock<CharType>
+		{
+			static constexpr Usize Width = 8;
+			static __m256i Broadcast(CharType ch) noexcept { return _mm256_set1_epi32(static_cast<int>(ch)); }
+			static U32 EqualMask(const CharType* p, __m256i v) noexcept
+			{
+				return static_cast<U32>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), v))));
+			}
+		};
+		#elif defined(SIMD_SSE2_SUPPORT)
+		template <typename CharType> requires(sizeof(CharType) == 1)
+		struct SimdCharBlock<CharType>
+		{
+			static constexpr Usize Width = 16;
+			static __m128i Broadcast(CharType ch) noexcept { return _mm_set1_epi8(static_cast<char>(ch)); }
+			static U32 EqualMask(const CharType* p, __m128i v) noexcept
+			{
+				return static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), v)));
+			}
+		};
+
+		template <typename CharType> requires(sizeof(CharType) == 4)
+		struct SimdCharBlock<CharType>
+		{
+			static constexpr Usize Width = 4;
+			static __m128i Broadcast(CharType ch) noexcept { return _mm_set1_epi32(static_cast<int>(ch)); }
+			static U32 EqualMask(const CharType* p, __m128i v) noexcept
+			{
+				return static_cast<U32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), v))));
+			}
+		};
+		#endif // SIMD_AVX2_SUPPORT
+
+		// @brief 按顺序对每个等于ch的位置调用func，func返回false时停止
+		// @retval 是否遍历完全部匹配
+		template <typename CharType, typename Func>
+		bool ChForEachMatch(CharType ch, const CharType* source, Usize sourceLength, Func&& func)
+		{
+			using Block = SimdCharBlock<CharType>;
+			Usize i = 0;
+
+			if constexpr (Block::Width != 0)
+			{
+				auto v = Block::Broadcast(ch);
+				for (; i + Block::Width <= sourceLength; i += Block::Width)
+				{
+					for (U32 mask = Block::EqualMask(source + i, v); mask != 0;)
+					{
+						if (!func(i + Simd::PopLowestBit(mask)))
+							return false;
+					}
+				}
+			}
+
+			for (; i < sourceLength; ++i)
+			{
+				if (source[i] == ch && !func(i))
+					return false;
+			}
+
+			return true;
+		}
+
+		// @brief 按顺序对子串的每个匹配位置调用func，func返回false时停止
+		// @note 先用首尾两个码元同时筛选候选位置，再逐个比较中间部分；len为0时没有任何匹配
+		template <typename CharType, typename Func>
+		bool StrForEachMatch(const CharType* str, Usize len, const CharType* source, Usize sourceLength, MatchMode mode, Func&& func)
+		{
+			if (len == 0 || len > sourceLength)
+				return true;
+
+			if (len == 1)
+				return ChForEachMatch(*str, source, sourceLength, std::forward<Func>(func));
+
+			using Block = SimdCharBlock<CharType>;
+			Usize lastStart = sourceLength - len;
+			Usize next = 0;
+			Usize i = 0;
+
+			auto accept = [&](Usize pos)
+				{
+					next = mode == MatchMode::Overlapping ? pos + 1 : pos + len;
+					return func(pos);
+				};
+
+			if constexpr (Block::Width != 0)
+			{
+				auto first = Block::Broadcast(str[0]);
+				auto last = Block::Broadcast(str[len - 1]);
+
+				for (; i + Block::Width <= lastStart + 1; i += Block::Width)
+				{
+					U32 mask = Block::EqualMask(source + i, first) & Block::EqualMask(source + i + len - 1, last);
+					while (mask != 0)
+					{
+						Usize pos = i + Simd::PopLowestBit(mask);
+						if (pos >= next && std::char_traits<CharType>::compare(source + pos + 1, str + 1, len - 2) == 0 && !accept(pos))
+							return false;
+					}
+				}
+			}
+
+			for (i = std::max(i, next); i <= lastStart; ++i)
+			{
+				if (i >= next && source[i] == str[0] && std::char_traits<CharType>::compare(source + i + 1, str + 1, len - 1) == 0 && !accept(i))
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	// @brief 统计ch出现的次数
+	template <typename CharType>
+	Usize ChCount(CharType ch, const CharType* source, Usize sourceLength) noexcept
+	{
+		using Block = Detail::SimdCharBlock<CharType>;
+		Usize i = 0;
+		Usize count = 0;
+
+		if constexpr (Block::Width != 0)
+		{
+			auto v = Block::Broadcast(ch);
+			for (; i + Block::Width <= sourceLength; i += Block::Width)
+				count += static_cast<Usize>(std::popcount(Block::EqualMask(source + i, v)));
+		}
+
+		for (; i < sourceLength; ++i)
+			count += source[i] == ch;
+
+		return count;
+	}
+
+	// @brief 统计子串出现的次数，空串的次数为0
+	template <typename CharType>
+	Usize StrCount(const CharType* str, Usize len, const CharType* source, Usize sourceLength, MatchMode mode) noexcept
+	{
+		if (len == 1)
+			return ChCount(*str, source, sourceLength);
+
+		Usize count = 0;
+		Detail::StrForEachMatch(str, len, source, sourceLength, mode, [&](Usize) { ++count; return true; });
+		return count;
+	}
+
+	// @brief 将ch出现的位置依次写入out，写满后停止
+	// @retval 写入的位置个数
+	template <typename CharType>
+	Usize ChFindAll(CharType ch, const CharType* source, Usize sourceLength, std::span<Usize> out) noexcept
+	{
+		Usize written = 0;
+		if (out.empty())
+			return 0;
+
+		Detail::ChForEachMatch(ch, source, sourceLength, [&](Usize pos)
+			{
+				out[written++] = pos;
+				return written != out.size();
+			});
+		return written;
+	}
+
+	// @brief 将ch出现的位置全部追加到out末尾
+	template <typename CharType>
+	void ChFindAll(CharType ch, const CharType* source, Usize sourceLength, std::vector<Usize>& out)
+	{
+		Detail::ChForEachMatch(ch, source, sourceLength, [&](Usize pos) { out.push_back(pos); return true; });
+	}
+
+	template <typename CharType>
+	Usize StrFindAll(const CharType* str, Usize len, const CharType* source, Usize sourceLength, MatchMode mode, std::span<Usize> out) noexcept
+	{
+		Usize written = 0;
+		if (out.empty())
+			return 0;
+
+		Detail::StrForEachMatch(str, len, source, sourceLength, mode, [&](Usize pos)
+			{
+				out[written++] = pos;
+				return written != out.size();
+			});
+		return written;
+	}
+
+	template <typename CharType>
+	void StrFindAll(const CharType* str, Usize len, const CharType* source, Usize sourceLength, MatchMode mode, std::vector<Usize>& out)
+	{
+		Detail::StrForEachMatch(str, len, source, sourceLength, mode, [&](Usize pos) { out.push_back(pos); return true; });
+	}
 }
@@ -11,9 +11,11 @@
 #pragma once
 
 #include "../Common/Type.hpp"
+#include "../Container/SmallVector.hpp"
 #include "../DebugTools/Verify.hpp"
 #include "../Exception/Exception.hpp"
 #include "../Memory/Memory.hpp"
+#include "../Memory/Utils.hpp"
 #include "../Utils/Concept.hpp"
 #include "../Utils/Iterator.hpp"
 #include "StringView.hpp"
@@ -146,6 +148,17 @@ namespace PenFramework::PenEngine
 		bool operator==(std::basic_string_view<CharType> str) const noexcept;
 		bool operator==(CharType ch) const noexcept;
 
+		std::strong_ordering operator<=>(const BasicString& str) const noexcept;
+		std::strong_ordering operator<=>(BasicStringView<CharType> str) const noexcept;
+		std::strong_ordering operator<=>(const CharType* str) const noexcept;
+		std::strong_ordering operator<=>(const std::basic_string<CharType>& str) const noexcept;
+		std::strong_ordering operator<=>(std::basic_string_view<CharType> str) const noexcept;
+
+		// @brief 三路比较，同时返回第一个不同码元的下标
+		StringCompareResult Compare(BasicStringView<CharType> str) const noexcept;
+		// @brief 自然顺序比较，连续的数字按数值比较
+		std::strong_ordering NaturalCompare(BasicStringView<CharType> str) const noexcept;
+
 		Usize Size() const noexcept;
 		Usize Capacity() const noexcept;
 		bool Empty() const noexcept;
@@ -164,7 +177,8 @@ namespace PenFramework::PenEngine
 		BasicString Right(Usize len) const;
 		BasicString Left(Usize len) const;
 
-		std::vector<BasicString> Split(CharType ch) const;
+		// @brief 按ch切分，相邻的分隔符之间得到空串
+		SmallVector<BasicString, 4> Split(CharType ch) const;
 
 		void Clear() noexcept;
 
@@ -327,6 +341,29 @@ namespace PenFramework::PenEngine
 		Usize FindLastNotOf(const CharType* str, Usize off, Usize len) const noexcept;
 		Usize FindLastNotOf(const std::basic_string<CharType>& str, Usize off = NPos) const noexcept;
 		Usize FindLastNotOf(std::basic_string_view<CharType> str, Usize off = NPos) const noexcept;
+
+		// @brief 统计字符或子串出现的次数，空串的次数为0
+		Usize Count(CharType ch) const noexcept;
+		Usize Count(BasicStringView<CharType> str, MatchMode mode = MatchMode::NonOverlapping) const noexcept;
+
+		// @brief 按顺序写入所有匹配位置，写入span时写满即停止并返回写入个数，写入vector时追加全部位置
+		Usize FindAll(CharType ch, std::span<Usize> out) const noexcept;
+		Usize FindAll(BasicStringView<CharType> str, std::span<Usize> out, MatchMode mode = MatchMode::NonOverlapping) const noexcept;
+		void FindAll(CharType ch, std::vector<Usize>& out) const;
+		void FindAll(BasicStringView<CharType> str, std::vector<Usize>& out, MatchMode mode = MatchMode::NonOverlapping) const;
+		std::vector<Usize> FindAll(CharType ch) const;
+		std::vector<Usize> FindAll(BasicStringView<CharType> str, MatchMode mode = MatchMode::NonOverlapping) const;
+
+		// @brief 多线程版本的查找与统计，源串小于options.SerialThreshold时退化为串行执行
+		Usize ParallelFind(CharType ch, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelFind(BasicStringView<CharType> str, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelFindLast(CharType ch, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelFindLast(BasicStringView<CharType> str, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelFindFirstOf(BasicStringView<CharType> str, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelCount(CharType ch, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelCount(BasicStringView<CharType> str, MatchMode mode = MatchMode::NonOverlapping, const ParallelSearchOptions& options = {}) const;
+		std::vector<Usize> ParallelFindAll(CharType ch, const ParallelSearchOptions& options = {}) const;
+		std::vector<Usize> ParallelFindAll(BasicStringView<CharType> str, MatchMode mode = MatchMode::NonOverlapping, const ParallelSearchOptions& options = {}) const;
 	protected:
 		void ResetSizeAndEos(Usize size) noexcept;
 
@@ -387,7 +424,7 @@ namespace PenFramework::PenEngine
 
 			m_size = count;
 
-			CharTraits::assign(m_buffer.Stack, count, ch);
+			MemorySet(m_buffer.Stack, ch, count);
 			m_buffer.Stack[count] = CharType();
 		}
 		else
@@ -396,7 +433,7 @@ namespace PenFramework::PenEngine
 
 			m_size = count;
 
-			CharTraits::assign(m_buffer.Heap, count, ch);
+			MemorySet(m_buffer.Heap, ch, count);
 			m_buffer.Heap[count] = CharType();
 		}
 	}
@@ -413,7 +450,7 @@ namespace PenFramework::PenEngine
 		{
 			InitSSOBuffer();
 
-			CharTraits::copy(m_buffer.Stack, str, length);
+			MemoryCopy(str, m_buffer.Stack, length);
 
 			m_size = length;
 			m_buffer.Stack[length] = CharType();
@@ -422,7 +459,7 @@ namespace PenFramework::PenEngine
 		{
 			InitHeapBuffer(length);
 
-			CharTraits::copy(m_buffer.Heap, str, length);
+			MemoryCopy(str, m_buffer.Heap, length);
 
 			m_size = length;
 			m_buffer.Heap[length] = CharType();
@@ -600,13 +637,13 @@ namespace PenFramework::PenEngine
 	template <typename CharType>
 	bool BasicString<CharType>::operator==(const BasicString& str) const noexcept
 	{
-		return Size() == str.Size() && CharTraits::compare(Data(), str.Data(), Size()) == 0;
+		return Size() == str.Size() && MemoryCompare(Data(), str.Data(), Size()) == 0;
 	}
 
 	template <typename CharType>
 	bool BasicString<CharType>::operator==(BasicStringView<CharType> str) const noexcept
 	{
-		return Size() == str.Size() && CharTraits::compare(Data(), str.Data(), Size()) == 0;
+		return Size() == str.Size() && MemoryCompare(Data(), str.Data(), Size()) == 0;
 	}
 
 	template <typename CharType>
@@ -624,7 +661,7 @@ namespace PenFramework::PenEngine
 	template <typename CharType>
 	bool BasicString<CharType>::operator==(std::basic_string_view<CharType> str) const noexcept
 	{
-		return CharTraits::compare(Data(), str.data(), Size()) == 0 && str.size() == Size();
+		return str.size() == Size() && MemoryCompare(Data(), str.data(), Size()) == 0;
 	}
 
 	template <typename CharType>
@@ -633,6 +670,48 @@ namespace PenFramework::PenEngine
 		return Size() == 1 && Buffer()[0] == ch;
 	}
 
+	template <typename CharType>
+	std::strong_ordering BasicString<CharType>::operator<=>(const BasicString& str) const noexcept
+	{
+		return StrCompare(Data(), Size(), str.Data(), str.Size()).Ordering;
+	}
+
+	template <typename CharType>
+	std::strong_ordering BasicString<CharType>::operator<=>(BasicStringView<CharType> str) const noexcept
+	{
+		return StrCompare(Data(), Size(), str.Data(), str.Size()).Ordering;
+	}
+
+	template <typename CharType>
+	std::strong_ordering BasicString<CharType>::operator<=>(const CharType* str) const noexcept
+	{
+		return StrCompare(Data(), Size(), str, CharTraits::length(str)).Ordering;
+	}
+
+	template <typename CharType>
+	std::strong_ordering BasicString<CharType>::operator<=>(const std::basic_string<CharType>& str) const noexcept
+	{
+		return StrCompare(Data(), Size(), str.data(), str.size()).Ordering;
+	}
+
+	template <typename CharType>
+	std::strong_ordering BasicString<CharType>::operator<=>(std::basic_string_view<CharType> str) const noexcept
+	{
+		return StrCompare(Data(), Size(), str.data(), str.size()).Ordering;
+	}
+
+	template <typename CharType>
+	StringCompareResult BasicString<CharType>::Compare(BasicStringView<CharType> str) const noexcept
+	{
+		return StrCompare(Data(), Size(), str.Data(), str.Size());
+	}
+
+	template <typename CharType>
+	std::strong_ordering BasicString<CharType>::NaturalCompare(BasicStringView<CharType> str) const noexcept
+	{
+		return StrNaturalCompare(Data(), Size(), str.Data(), str.Size());
+	}
+
 	template <typename CharType>
 	Usize BasicString<CharType>::Size() const noexcept
 	{
@@ -674,14 +753,12 @@ namespace PenFramework::PenEngine
 	{
 		if (Usize currentSize = Size(); size > currentSize)
 		{
-			ReserveExtra(size);
-			CharType* buffer = Buffer();
-
-			CharTraits::assign(buffer + currentSize, size, ch);
-			buffer[currentSize + size] =  CharType();
+			Reserve(size);
+			MemorySet(Buffer() + currentSize, ch, size - currentSize);
 		}
 
 		m_size = size;
+		Buffer()[m_size] = CharType();
 	}
 
 	template <typename CharType>
@@ -744,19 +821,21 @@ namespace PenFramework::PenEngine
 	}
 
 	template <typename CharType>
-	std::vector<BasicString<CharType>> BasicString<CharType>::Split(CharType ch) const
+	SmallVector<BasicString<CharType>, 4> BasicString<CharType>::Split(CharType ch) const
 	{
-		Usize off = 0;
 		Usize st = 0;
-		std::vector<BasicString> res;
-		while (off != NPos)
+		SmallVector<BasicString, 4> res;
+		while (true)
 		{
-			off = Find(ch, off);
-			res.emplace_back(Substr(st, off));
-			st = off;
+			Usize off = Find(ch, st);
+			if (off == NPos)
+			{
+				res.emplace_back(Substr(st));
+				return res;
+			}
+			res.emplace_back(Substr(st, off - st));
+			st = off + 1;
 		}
-
-		return res;
 	}
 
 	template <typename CharType>
@@ -802,7 +881,7 @@ namespace PenFramework::PenEngine
 		ReserveExtra(len);
 		Usize size = Size();
 		CharType* buffer = Buffer();
-		memcpy(buffer + size, str, len);
+		MemoryCopy(str, buffer + size, len);
 
 		ResetSizeAndEos(size + len);
 	}
@@ -825,7 +904,7 @@ namespace PenFramework::PenEngine
 
 		CharType* buffer = Buffer();
 
-		buffer[m_size] = CharType();
+		buffer[m_size] = ch;
 		m_size += 1;
 		buffer[m_size] = CharType();
 	}
@@ -841,7 +920,7 @@ namespace PenFramework::PenEngine
 		CharType* buffer = Buffer();
 		Usize size = Size();
 
-		CharTraits::assign(buffer + size, count, ch);
+		MemorySet(buffer + size, ch, count);
 
 		m_size += count;
 		buffer[m_size] = CharType();
@@ -1086,9 +1165,9 @@ namespace PenFramework::PenEngine
 		CharType* buffer = Buffer();
 		Usize size = Size();
 
-		std::copy_backward(buffer, buffer + size, buffer + size + len);
+		MemoryMove(buffer, buffer + len, size);
 
-		memcpy(buffer, str, len * sizeof(CharType));
+		MemoryCopy(str, buffer, len);
 
 		ResetSizeAndEos(size + len);
 	}
@@ -1104,10 +1183,10 @@ namespace PenFramework::PenEngine
 		CharType* buffer = Buffer();
 		Usize size = Size();
 
-		std::copy_backward(buffer, buffer + size, buffer + size + count);
+		MemoryMove(buffer, buffer + count, size);
 
 		m_size += count;
-		CharTraits::assign(buffer, count, ch);
+		MemorySet(buffer, ch, count);
 		buffer[m_size] = CharType();
 	}
 
@@ -1169,7 +1248,7 @@ namespace PenFramework::PenEngine
 		CharType* buffer = Buffer();
 		Usize size = Size();
 
-		std::copy_backward(buffer, buffer + size, buffer + size + requiredLength);
+		MemoryMove(buffer, buffer + requiredLength, size);
 
 		// 重定向到开头
 		currentStartPosition = str;
@@ -1636,6 +1715,116 @@ namespace PenFramework::PenEngine
 		return FindLastNotOf(str.data(), off, str.size());
 	}
 
+	template <typename CharType>
+	Usize BasicString<CharType>::Count(CharType ch) const noexcept
+	{
+		return ChCount(ch, Data(), Size());
+	}
+
+	template <typename CharType>
+	Usize BasicString<CharType>::Count(BasicStringView<CharType> str, MatchMode mode) const noexcept
+	{
+		return StrCount(str.Data(), str.Size(), Data(), Size(), mode);
+	}
+
+	template <typename CharType>
+	Usize BasicString<CharType>::FindAll(CharType ch, std::span<Usize> out) const noexcept
+	{
+		return ChFindAll(ch, Data(), Size(), out);
+	}
+
+	template <typename CharType>
+	Usize BasicString<CharType>::FindAll(BasicStringView<CharType> str, std::span<Usize> out, MatchMode mode) const noexcept
+	{
+		return StrFindAll(str.Data(), str.Size(), Data(), Size(), mode, out);
+	}
+
+	template <typename CharType>
+	void BasicString<CharType>::FindAll(CharType ch, std::vector<Usize>& out) const
+	{
+		ChFindAll(ch, Data(), Size(), out);
+	}
+
+	template <typename CharType>
+	void BasicString<CharType>::FindAll(BasicStringView<CharType> str, std::vector<Usize>& out, MatchMode mode) const
+	{
+		StrFindAll(str.Data(), str.Size(), Data(), Size(), mode, out);
+	}
+
+	template <typename CharType>
+	std::vector<Usize> BasicString<CharType>::FindAll(CharType ch) const
+	{
+		std::vector<Usize> res;
+		FindAll(ch, res);
+		return res;
+	}
+
+	template <typename CharType>
+	std::vector<Usize> BasicString<CharType>::FindAll(BasicStringView<CharType> str, MatchMode mode) const
+	{
+		std::vector<Usize> res;
+		FindAll(str, res, mode);
+		return res;
+	}
+
+	template <typename CharType>
+	Usize BasicString<CharType>::ParallelFind(CharType ch, const ParallelSearchOptions& options) const
+	{
+		return ParallelChFind(ch, Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicString<CharType>::ParallelFind(BasicStringView<CharType> str, const ParallelSearchOptions& options) const
+	{
+		return ParallelStrFind(str.Data(), str.Size(), Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicString<CharType>::ParallelFindLast(CharType ch, const ParallelSearchOptions& options) const
+	{
+		return ParallelChFindLast(ch, Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicString<CharType>::ParallelFindLast(BasicStringView<CharType> str, const ParallelSearchOptions& options) const
+	{
+		return ParallelStrFindLast(str.Data(), str.Size(), Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicString<CharType>::ParallelFindFirstOf(BasicStringView<CharType> str, const ParallelSearchOptions& options) const
+	{
+		return ParallelStrFindFirstOf(str.Data(), str.Size(), Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicString<CharType>::ParallelCount(CharType ch, const ParallelSearchOptions& options) const
+	{
+		return ParallelChCount(ch, Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicString<CharType>::ParallelCount(BasicStringView<CharType> str, MatchMode mode, const ParallelSearchOptions& options) const
+	{
+		return ParallelStrCount(str.Data(), str.Size(), Data(), Size(), mode, options);
+	}
+
+	template <typename CharType>
+	std::vector<Usize> BasicString<CharType>::ParallelFindAll(CharType ch, const ParallelSearchOptions& options) const
+	{
+		std::vector<Usize> res;
+		ParallelChFindAll(ch, Data(), Size(), res, options);
+		return res;
+	}
+
+	template <typename CharType>
+	std::vector<Usize> BasicString<CharType>::ParallelFindAll(BasicStringView<CharType> str, MatchMode mode, const ParallelSearchOptions& options) const
+	{
+		std::vector<Usize> res;
+		ParallelStrFindAll(str.Data(), str.Size(), Data(), Size(), mode, res, options);
+		return res;
+	}
+
 	template <typename CharType>
 	void BasicString<CharType>::ResetSizeAndEos(Usize size) noexcept
 	{
@@ -1679,12 +1868,8 @@ namespace PenFramework::PenEngine
 	template<typename CharType>
 	void BasicString<CharType>::ReallocateHeapBufferByCapacity(Usize capacity)
 	{
-		CharType* newBuffer = Memory::Allocate<CharType>(capacity + 1);
-
-		// 不需要m_size > 0判断，memcpy会检查，并且就算为0并且触发了复制，其也不会造成副作用，因为m_buffer.Heap是有效的
-		CharTraits::copy(newBuffer, m_buffer.Heap, m_size);
-
-		Memory::Deallocate(m_buffer.Heap, m_capacity + 1);
+		// 大块缓冲区增长时可以原地调整映射，不需要复制已有的内容
+		CharType* newBuffer = Memory::Reallocate(m_buffer.Heap, m_capacity + 1, capacity + 1, m_size, Memory::MemoryTag::String);
 
 		m_buffer.Heap = newBuffer;
 		m_capacity = capacity;
@@ -1699,14 +1884,14 @@ namespace PenFramework::PenEngine
 		if (len <= LocalStorageCapacity)
 		{
 			InitSSOBuffer();
-			CharTraits::copy(m_buffer.Stack, str, len);
+			MemoryCopy(str, m_buffer.Stack, len);
 			m_size = len;
 			m_buffer.Stack[m_size] = CharType();
 		}
 		else
 		{
 			InitHeapBuffer(len);
-			CharTraits::copy(m_buffer.Heap, str, len);
+			MemoryCopy(str, m_buffer.Heap, len);
 			m_size = len;
 			m_buffer.Heap[m_size] = CharType();
 		}
@@ -1716,7 +1901,7 @@ namespace PenFramework::PenEngine
 	void BasicString<CharType>::DeallocateBuffer() noexcept
 	{
 		if (IsHeapBuffer())
-			Memory::Deallocate(m_buffer.Heap, m_capacity + 1);
+			Memory::Deallocate(m_buffer.Heap, m_capacity + 1, Memory::MemoryTag::String);
 		InitSSOBuffer();
 	}
 
@@ -1732,7 +1917,7 @@ namespace PenFramework::PenEngine
 		CharType* startPosition = buffer + off;
 		Usize newSize = oldSize - count;
 
-		CharTraits::move(startPosition, startPosition + count, newSize - off + 1);
+		MemoryMove(startPosition + count, startPosition, newSize - off + 1);
 
 		m_size = newSize;
 		buffer[newSize] = CharType();
@@ -1751,7 +1936,7 @@ namespace PenFramework::PenEngine
 	{
 		capacity = CalculateAllocateCapacity(capacity, LocalStorageCapacity, MaxStorageCapacity);
 
-		CharType* buffer = Memory::Allocate<CharType>(capacity + 1);
+		CharType* buffer = Memory::Allocate<CharType>(capacity + 1, Memory::MemoryTag::String);
 
 		m_size = 0;
 		m_capacity = capacity;
@@ -1774,9 +1959,9 @@ namespace PenFramework::PenEngine
 		// 如果需要constexpr路径，需要先初始化StackBuffer
 		// 并且InitSSOBuffer()需要在if consteval路径下构造每个元素
 
-		CharTraits::copy(m_buffer.Stack, heapBuffer, m_size);
+		MemoryCopy(heapBuffer, m_buffer.Stack, m_size);
 
-		Memory::Deallocate(heapBuffer, m_capacity + 1);
+		Memory::Deallocate(heapBuffer, m_capacity + 1, Memory::MemoryTag::String);
 
 		m_capacity = LocalStorageCapacity;
 
@@ -1791,9 +1976,9 @@ namespace PenFramework::PenEngine
 
 		// Allocate不会构造对象，但是CharType是一个POD的字符类型，所以不需要构造函数
 		// @todo 对于将来可能得constexpr路径，需要在if consteval路径下构造每个元素
-		CharType* buffer = Memory::Allocate<CharType>(capacity + 1);
+		CharType* buffer = Memory::Allocate<CharType>(capacity + 1, Memory::MemoryTag::String);
 
-		CharTraits::copy(buffer, m_buffer.Stack, m_size);
+		MemoryCopy(m_buffer.Stack, buffer, m_size);
 
 		m_capacity = capacity;
 		m_buffer.Heap = buffer;
@@ -1803,6 +1988,10 @@ namespace PenFramework::PenEngine
 	}
 }
 
+// 栈缓冲区和堆指针都不依赖对象自身的地址，两种模式下都可以按字节搬动
+template <typename CharType>
+struct PenFramework::PenEngine::Memory::IsTriviallyRelocatable<PenFramework::PenEngine::BasicString<CharType>> : std::true_type {};
+
 template <>
 struct std::formatter<PenFramework::PenEngine::String> : std::formatter<std::string>
 {
@@ -1817,6 +2006,6 @@ struct std::hash<PenFramework::PenEngine::BasicString<CharType>>
 {
 	static PenFramework::PenEngine::Usize operator()(const PenFramework::PenEngine::BasicString<CharType>& str) noexcept
 	{
-		return std::hash<std::string_view>::operator()(std::string_view(str.Data(), str.Size()));
+		return std::hash<std::basic_string_view<CharType>>::operator()(std::basic_string_view<CharType>(str.Data(), str.Size()));
 	}
 };
\ No newline at end of file
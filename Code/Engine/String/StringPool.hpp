@@ -0,0 +1,247 @@
+// File /Engine/String/StringPool.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Memory/Memory.hpp"
+#include "StringTransparentHash.hpp"
+#include <unordered_set>
+#include <vector>
+
+namespace PenFramework::PenEngine
+{
+	// 默认每个块的字节数
+	static constexpr Usize StringPoolDefaultBlockBytes = 64 * 1024;
+
+	// 将字符串复制到大块连续内存中并返回指向池内的视图，适合解析过程中大量生命周期相同的小字符串
+	// 返回的视图在Reset()、Release()或池析构之前保持有效且地址不变，每个字符串之后都带有结尾空字符
+	// 开启去重时相同内容只保存一份，重复添加会返回同一个视图
+	template <typename CharType>
+	class BasicStringPool
+	{
+	public:
+		explicit BasicStringPool(bool deduplicate = false, Usize blockBytes = StringPoolDefaultBlockBytes) noexcept;
+		~BasicStringPool() noexcept;
+
+		BasicStringPool(const BasicStringPool&) = delete;
+		BasicStringPool& operator=(const BasicStringPool&) = delete;
+		BasicStringPool(BasicStringPool&& other) noexcept;
+		BasicStringPool& operator=(BasicStringPool&& other) noexcept;
+
+		// @brief 将str复制到池中
+		// @retval 指向池内副本的视图
+		BasicStringView<CharType> Add(BasicStringView<CharType> str);
+
+		// @brief 判断池中是否已有相同内容的字符串，仅在开启去重时可用
+		bool Contain(BasicStringView<CharType> str) const noexcept;
+
+		// @brief 一次性丢弃所有字符串，保留一个标准大小的块供之后复用
+		void Reset() noexcept;
+		// @brief 丢弃所有字符串并归还全部内存
+		void Release() noexcept;
+
+		// @brief 池中字符串的个数，开启去重时为不同内容的个数
+		Usize Count() const noexcept { return m_count; }
+		// @brief 已使用的字节数，包括每个字符串的结尾空字符
+		Usize UsedBytes() const noexcept { return m_usedChars * sizeof(CharType); }
+		// @brief 向Memory申请的总字节数
+		Usize ReservedBytes() const noexcept;
+		bool IsDeduplicate() const noexcept { return m_deduplicate; }
+	private:
+		struct Block
+		{
+			CharType* Data;
+			Usize Capacity;
+		};
+
+		CharType* AllocateChars(Usize count);
+		void FreeBlocks(Usize keepIndex) noexcept;
+
+		std::vector<Block> m_blocks;
+		CharType* m_cursor = nullptr;
+		Usize m_remaining = 0;
+		Usize m_blockCapacity;
+		Usize m_usedChars = 0;
+		Usize m_count = 0;
+		bool m_deduplicate;
+		std::unordered_set<BasicStringView<CharType>, StringTransparentHash<CharType>, std::equal_to<>> m_set;
+	};
+
+	template <typename CharType>
+	BasicStringPool<CharType>::BasicStringPool(bool deduplicate, Usize blockBytes) noexcept :
+		m_blockCapacity(std::max<Usize>(blockBytes / sizeof(CharType), 16)), m_deduplicate(deduplicate)
+	{}
+
+	template <typename CharType>
+	BasicStringPool<CharType>::~BasicStringPool() noexcept
+	{
+		FreeBlocks(NPos);
+	}
+
+	template <typename CharType>
+	BasicStringPool<CharType>::BasicStringPool(BasicStringPool&& other) noexcept :
+		m_blocks(std::move(other.m_blocks)), m_cursor(std::exchange(other.m_cursor, nullptr)), m_remaining(std::exchange(other.m_remaining, 0)),
+		m_blockCapacity(other.m_blockCapacity), m_usedChars(std::exchange(other.m_usedChars, 0)), m_count(std::exchange(other.m_count, 0)),
+		m_deduplicate(other.m_deduplicate), m_set(std::move(other.m_set))
+	{
+		other.m_blocks.clear();
+		other.m_set.clear();
+	}
+
+	template <typename CharType>
+	BasicStringPool<CharType>& BasicStringPool<CharType>::operator=(BasicStringPool&& other) noexcept
+	{
+		if (this == &other)
+			return *this;
+
+		FreeBlocks(NPos);
+		m_blocks = std::move(other.m_blocks);
+		m_cursor = std::exchange(other.m_cursor, nullptr);
+		m_remaining = std::exchange(other.m_remaining, 0);
+		m_blockCapacity = other.m_blockCapacity;
+		m_usedChars = std::exchange(other.m_usedChars, 0);
+		m_count = std::exchange(other.m_count, 0);
+		m_deduplicate = other.m_deduplicate;
+		m_set = std::move(other.m_set);
+		other.m_blocks.clear();
+		other.m_set.clear();
+		return *this;
+	}
+
+	template <typename CharType>
+	BasicStringView<CharType> BasicStringPool<CharType>::Add(BasicStringView<CharType> str)
+	{
+		if (m_deduplicate)
+		{
+			if (auto it = m_set.find(str); it != m_set.end())
+				return *it;
+		}
+
+		CharType* buffer = AllocateChars(str.Size() + 1);
+		std::char_traits<CharType>::copy(buffer, str.Data(), str.Size());
+		buffer[str.Size()] = CharType();
+
+		BasicStringView<CharType> res(buffer, str.Size());
+		if (m_deduplicate)
+			m_set.insert(res);
+
+		++m_count;
+		return res;
+	}
+
+	template <typename CharType>
+	bool BasicStringPool<CharType>::Contain(BasicStringView<CharType> str) const noexcept
+	{
+		DEBUG_VERIFY_REPORT(m_deduplicate, "Contain requires a deduplicating string pool")
+			return m_set.contains(str);
+	}
+
+	template <typename CharType>
+	void BasicStringPool<CharType>::Reset() noexcept
+	{
+		// 优先保留一个标准大小的块，单独分配的大块直接归还
+		Usize keepIndex = NPos;
+		for (Usize i = 0; i < m_blocks.size(); ++i)
+		{
+			if (m_blocks[i].Capacity == m_blockCapacity)
+			{
+				keepIndex = i;
+				break;
+			}
+		}
+
+		FreeBlocks(keepIndex);
+		m_set.clear();
+		m_usedChars = 0;
+		m_count = 0;
+
+		if (m_blocks.empty())
+		{
+			m_cursor = nullptr;
+			m_remaining = 0;
+		}
+		else
+		{
+			m_cursor = m_blocks.front().Data;
+			m_remaining = m_blocks.front().Capacity;
+		}
+	}
+
+	template <typename CharType>
+	void BasicStringPool<CharType>::Release() noexcept
+	{
+		FreeBlocks(NPos);
+		m_set.clear();
+		m_cursor = nullptr;
+		m_remaining = 0;
+		m_usedChars = 0;
+		m_count = 0;
+	}
+
+	template <typename CharType>
+	Usize BasicStringPool<CharType>::ReservedBytes() const noexcept
+	{
+		Usize res = 0;
+		for (const Block& block : m_blocks)
+			res += block.Capacity * sizeof(CharType);
+		return res;
+	}
+
+	template <typename CharType>
+	CharType* BasicStringPool<CharType>::AllocateChars(Usize count)
+	{
+		m_usedChars += count;
+
+		if (count <= m_remaining)
+		{
+			CharType* res = m_cursor;
+			m_cursor += count;
+			m_remaining -= count;
+			return res;
+		}
+
+		// 超过块大小四分之一的字符串单独分配，避免当前块剩余的空间被浪费
+		if (count > m_blockCapacity / 4)
+		{
+			CharType* res = Memory::Allocate<CharType>(count, Memory::MemoryTag::String);
+			m_blocks.push_back({ res, count });
+			return res;
+		}
+
+		CharType* block = Memory::Allocate<CharType>(m_blockCapacity, Memory::MemoryTag::String);
+		m_blocks.push_back({ block, m_blockCapacity });
+		m_cursor = block + count;
+		m_remaining = m_blockCapacity - count;
+		return block;
+	}
+
+	template <typename CharType>
+	void BasicStringPool<CharType>::FreeBlocks(Usize keepIndex) noexcept
+	{
+		for (Usize i = 0; i < m_blocks.size(); ++i)
+		{
+			if (i != keepIndex)
+				Memory::Deallocate(m_blocks[i].Data, m_blocks[i].Capacity, Memory::MemoryTag::String);
+		}
+
+		if (keepIndex != NPos)
+		{
+			Block kept = m_blocks[keepIndex];
+			m_blocks.clear();
+			m_blocks.push_back(kept);
+		}
+		else
+			m_blocks.clear();
+	}
+
+	using StringPool = BasicStringPool<Ch>;
+	using U32StringPool = BasicStringPool<Ch32>;
+}
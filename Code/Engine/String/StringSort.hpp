@@ -0,0 +1,392 @@
+// File /Engine/String/StringSort.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include "../Utils/Parallel.hpp"
+#include "../Utils/Ranges.hpp"
+#include "String.hpp"
+#include <array>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace PenFramework::PenEngine
+{
+	// 字符串基数排序
+	// 将每个字符按大端拆分成字节流，在字节流上做MSD基数排序，小桶退化为多关键字快速排序（Bentley-Sedgewick）
+	// 每个元素额外缓存从当前深度开始的8个字节，同一个8字节窗口内的划分都不需要再访问字符串本体，以此减少缓存未命中
+	// 排序结果与按无符号码元逐个比较的字典序一致
+
+	static constexpr Usize StringRadixSortInsertionThreshold = 16;
+	static constexpr Usize StringRadixSortMultikeyThreshold = 64;
+	static constexpr Usize StringRadixSortParallelThreshold = 1 << 16;
+
+	namespace Detail
+	{
+		template <typename T>
+		struct StringCharTypeOf;
+
+		template <typename CharType>
+		struct StringCharTypeOf<BasicString<CharType>>
+		{
+			using Type = CharType;
+		};
+
+		template <typename CharType>
+		struct StringCharTypeOf<BasicStringView<CharType>>
+		{
+			using Type = CharType;
+		};
+
+		template <typename CharType>
+		class StringRadixSorter
+		{
+		public:
+			using UnsignedCharType = std::make_unsigned_t<CharType>;
+
+			struct Entry
+			{
+				u64 Prefix;
+				const CharType* Str;
+				Usize ByteLength;
+				Usize Index;
+			};
+
+			// 字节0表示字符串已经结束，真实字节值整体后移一位
+			static constexpr Usize BucketCount = 257;
+
+			static void Sort(Entry* entries, Usize count, Usize parallelThreshold)
+			{
+				if (count < 2)
+					return;
+
+				std::vector<Entry> buffer(count);
+
+				for (Usize i = 0; i < count; ++i)
+					entries[i].Prefix = LoadPrefix(entries[i], 0);
+
+				if (count < parallelThreshold)
+				{
+					SortRange(entries, buffer.data(), count, 0);
+					return;
+				}
+
+				// 并行路径：先串行做一次分桶，之后每个桶互不相交，可以分发到各个线程上独立排序
+				std::array<Usize, BucketCount + 1> bucketStart = {};
+				Usize depth = 0;
+
+				while (!Distribute(entries, buffer.data(), count, depth, bucketStart))
+				{
+					if (bucketStart[1] == count)
+						return;
+
+					++depth;
+					if (depth % 8 == 0)
+						ReloadPrefix(entries, count, depth);
+				}
+
+				struct Task
+				{
+					Usize Start;
+					Usize Count;
+				};
+
+				std::vector<Task> tasks;
+				tasks.reserve(BucketCount);
+				for (Usize bucket = 1; bucket < BucketCount; ++bucket)
+				{
+					Usize bucketCount = bucketStart[bucket + 1] - bucketStart[bucket];
+					if (bucketCount > 1)
+						tasks.push_back({ bucketStart[bucket],bucketCount });
+				}
+
+				// 先处理大桶，避免最后只剩一个大桶拖慢整体
+				std::ranges::sort(tasks, std::greater<>(), &Task::Count);
+
+				ParallelFor(tasks.size(), [&](Usize taskIndex)
+							{
+								const Task& task = tasks[taskIndex];
+								Entry* begin = entries + task.Start;
+
+								if ((depth + 1) % 8 == 0)
+									ReloadPrefix(begin, task.Count, depth + 1);
+
+								SortRange(begin, buffer.data() + task.Start, task.Count, depth + 1);
+							});
+			}
+		private:
+			static U8 ByteAt(const Entry& entry, Usize bytePosition) noexcept
+			{
+				UnsignedCharType ch = static_cast<UnsignedCharType>(entry.Str[bytePosition / sizeof(CharType)]);
+				Usize shift = (sizeof(CharType) - 1 - bytePosition % sizeof(CharType)) * BitsPerBytes;
+				return static_cast<U8>(ch >> shift);
+			}
+
+			// @brief 从bytePosition开始读取8个字节并按大端打包，越界部分补0
+			static u64 LoadPrefix(const Entry& entry, Usize bytePosition) noexcept
+			{
+				if constexpr (sizeof(CharType) == 1)
+				{
+					if (bytePosition + 8 <= entry.ByteLength)
+					{
+						u64 v;
+						std::memcpy(&v, entry.Str + bytePosition, 8);
+						if constexpr (std::endian::native == std::endian::little)
+							v = std::byteswap(v);
+						return v;
+					}
+				}
+
+				u64 v = 0;
+				Usize end = std::min(entry.ByteLength, bytePosition + 8);
+				for (Usize i = bytePosition; i < end; ++i)
+					v |= static_cast<u64>(ByteAt(entry, i)) << ((7 - (i - bytePosition)) * BitsPerBytes);
+
+				return v;
+			}
+
+			static void ReloadPrefix(Entry* entries, Usize count, Usize depth) noexcept
+			{
+				for (Usize i = 0; i < count; ++i)
+					entries[i].Prefix = LoadPrefix(entries[i], depth);
+			}
+
+			static Usize Digit(const Entry& entry, Usize depth) noexcept
+			{
+				if (depth >= entry.ByteLength)
+					return 0;
+
+				return static_cast<Usize>((entry.Prefix >> ((7 - depth % 8) * BitsPerBytes)) & 0xFF) + 1;
+			}
+
+			// @brief 按深度depth的字节进行一次计数分桶，结果写回entries
+			// @retval false 所有元素落入同一个桶，此时没有进行搬运
+			static bool Distribute(Entry* entries, Entry* buffer, Usize count, Usize depth, std::array<Usize, BucketCount + 1>& bucketStart) noexcept
+			{
+				std::array<Usize, BucketCount> bucketSize = {};
+
+				for (Usize i = 0; i < count; ++i)
+					++bucketSize[Digit(entries[i], depth)];
+
+				bucketStart[0] = 0;
+				for (Usize bucket = 0; bucket < BucketCount; ++bucket)
+					bucketStart[bucket + 1] = bucketStart[bucket] + bucketSize[bucket];
+
+				if (bucketSize[Digit(entries[0], depth)] == count)
+				{
+					// 调用方需要通过bucketStart[1]判断是否全部都是已结束的字符串
+					return false;
+				}
+
+				std::array<Usize, BucketCount> position;
+				std::copy_n(bucketStart.begin(), BucketCount, position.begin());
+
+				for (Usize i = 0; i < count; ++i)
+					buffer[position[Digit(entries[i], depth)]++] = entries[i];
+
+				std::copy_n(buffer, count, entries);
+				return true;
+			}
+
+			static void SortRange(Entry* entries, Entry* buffer, Usize count, Usize depth)
+			{
+				while (count >= StringRadixSortMultikeyThreshold)
+				{
+					std::array<Usize, BucketCount + 1> bucketStart;
+
+					if (!Distribute(entries, buffer, count, depth, bucketStart))
+					{
+						// 全部落在同一个桶中，直接进入下一层，避免公共前缀很长时递归过深
+						if (bucketStart[1] == count)
+							return;
+
+						++depth;
+						if (depth % 8 == 0)
+							ReloadPrefix(entries, count, depth);
+						continue;
+					}
+
+					Usize nextDepth = depth + 1;
+					bool needReload = nextDepth % 8 == 0;
+
+					for (Usize bucket = 1; bucket < BucketCount; ++bucket)
+					{
+						Usize bucketCount = bucketStart[bucket + 1] - bucketStart[bucket];
+						if (bucketCount < 2)
+							continue;
+
+						Entry* begin = entries + bucketStart[bucket];
+						if (needReload)
+							ReloadPrefix(begin, bucketCount, nextDepth);
+
+						SortRange(begin, buffer + bucketStart[bucket], bucketCount, nextDepth);
+					}
+					return;
+				}
+
+				MultikeyQuickSort(entries, count, depth);
+			}
+
+			static void MultikeyQuickSort(Entry* entries, Usize count, Usize depth)
+			{
+				while (count > StringRadixSortInsertionThreshold)
+				{
+					Usize pivot = MedianOfThree(Digit(entries[0], depth), Digit(entries[count / 2], depth), Digit(entries[count - 1], depth));
+
+					// Dijkstra三路划分：[0,lt)小于 [lt,gt)等于 [gt,count)大于
+					Usize lt = 0;
+					Usize gt = count;
+					Usize i = 0;
+
+					while (i < gt)
+					{
+						Usize digit = Digit(entries[i], depth);
+						if (digit < pivot)
+							std::swap(entries[lt++], entries[i++]);
+						else if (digit > pivot)
+							std::swap(entries[i], entries[--gt]);
+						else
+							++i;
+					}
+
+					MultikeyQuickSort(entries, lt, depth);
+					MultikeyQuickSort(entries + gt, count - gt, depth);
+
+					// 等于区间的字符串已经结束时彼此相等，不需要继续排序
+					if (pivot == 0)
+						return;
+
+					entries += lt;
+					count = gt - lt;
+					++depth;
+
+					if (depth % 8 == 0)
+						ReloadPrefix(entries, count, depth);
+				}
+
+				InsertionSort(entries, count, depth);
+			}
+
+			static Usize MedianOfThree(Usize a, Usize b, Usize c) noexcept
+			{
+				if (a < b)
+					return b < c ? b : (a < c ? c : a);
+				return a < c ? a : (b < c ? c : b);
+			}
+
+			// @brief 比较两个在depth之前完全相同的元素
+			static bool Less(const Entry& lhs, const Entry& rhs, Usize depth) noexcept
+			{
+				// 同一个窗口内depth之前的字节必然相同，所以可以直接比较整个缓存
+				if (lhs.Prefix != rhs.Prefix)
+					return lhs.Prefix < rhs.Prefix;
+
+				Usize windowEnd = (depth & ~static_cast<Usize>(7)) + 8;
+				if (lhs.ByteLength <= windowEnd || rhs.ByteLength <= windowEnd)
+					return lhs.ByteLength < rhs.ByteLength;
+
+				// 窗口末尾总是码元边界，剩余部分按码元比较
+				Usize offset = windowEnd / sizeof(CharType);
+				Usize lhsLength = lhs.ByteLength / sizeof(CharType) - offset;
+				Usize rhsLength = rhs.ByteLength / sizeof(CharType) - offset;
+
+				int res = std::char_traits<CharType>::compare(lhs.Str + offset, rhs.Str + offset, std::min(lhsLength, rhsLength));
+				if (res != 0)
+					return res < 0;
+
+				return lhsLength < rhsLength;
+			}
+
+			static void InsertionSort(Entry* entries, Usize count, Usize depth) noexcept
+			{
+				for (Usize i = 1; i < count; ++i)
+				{
+					Entry current = entries[i];
+					Usize j = i;
+
+					while (j > 0 && Less(current, entries[j - 1], depth))
+					{
+						entries[j] = entries[j - 1];
+						--j;
+					}
+
+					entries[j] = current;
+				}
+			}
+		};
+	}
+
+	// @brief 对[first,last)按照proj(element)得到的字符串进行字典序排序
+	// @param proj 返回BasicString或BasicStringView（或其引用）的投影
+	// 按值返回BasicString的投影（例如[](auto& r){ return r.Name; }）会先把所有键保存下来，多一次复制
+	// @param parallelThreshold 元素数量达到该阈值时使用多线程排序
+	template <std::random_access_iterator RandomIt, typename Projection> requires std::invocable<Projection&, std::iter_reference_t<RandomIt>>
+	void StringRadixSort(RandomIt first, RandomIt last, Projection proj, Usize parallelThreshold = StringRadixSortParallelThreshold)
+	{
+		using ResultType = std::invoke_result_t<Projection&, std::iter_reference_t<RandomIt>>;
+		using KeyType = std::remove_cvref_t<ResultType>;
+		using CharType = typename Detail::StringCharTypeOf<KeyType>::Type;
+		using Sorter = Detail::StringRadixSorter<CharType>;
+		using Entry = typename Sorter::Entry;
+		using ValueType = std::iter_value_t<RandomIt>;
+		// 投影得到的临时字符串在语句结束时销毁，需要保存到排序结束
+		constexpr bool ownedKey = !std::is_reference_v<ResultType> && std::same_as<KeyType, BasicString<CharType>>;
+
+		Usize count = static_cast<Usize>(last - first);
+		if (count < 2)
+			return;
+
+		std::vector<KeyType> keys;
+		if constexpr (ownedKey)
+			keys.reserve(count);
+
+		std::vector<Entry> entries(count);
+		for (Usize i = 0; i < count; ++i)
+		{
+			BasicStringView<CharType> key;
+			if constexpr (ownedKey)
+				key = keys.emplace_back(std::invoke(proj, first[i]));
+			else
+				key = std::invoke(proj, first[i]);
+			entries[i] = { 0, key.Data(), key.Size() * sizeof(CharType), i };
+		}
+
+		Sorter::Sort(entries.data(), count, parallelThreshold);
+
+		// 元素本身可能是拥有资源的对象，按照排序后的下标整体搬运一次
+		std::vector<ValueType> sorted;
+		sorted.reserve(count);
+		for (Usize i = 0; i < count; ++i)
+			sorted.push_back(std::move(first[entries[i].Index]));
+
+		std::move(sorted.begin(), sorted.end(), first);
+	}
+
+	template <std::random_access_iterator RandomIt>
+	void StringRadixSort(RandomIt first, RandomIt last, Usize parallelThreshold = StringRadixSortParallelThreshold)
+	{
+		StringRadixSort(first, last, std::identity(), parallelThreshold);
+	}
+
+	template <typename Range, typename Projection> requires IsSupportRange<Range> && std::invocable<Projection&, RangeReferenceType<Range>>
+	void StringRadixSort(Range& rng, Projection proj, Usize parallelThreshold = StringRadixSortParallelThreshold)
+	{
+		StringRadixSort(PenEngine::Begin(rng), PenEngine::End(rng), std::move(proj), parallelThreshold);
+	}
+
+	template <typename Range> requires IsSupportRange<Range>
+	void StringRadixSort(Range& rng, Usize parallelThreshold = StringRadixSortParallelThreshold)
+	{
+		StringRadixSort(PenEngine::Begin(rng), PenEngine::End(rng), std::identity(), parallelThreshold);
+	}
+}
@@ -19,4 +19,10 @@ namespace PenFramework::PenEngine
 	using StringUnorderedMap = std::unordered_map<String, V, StringTransparentHash<Ch>, std::equal_to<>>;
 	template <typename V>
 	using StringUnorderedMultimap = std::unordered_multimap<String, V, StringTransparentHash<Ch>, std::equal_to<>>;
+
+	// 键只是视图而不持有字符串，键所指向的内容（例如StringPool中的字符串）必须比容器活得更久
+	template <typename V>
+	using StringViewUnorderedMap = std::unordered_map<StringView, V, StringTransparentHash<Ch>, std::equal_to<>>;
+	template <typename V>
+	using StringViewUnorderedMultimap = std::unordered_multimap<StringView, V, StringTransparentHash<Ch>, std::equal_to<>>;
 }
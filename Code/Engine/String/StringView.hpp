@@ -15,7 +15,10 @@
 #include "../Exception/InvalidArgument.hpp"
 #include "../Utils/Iterator.hpp"
 #include "../Utils/Ranges.hpp"
+#include "ParallelStrSearch.hpp"
+#include "StrCompareUtils.hpp"
 #include "StrSearchUtils.hpp"
+#include <compare>
 #include <format>
 #include <string>
 
@@ -213,6 +216,16 @@ namespace PenFramework::PenEngine
 
 		bool operator==(const CharType* str) const noexcept;
 
+		std::strong_ordering operator<=>(const BasicStringView& str) const noexcept;
+		std::strong_ordering operator<=>(const std::basic_string<CharType>& str) const noexcept;
+		std::strong_ordering operator<=>(std::basic_string_view<CharType> str) const noexcept;
+		std::strong_ordering operator<=>(const CharType* str) const noexcept;
+
+		// @brief 三路比较，同时返回第一个不同码元的下标
+		StringCompareResult Compare(BasicStringView str) const noexcept;
+		// @brief 自然顺序比较，连续的数字按数值比较
+		std::strong_ordering NaturalCompare(BasicStringView str) const noexcept;
+
 		Usize Capacity() const noexcept { return m_size; }
 		Usize Size() const noexcept { return m_size; }
 
@@ -294,6 +307,29 @@ namespace PenFramework::PenEngine
 		Usize FindLastNotOf(const CharType* str, Usize off, Usize len) const noexcept;
 		Usize FindLastNotOf(const std::basic_string<CharType>& str, Usize off = NPos) const noexcept;
 		Usize FindLastNotOf(std::basic_string_view<CharType> str, Usize off = NPos) const noexcept;
+
+		// @brief 统计字符或子串出现的次数，空串的次数为0
+		Usize Count(CharType ch) const noexcept;
+		Usize Count(BasicStringView str, MatchMode mode = MatchMode::NonOverlapping) const noexcept;
+
+		// @brief 按顺序写入所有匹配位置，写入span时写满即停止并返回写入个数，写入vector时追加全部位置
+		Usize FindAll(CharType ch, std::span<Usize> out) const noexcept;
+		Usize FindAll(BasicStringView str, std::span<Usize> out, MatchMode mode = MatchMode::NonOverlapping) const noexcept;
+		void FindAll(CharType ch, std::vector<Usize>& out) const;
+		void FindAll(BasicStringView str, std::vector<Usize>& out, MatchMode mode = MatchMode::NonOverlapping) const;
+		std::vector<Usize> FindAll(CharType ch) const;
+		std::vector<Usize> FindAll(BasicStringView str, MatchMode mode = MatchMode::NonOverlapping) const;
+
+		// @brief 多线程版本的查找与统计，源串小于options.SerialThreshold时退化为串行执行
+		Usize ParallelFind(CharType ch, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelFind(BasicStringView str, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelFindLast(CharType ch, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelFindLast(BasicStringView str, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelFindFirstOf(BasicStringView str, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelCount(CharType ch, const ParallelSearchOptions& options = {}) const;
+		Usize ParallelCount(BasicStringView str, MatchMode mode = MatchMode::NonOverlapping, const ParallelSearchOptions& options = {}) const;
+		std::vector<Usize> ParallelFindAll(CharType ch, const ParallelSearchOptions& options = {}) const;
+		std::vector<Usize> ParallelFindAll(BasicStringView str, MatchMode mode = MatchMode::NonOverlapping, const ParallelSearchOptions& options = {}) const;
 	private:
 		const CharType* m_str = nullptr;
 		Usize m_size = 0;
@@ -329,6 +365,42 @@ namespace PenFramework::PenEngine
 		return m_size == CharTraits::length(str) && CharTraits::compare(m_str, str, m_size) == 0;
 	}
 
+	template <typename CharType>
+	std::strong_ordering BasicStringView<CharType>::operator<=>(const BasicStringView& str) const noexcept
+	{
+		return StrCompare(m_str, m_size, str.m_str, str.m_size).Ordering;
+	}
+
+	template <typename CharType>
+	std::strong_ordering BasicStringView<CharType>::operator<=>(const std::basic_string<CharType>& str) const noexcept
+	{
+		return StrCompare(m_str, m_size, str.data(), str.size()).Ordering;
+	}
+
+	template <typename CharType>
+	std::strong_ordering BasicStringView<CharType>::operator<=>(std::basic_string_view<CharType> str) const noexcept
+	{
+		return StrCompare(m_str, m_size, str.data(), str.size()).Ordering;
+	}
+
+	template <typename CharType>
+	std::strong_ordering BasicStringView<CharType>::operator<=>(const CharType* str) const noexcept
+	{
+		return StrCompare(m_str, m_size, str, CharTraits::length(str)).Ordering;
+	}
+
+	template <typename CharType>
+	StringCompareResult BasicStringView<CharType>::Compare(BasicStringView str) const noexcept
+	{
+		return StrCompare(m_str, m_size, str.m_str, str.m_size);
+	}
+
+	template <typename CharType>
+	std::strong_ordering BasicStringView<CharType>::NaturalCompare(BasicStringView str) const noexcept
+	{
+		return StrNaturalCompare(m_str, m_size, str.m_str, str.m_size);
+	}
+
 	template <typename CharType>
 	const CharType* BasicStringView<CharType>::Data() noexcept
 	{
@@ -721,8 +793,134 @@ namespace PenFramework::PenEngine
 		return FindLastNotOf(str.data(), off, str.size());
 	}
 
+	template <typename CharType>
+	Usize BasicStringView<CharType>::Count(CharType ch) const noexcept
+	{
+		return ChCount(ch, Data(), Size());
+	}
+
+	template <typename CharType>
+	Usize BasicStringView<CharType>::Count(BasicStringView str, MatchMode mode) const noexcept
+	{
+		return StrCount(str.Data(), str.Size(), Data(), Size(), mode);
+	}
+
+	template <typename CharType>
+	Usize BasicStringView<CharType>::FindAll(CharType ch, std::span<Usize> out) const noexcept
+	{
+		return ChFindAll(ch, Data(), Size(), out);
+	}
+
+	template <typename CharType>
+	Usize BasicStringView<CharType>::FindAll(BasicStringView str, std::span<Usize> out, MatchMode mode) const noexcept
+	{
+		return StrFindAll(str.Data(), str.Size(), Data(), Size(), mode, out);
+	}
+
+	template <typename CharType>
+	void BasicStringView<CharType>::FindAll(CharType ch, std::vector<Usize>& out) const
+	{
+		ChFindAll(ch, Data(), Size(), out);
+	}
+
+	template <typename CharType>
+	void BasicStringView<CharType>::FindAll(BasicStringView str, std::vector<Usize>& out, MatchMode mode) const
+	{
+		StrFindAll(str.Data(), str.Size(), Data(), Size(), mode, out);
+	}
+
+	template <typename CharType>
+	std::vector<Usize> BasicStringView<CharType>::FindAll(CharType ch) const
+	{
+		std::vector<Usize> res;
+		FindAll(ch, res);
+		return res;
+	}
+
+	template <typename CharType>
+	std::vector<Usize> BasicStringView<CharType>::FindAll(BasicStringView str, MatchMode mode) const
+	{
+		std::vector<Usize> res;
+		FindAll(str, res, mode);
+		return res;
+	}
+
+	template <typename CharType>
+	Usize BasicStringView<CharType>::ParallelFind(CharType ch, const ParallelSearchOptions& options) const
+	{
+		return ParallelChFind(ch, Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicStringView<CharType>::ParallelFind(BasicStringView str, const ParallelSearchOptions& options) const
+	{
+		return ParallelStrFind(str.Data(), str.Size(), Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicStringView<CharType>::ParallelFindLast(CharType ch, const ParallelSearchOptions& options) const
+	{
+		return ParallelChFindLast(ch, Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicStringView<CharType>::ParallelFindLast(BasicStringView str, const ParallelSearchOptions& options) const
+	{
+		return ParallelStrFindLast(str.Data(), str.Size(), Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicStringView<CharType>::ParallelFindFirstOf(BasicStringView str, const ParallelSearchOptions& options) const
+	{
+		return ParallelStrFindFirstOf(str.Data(), str.Size(), Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicStringView<CharType>::ParallelCount(CharType ch, const ParallelSearchOptions& options) const
+	{
+		return ParallelChCount(ch, Data(), Size(), options);
+	}
+
+	template <typename CharType>
+	Usize BasicStringView<CharType>::ParallelCount(BasicStringView str, MatchMode mode, const ParallelSearchOptions& options) const
+	{
+		return ParallelStrCount(str.Data(), str.Size(), Data(), Size(), mode, options);
+	}
+
+	template <typename CharType>
+	std::vector<Usize> BasicStringView<CharType>::ParallelFindAll(CharType ch, const ParallelSearchOptions& options) const
+	{
+		std::vector<Usize> res;
+		ParallelChFindAll(ch, Data(), Size(), res, options);
+		return res;
+	}
+
+	template <typename CharType>
+	std::vector<Usize> BasicStringView<CharType>::ParallelFindAll(BasicStringView str, MatchMode mode, const ParallelSearchOptions& options) const
+	{
+		std::vector<Usize> res;
+		ParallelStrFindAll(str.Data(), str.Size(), Data(), Size(), mode, res, options);
+		return res;
+	}
+
 	using StringView = BasicStringView<Ch>;
 	using U32View = BasicStringView<Ch32>;
+
+	// 按自然顺序比较的透明比较器，可直接用于有序容器与排序算法
+	struct NaturalLess
+	{
+		using is_transparent = void;
+
+		bool operator()(StringView lhs, StringView rhs) const noexcept
+		{
+			return lhs.NaturalCompare(rhs) < 0;
+		}
+
+		bool operator()(U32View lhs, U32View rhs) const noexcept
+		{
+			return lhs.NaturalCompare(rhs) < 0;
+		}
+	};
 }
 
 template <>
@@ -739,6 +937,6 @@ struct std::hash<PenFramework::PenEngine::BasicStringView<CharType>>
 {
 	static PenFramework::PenEngine::Usize operator()(PenFramework::PenEngine::BasicStringView<CharType> str) noexcept
 	{
-		return std::hash<std::string_view>::operator()(std::string_view(str.Data(), str.Size()));
+		return std::hash<std::basic_string_view<CharType>>::operator()(std::basic_string_view<CharType>(str.Data(), str.Size()));
 	}
 };
\ No newline at end of file
@@ -0,0 +1,58 @@
+// File /Engine/Utils/Parallel.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace PenFramework::PenEngine
+{
+	inline Usize HardwareConcurrency() noexcept
+	{
+		// hardware_concurrency在无法获取时会返回0，这里至少保证有一个执行单元
+		return std::max<Usize>(1, std::thread::hardware_concurrency());
+	}
+
+	// @brief 将taskCount个相互独立的任务分发到多个线程上执行，调用线程同样会参与执行
+	// @param func 形如void(Usize taskIndex)的可调用对象，不应抛出异常
+	// @note 任务按照下标顺序被领取，所以调用方应该把耗时较长的任务放在前面
+	template <typename Func>
+	void ParallelFor(Usize taskCount, Func&& func, Usize maxWorkerCount = HardwareConcurrency())
+	{
+		Usize workerCount = std::min(taskCount, std::max<Usize>(1, maxWorkerCount));
+
+		if (workerCount <= 1)
+		{
+			for (Usize i = 0; i < taskCount; ++i)
+				func(i);
+			return;
+		}
+
+		std::atomic<Usize> nextTask = 0;
+
+		auto worker = [&]()
+			{
+				for (Usize i = nextTask.fetch_add(1, std::memory_order::relaxed); i < taskCount; i = nextTask.fetch_add(1, std::memory_order::relaxed))
+					func(i);
+			};
+
+		std::vector<std::jthread> threads;
+		threads.reserve(workerCount - 1);
+
+		for (Usize i = 1; i < workerCount; ++i)
+			threads.emplace_back(worker);
+
+		worker();
+	}
+}
@@ -32,4 +32,11 @@
 #define VA_CONDITION(notEmptyOp,emptyOp,...) SEQ_CONDITION(VA_TO_SEQ(__VA_ARGS__),notEmptyOp,emptyOp)
 
 #define IF_SEQ(op,seq) SEQ_CONDITION(op,,seq)
-#define IF_VA(op,...) IF_SEQ(op,VA_TO_SEQ(__VA_ARGS__))
\ No newline at end of file
+#define IF_VA(op,...) IF_SEQ(op,VA_TO_SEQ(__VA_ARGS__))
+
+// 禁止编译器内联该函数，例如依赖调用栈层数的函数
+#ifdef _MSC_VER
+#define NOINLINE __declspec(noinline)
+#else // _MSC_VER
+#define NOINLINE [[gnu::noinline]]
+#endif // _MSC_VER
@@ -118,22 +118,23 @@ namespace PenFramework::PenEngine
 	{
 		using std::end;
 
+		// 与std::ranges::end一致，End只需要是Begin返回的迭代器的哨位，例如std::default_sentinel_t
 		template <typename T>
 		concept HasFrameworkContainerIterator = requires (T t)
 		{
-			{ std::_Fake_copy_init(t.End()) }-> std::input_or_output_iterator;
+			{ std::_Fake_copy_init(t.End()) }-> std::sentinel_for<decltype(PenEngine::Begin(t))>;
 		};
 
 		template <typename T>
 		concept HasSTDLikeContainerIterator = requires (T t)
 		{
-			{ std::_Fake_copy_init(t.end()) }-> std::input_or_output_iterator;
+			{ std::_Fake_copy_init(t.end()) }-> std::sentinel_for<decltype(PenEngine::Begin(t))>;
 		};
 
 		template <typename T>
 		concept HasSTDLikeADL = requires(T t)
 		{
-			{ std::_Fake_copy_init(end(t)) }-> std::input_or_output_iterator;
+			{ std::_Fake_copy_init(end(t)) }-> std::sentinel_for<decltype(PenEngine::Begin(t))>;
 		};
 
 		struct EndStruct
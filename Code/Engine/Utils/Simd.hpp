@@ -0,0 +1,93 @@
+// File /Engine/Utils/Simd.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+// 编译期指令集检测
+// MSVC只会在/arch:AVX及以上时定义__AVX__/__AVX2__，x64下SSE2总是可用，SSSE3/SSE4.2没有单独的宏，只能借助__AVX__判断
+// 所有向量化路径都必须保留标量实现，宏未定义时退回标量路径
+
+#if defined(__AVX2__)
+#define SIMD_AVX2_SUPPORT 1
+#endif // __AVX2__
+
+#if defined(__SSE4_2__) || defined(__AVX__)
+#define SIMD_SSE42_SUPPORT 1
+#endif // __SSE4_2__ || __AVX__
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#define SIMD_SSSE3_SUPPORT 1
+#endif // __SSSE3__ || __AVX__
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_SSE2_SUPPORT 1
+#endif // __SSE2__ || _M_X64 || _M_IX86_FP >= 2
+
+#if defined(SIMD_SSE2_SUPPORT)
+#include <immintrin.h>
+#endif // SIMD_SSE2_SUPPORT
+
+#include "../Common/Type.hpp"
+#include <bit>
+#include <cstring>
+
+namespace PenFramework::PenEngine::Simd
+{
+	// 单次向量处理的最大字节数，调用方可以据此决定分块大小
+	static constexpr Usize MaxVectorBytes =
+	{
+		#if defined(SIMD_AVX2_SUPPORT)
+		32
+		#elif defined(SIMD_SSE2_SUPPORT)
+		16
+		#else
+		8
+		#endif
+	};
+
+	// @brief 以非对齐方式读取一个u64，用于标量路径下的8字节块处理
+	inline u64 LoadU64(const void* ptr) noexcept
+	{
+		u64 v;
+		std::memcpy(&v, ptr, sizeof(v));
+		return v;
+	}
+
+	// @brief u64中每个字节等于0时置位该字节最高位，其余字节为0（SWAR）
+	inline u64 ZeroByteMask(u64 v) noexcept
+	{
+		constexpr u64 low = 0x0101010101010101ull;
+		constexpr u64 high = 0x8080808080808080ull;
+		return (v - low) & ~v & high;
+	}
+
+	// @brief 返回ZeroByteMask结果中第一个置位字节在内存中的下标
+	// @note 借位只会向高位传播，小端下最低的置位字节一定是真实的0字节，框架目前只面向小端平台
+	inline Usize FirstMarkedByte(u64 mask) noexcept
+	{
+		static_assert(std::endian::native == std::endian::little, "only little endian platform is supported");
+		return static_cast<Usize>(std::countr_zero(mask)) / BitsPerBytes;
+	}
+
+	// @brief 在字节位掩码中依次取出每个置位的下标，并清除最低位
+	inline U32 PopLowestBit(U32& mask) noexcept
+	{
+		U32 index = static_cast<U32>(std::countr_zero(mask));
+		mask &= mask - 1;
+		return index;
+	}
+
+	inline U32 PopLowestBit(u64& mask) noexcept
+	{
+		U32 index = static_cast<U32>(std::countr_zero(mask));
+		mask &= mask - 1;
+		return index;
+	}
+}
@@ -0,0 +1,74 @@
+// File /Engine/Utils/ThreadLocal.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../Common/Type.hpp"
+#include <atomic>
+#include <memory>
+
+namespace PenFramework::PenEngine
+{
+	// @brief 累加只由所属线程写入、其他线程只读取的计数，不需要原子的读改写
+	template <typename T>
+	void OwnerAdd(std::atomic<T>& counter, T value) noexcept
+	{
+		counter.store(counter.load(std::memory_order::relaxed) + value, std::memory_order::relaxed);
+	}
+
+	// @brief 返回一个永远不析构的T
+	// @note 线程或静态对象的析构函数在程序退出时仍可能访问它，例如归还或释放内存
+	template <typename T>
+	T& ImmortalInstance()
+	{
+		static T* instance = new T();
+		return *instance;
+	}
+
+	enum class ThreadExitState : U8
+	{
+		Uninitialized,
+		Active,
+		Destroyed,
+	};
+
+	// 线程退出时调用一次OnExit，每个OnExit对应一组独立的线程局部状态
+	// 状态本身是平凡的thread_local，访问时不需要经过初始化检查，只在Activate时注册退出时的析构
+	// OnExit执行前状态已经变为Destroyed，此后的访问应当退回不使用线程局部数据的路径
+	template <auto OnExit>
+	class ThreadExitHook
+	{
+	public:
+		static ThreadExitState State() noexcept { return t_state; }
+
+		// @brief 第一次调用时注册线程退出时的回调，已经退出的线程不会再次注册
+		static void Activate() noexcept
+		{
+			if (t_state != ThreadExitState::Uninitialized)
+				return;
+
+			// 取地址会构造thread_local并注册它的析构
+			static_cast<void>(std::addressof(t_exit));
+			t_state = ThreadExitState::Active;
+		}
+	private:
+		struct Exit
+		{
+			~Exit()
+			{
+				t_state = ThreadExitState::Destroyed;
+				OnExit();
+			}
+		};
+
+		static inline thread_local constinit ThreadExitState t_state = ThreadExitState::Uninitialized;
+		static inline thread_local Exit t_exit;
+	};
+}
@@ -62,6 +62,7 @@ PenFramework::UnitTest::SpdlogSTSharedContext::SpdlogSTSharedContext()
 {
 	m_logger = spdlog::stdout_color_st("Log");
 	m_handle = SpdlogSTSharedHandle(m_logger);
+	m_freeHandles.Push(&m_handle);
 }
 
 void PenFramework::UnitTest::SpdlogSTSharedHandle::Message(PenEngine::StringView message, PenEngine::U32 line)
@@ -108,16 +109,12 @@ void PenFramework::UnitTest::SpdlogSTSharedContext::FileFinish(std::chrono::stea
 
 PenFramework::UnitTest::Core::IUnitTestHandle* PenFramework::UnitTest::SpdlogSTSharedContext::AllocateTestHandle()
 {
-	std::unique_lock ul(m_mt);
-	m_cv.wait(ul, [this] { return !m_locked; });
-	m_locked = true;
-	return &m_handle;
+	return m_freeHandles.Pop();
 }
 
 void PenFramework::UnitTest::SpdlogSTSharedContext::FreeTestHandle(Core::IUnitTestHandle* handle)
 {
-	m_locked = false;
-	m_cv.notify_one();
+	m_freeHandles.Push(handle);
 }
 
 PenFramework::UnitTest::SpdlogMTSharedHandle::SpdlogMTSharedHandle(const std::shared_ptr<spdlog::logger>& logger) noexcept : m_logger(logger)
@@ -167,6 +164,7 @@ PenFramework::UnitTest::SpdlogMTSharedContext::SpdlogMTSharedContext()
 {
 	m_logger = spdlog::stdout_color_mt("Log");
 	m_handle = SpdlogMTSharedHandle(m_logger);
+	m_freeHandles.Push(&m_handle);
 }
 
 void PenFramework::UnitTest::SpdlogMTSharedHandle::Message(PenEngine::StringView message, PenEngine::U32 line)
@@ -213,14 +211,10 @@ void PenFramework::UnitTest::SpdlogMTSharedContext::FileFinish(std::chrono::stea
 
 PenFramework::UnitTest::Core::IUnitTestHandle* PenFramework::UnitTest::SpdlogMTSharedContext::AllocateTestHandle()
 {
-	std::unique_lock ul(m_mt);
-	m_cv.wait(ul, [this] { return !m_locked; });
-	m_locked = true;
-	return &m_handle;
+	return m_freeHandles.Pop();
 }
 
 void PenFramework::UnitTest::SpdlogMTSharedContext::FreeTestHandle(Core::IUnitTestHandle* handle)
 {
-	m_locked = false;
-	m_cv.notify_one();
+	m_freeHandles.Push(handle);
 }
\ No newline at end of file
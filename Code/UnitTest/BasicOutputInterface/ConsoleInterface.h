@@ -10,7 +10,7 @@
 
 #pragma once
 
-#include <condition_variable>
+#include "../../Engine/Container/RingBuffer.hpp"
 #include "../../Engine/String/String.hpp"
 #include "../UnitTestInterface.hpp"
 
@@ -67,11 +67,10 @@ namespace PenFramework::UnitTest
 		virtual void FreeTestHandle(Core::IUnitTestHandle* handle) override;
 	private:
 		std::shared_ptr<spdlog::logger> m_logger;
-		std::atomic<bool> m_locked = false;
-		std::condition_variable m_cv;
 		std::chrono::steady_clock::time_point m_uTestStartTimepoint;
-		std::mutex m_mt;
 		SpdlogSTSharedHandle m_handle;
+		// 空闲的句柄，为空时AllocateTestHandle等待
+		PenEngine::BlockingRingBuffer<PenEngine::MPMCRingBuffer<Core::IUnitTestHandle*>> m_freeHandles{2};
 	};
 
 	class SpdlogMTSharedHandle : public Core::IUnitTestHandle
@@ -120,10 +119,9 @@ namespace PenFramework::UnitTest
 		virtual void FreeTestHandle(Core::IUnitTestHandle* handle) override;
 	private:
 		std::shared_ptr<spdlog::logger> m_logger;
-		std::atomic<bool> m_locked = false;
-		std::condition_variable m_cv;
 		std::chrono::steady_clock::time_point m_uTestStartTimepoint;
-		std::mutex m_mt;
 		SpdlogMTSharedHandle m_handle;
+		// 空闲的句柄，为空时AllocateTestHandle等待
+		PenEngine::BlockingRingBuffer<PenEngine::MPMCRingBuffer<Core::IUnitTestHandle*>> m_freeHandles{2};
 	};
 }
\ No newline at end of file
@@ -0,0 +1,191 @@
+// File /UnitTest/Benchmarks/Benchmark_AsyncTask.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Coroutine/AsyncTask.hpp"
+#include "../../Engine/Memory/MonotonicArena.h"
+#include "../../Engine/String/Format.hpp"
+#include "../UnitTestFramework.h"
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		// 与AsyncTask相同，但协程帧经由全局operator new分配
+		struct UnpooledTask
+		{
+			struct promise_type
+			{
+				UnpooledTask get_return_object() { return UnpooledTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+				static std::suspend_always initial_suspend() noexcept { return {}; }
+				static std::suspend_always final_suspend() noexcept { return {}; }
+				void unhandled_exception() noexcept {}
+				void return_value(PenEngine::u64 v) { Value = v; }
+
+				PenEngine::u64 Value = 0;
+			};
+
+			explicit UnpooledTask(std::coroutine_handle<promise_type> handle) : Handle(handle) {}
+			UnpooledTask(UnpooledTask&& other) noexcept : Handle(std::exchange(other.Handle, nullptr)) {}
+			~UnpooledTask()
+			{
+				if (Handle)
+					Handle.destroy();
+			}
+
+			PenEngine::u64 Get()
+			{
+				Handle.resume();
+				return Handle.promise().Value;
+			}
+
+			std::coroutine_handle<promise_type> Handle;
+		};
+
+		// 模拟每个I/O请求创建一个协程，帧中保存一些局部状态
+		inline UnpooledTask UnpooledRequest(PenEngine::u64 request)
+		{
+			volatile PenEngine::u64 buffer[16] = {};
+			buffer[request % 16] = request;
+			PenEngine::u64 res = buffer[request % 16];
+			co_return res;
+		}
+
+		inline PenEngine::AsyncTask<PenEngine::u64> PooledRequest(PenEngine::u64 request)
+		{
+			volatile PenEngine::u64 buffer[16] = {};
+			buffer[request % 16] = request;
+			PenEngine::u64 res = buffer[request % 16];
+			co_return res;
+		}
+
+		// 通过Get同步等待子task，每次都在栈上嵌套一层resume
+		inline PenEngine::AsyncTask<PenEngine::u64> GetLeaves(PenEngine::u64 count)
+		{
+			PenEngine::u64 sum = 0;
+			for (PenEngine::u64 i = 0; i < count; ++i)
+			{
+				PenEngine::AsyncTask<PenEngine::u64> leaf = PooledRequest(i);
+				sum += leaf.Get();
+			}
+			co_return sum;
+		}
+
+		inline PenEngine::AsyncTask<PenEngine::u64> AwaitLeaves(PenEngine::u64 count)
+		{
+			PenEngine::u64 sum = 0;
+			for (PenEngine::u64 i = 0; i < count; ++i)
+				sum += co_await PooledRequest(i);
+			co_return sum;
+		}
+
+		inline PenEngine::AsyncTask<PenEngine::u64> ArenaRequest(std::allocator_arg_t, std::pmr::memory_resource*, PenEngine::u64 request)
+		{
+			volatile PenEngine::u64 buffer[16] = {};
+			buffer[request % 16] = request;
+			PenEngine::u64 res = buffer[request % 16];
+			co_return res;
+		}
+	}
+
+	UNIT_TEST_AREA_BEGIN(BenchmarkAsyncTask)
+	{
+		using namespace PenEngine;
+		using Clock = std::chrono::steady_clock;
+
+		auto measure = [](auto&& func)
+			{
+				Clock::time_point start = Clock::now();
+				func();
+				return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+			};
+
+		static constexpr u64 requests = 2000000;
+		// 同时在处理中的请求数，帧的创建与销毁交错进行
+		static constexpr u64 inFlight = 64;
+		static constexpr u64 expected = requests * (requests - 1) / 2;
+
+		// 每秒创建并完成的协程数，单位为万
+		auto throughput = [](std::chrono::milliseconds time)
+			{
+				return static_cast<double>(requests) / 10000.0 / std::max<double>(static_cast<double>(time.count()), 1.0) * 1000.0;
+			};
+
+		UNIT_TEST_CHECKPOINT("协程创建与销毁")
+		{
+			u64 checksum = 0;
+			auto globalTime = measure([&]
+				{
+					std::vector<Detail::UnpooledTask> tasks;
+					for (u64 i = 0; i < requests; i += inFlight)
+					{
+						for (u64 j = 0; j < inFlight; ++j)
+							tasks.push_back(Detail::UnpooledRequest(i + j));
+						for (auto& task : tasks)
+							checksum += task.Get();
+						tasks.clear();
+					}
+				});
+			UNIT_TEST_MESSAGE(Format("operator new 用时：{} 每秒：{:.0f}万个 校验：{}", globalTime, throughput(globalTime), checksum == expected))
+
+			checksum = 0;
+			auto pooledTime = measure([&]
+				{
+					std::vector<AsyncTask<u64>> tasks;
+					for (u64 i = 0; i < requests; i += inFlight)
+					{
+						for (u64 j = 0; j < inFlight; ++j)
+							tasks.push_back(Detail::PooledRequest(i + j));
+						for (auto& task : tasks)
+							checksum += task.Get();
+						tasks.clear();
+					}
+				});
+			UNIT_TEST_MESSAGE(Format("线程缓存 用时：{} 每秒：{:.0f}万个 校验：{}", pooledTime, throughput(pooledTime), checksum == expected))
+
+			checksum = 0;
+			MonotonicArena arena;
+			auto arenaTime = measure([&]
+				{
+					std::vector<AsyncTask<u64>> tasks;
+					for (u64 i = 0; i < requests; i += inFlight)
+					{
+						for (u64 j = 0; j < inFlight; ++j)
+							tasks.push_back(Detail::ArenaRequest(std::allocator_arg, &arena, i + j));
+						for (auto& task : tasks)
+							checksum += task.Get();
+						tasks.clear();
+						arena.Reset();
+					}
+				});
+			UNIT_TEST_MESSAGE(Format("MonotonicArena 用时：{} 每秒：{:.0f}万个 校验：{}", arenaTime, throughput(arenaTime), checksum == expected))
+		}
+
+		UNIT_TEST_CHECKPOINT("在协程中等待子task")
+		{
+			u64 checksum = 0;
+			auto getTime = measure([&]
+				{
+					AsyncTask<u64> task = Detail::GetLeaves(requests);
+					checksum = task.Get();
+				});
+			UNIT_TEST_MESSAGE(Format("Get 用时：{} 校验：{}", getTime, checksum == expected))
+
+			auto awaitTime = measure([&]
+				{
+					AsyncTask<u64> task = Detail::AwaitLeaves(requests);
+					checksum = task.Get();
+				});
+			UNIT_TEST_MESSAGE(Format("co_await 用时：{} 校验：{}", awaitTime, checksum == expected))
+		}
+	}
+	UNIT_TEST_AREA_END(BenchmarkAsyncTask)
+}
@@ -0,0 +1,104 @@
+// File /UnitTest/Benchmarks/Benchmark_Generator.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Coroutine/Generator.hpp"
+#include "../../Engine/String/Format.hpp"
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		// 模拟逐个产生的路径
+		inline PenEngine::String GeneratorMakePath(PenEngine::Usize i)
+		{
+			return PenEngine::Format("Assets/Textures/Group{}/Texture{}.png", i % 64, i);
+		}
+
+		inline std::vector<PenEngine::String> GeneratorCollectPaths(PenEngine::Usize count)
+		{
+			std::vector<PenEngine::String> res;
+			for (PenEngine::Usize i = 0; i < count; ++i)
+				res.push_back(GeneratorMakePath(i));
+			return res;
+		}
+
+		inline PenEngine::Generator<const PenEngine::String&> GeneratorYieldPaths(PenEngine::Usize count)
+		{
+			for (PenEngine::Usize i = 0; i < count; ++i)
+				co_yield GeneratorMakePath(i);
+		}
+
+		inline PenEngine::Generator<PenEngine::u64> GeneratorYieldNumbers(PenEngine::u64 count)
+		{
+			for (PenEngine::u64 i = 0; i < count; ++i)
+				co_yield i * i;
+		}
+	}
+
+	UNIT_TEST_AREA_BEGIN(BenchmarkGenerator)
+	{
+		using namespace PenEngine;
+		using Clock = std::chrono::steady_clock;
+
+		auto measure = [](auto&& func)
+			{
+				Clock::time_point start = Clock::now();
+				func();
+				return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+			};
+
+		static constexpr Usize pathCount = 1 << 20;
+		static constexpr u64 numberCount = 1 << 26;
+
+		UNIT_TEST_CHECKPOINT(Format("遍历{}条路径", pathCount))
+		{
+			Usize expected = 0;
+			auto vectorTime = measure([&]
+				{
+					for (const String& path : Detail::GeneratorCollectPaths(pathCount))
+						expected += path.Size();
+				});
+			UNIT_TEST_MESSAGE(Format("先生成std::vector 用时：{}", vectorTime))
+
+			Usize res = 0;
+			auto generatorTime = measure([&]
+				{
+					for (const String& path : Detail::GeneratorYieldPaths(pathCount))
+						res += path.Size();
+				});
+			UNIT_TEST_MESSAGE(Format("Generator 用时：{} 校验：{}", generatorTime, res == expected))
+		}
+
+		UNIT_TEST_CHECKPOINT(Format("产出{}个整数", numberCount))
+		{
+			u64 expected = 0;
+			auto loopTime = measure([&]
+				{
+					for (u64 i = 0; i < numberCount; ++i)
+						expected += i * i;
+				});
+			UNIT_TEST_MESSAGE(Format("循环 用时：{}", loopTime))
+
+			u64 res = 0;
+			auto generatorTime = measure([&]
+				{
+					for (u64 v : Detail::GeneratorYieldNumbers(numberCount))
+						res += v;
+				});
+			UNIT_TEST_MESSAGE(Format("Generator 用时：{} 校验：{}", generatorTime, res == expected))
+		}
+	}
+	UNIT_TEST_AREA_END(BenchmarkGenerator)
+}
@@ -0,0 +1,132 @@
+// File /UnitTest/Benchmarks/Benchmark_LargeAllocator.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Memory/LargeAllocator.h"
+#include "../../Engine/String/Format.hpp"
+#include "../UnitTestFramework.h"
+#include <cstring>
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(BenchmarkLargeAllocator)
+	{
+		using namespace PenEngine;
+		using namespace PenEngine::Memory;
+		using Clock = std::chrono::steady_clock;
+
+		auto measure = [](auto&& func)
+			{
+				Clock::time_point start = Clock::now();
+				func();
+				return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+			};
+
+		struct Allocator
+		{
+			const char* Name;
+			void* (*Allocate)(Usize bytes);
+			void (*Deallocate)(void* ptr, Usize bytes);
+		};
+
+		const Allocator allocators[] = {
+			{ "operator new", [](Usize bytes) { return operator new(bytes); }, [](void* ptr, Usize bytes) { operator delete(ptr, bytes); } },
+			{ "LargeAllocate", [](Usize bytes) { return LargeAllocate(bytes, LargeAllocationOption::None); }, [](void* ptr, Usize bytes) { LargeDeallocate(ptr, bytes); } },
+			{ "LargeAllocate(THP)", [](Usize bytes) { return LargeAllocate(bytes, LargeAllocationOption::TransparentHugePage); }, [](void* ptr, Usize bytes) { LargeDeallocate(ptr, bytes); } },
+			{ "LargeAllocate(THP|Prefault)", [](Usize bytes) { return LargeAllocate(bytes, LargeAllocationOption::TransparentHugePage | LargeAllocationOption::Prefault); }, [](void* ptr, Usize bytes) { LargeDeallocate(ptr, bytes); } },
+		};
+
+		constexpr Usize bufferBytes = 64 * 1024 * 1024;
+		constexpr Usize rounds = 8;
+
+		UNIT_TEST_CHECKPOINT("分配、写满并释放")
+		{
+			for (const Allocator& allocator : allocators)
+			{
+				auto time = measure([&]
+					{
+						for (Usize round = 0; round < rounds; ++round)
+						{
+							U8* data = static_cast<U8*>(allocator.Allocate(bufferBytes));
+							std::memset(data, static_cast<int>(round), bufferBytes);
+							allocator.Deallocate(data, bufferBytes);
+						}
+					});
+				UNIT_TEST_MESSAGE(Format("{} 大小：{}MiB 次数：{} 用时：{}", allocator.Name, bufferBytes >> 20, rounds, time))
+			}
+		}
+
+		UNIT_TEST_CHECKPOINT("随机访问已分配的内存")
+		{
+			// 访问跨度远大于TLB覆盖的范围时，大页减少的TLB缺失才能体现出来
+			std::mt19937_64 engine(42);
+			std::vector<Usize> offsets(1 << 22);
+			for (Usize& offset : offsets)
+				offset = engine() % bufferBytes;
+
+			for (const Allocator& allocator : allocators)
+			{
+				U8* data = static_cast<U8*>(allocator.Allocate(bufferBytes));
+				std::memset(data, 1, bufferBytes);
+				Usize sum = 0;
+				auto time = measure([&]
+					{
+						for (Usize round = 0; round < rounds; ++round)
+							for (Usize offset : offsets)
+								sum += data[offset];
+					});
+				allocator.Deallocate(data, bufferBytes);
+				UNIT_TEST_MESSAGE(Format("{} 次数：{} 用时：{} 校验：{}", allocator.Name, rounds * offsets.size(), time, sum))
+			}
+		}
+
+		UNIT_TEST_CHECKPOINT("逐步增长")
+		{
+			// 每次容量加倍，与BasicString扩容的方式相同
+			constexpr Usize startBytes = LargeAllocationThresholdBytes;
+
+			auto copyTime = measure([&]
+				{
+					Usize bytes = startBytes;
+					U8* data = static_cast<U8*>(operator new(bytes));
+					std::memset(data, 1, bytes);
+					while (bytes < bufferBytes * 4)
+					{
+						U8* grown = static_cast<U8*>(operator new(bytes * 2));
+						std::memcpy(grown, data, bytes);
+						std::memset(grown + bytes, 1, bytes);
+						operator delete(data, bytes);
+						data = grown;
+						bytes *= 2;
+					}
+					operator delete(data, bytes);
+				});
+			UNIT_TEST_MESSAGE(Format("operator new + memcpy 最终大小：{}MiB 用时：{}", bufferBytes * 4 >> 20, copyTime))
+
+			auto remapTime = measure([&]
+				{
+					Usize bytes = startBytes;
+					U8* data = static_cast<U8*>(LargeAllocate(bytes));
+					std::memset(data, 1, bytes);
+					while (bytes < bufferBytes * 4)
+					{
+						data = static_cast<U8*>(LargeReallocate(data, bytes, bytes * 2));
+						std::memset(data + bytes, 1, bytes);
+						bytes *= 2;
+					}
+					LargeDeallocate(data, bytes);
+				});
+			UNIT_TEST_MESSAGE(Format("LargeReallocate 最终大小：{}MiB 用时：{}", bufferBytes * 4 >> 20, remapTime))
+		}
+	}
+	UNIT_TEST_AREA_END(BenchmarkLargeAllocator)
+}
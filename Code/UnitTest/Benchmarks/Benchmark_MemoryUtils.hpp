@@ -0,0 +1,104 @@
+// File /UnitTest/Benchmarks/Benchmark_MemoryUtils.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Memory/Utils.hpp"
+#include "../../Engine/String/Format.hpp"
+#include "../UnitTestFramework.h"
+#include <memory>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(BenchmarkMemoryUtils)
+	{
+		using namespace PenEngine;
+		using Clock = std::chrono::steady_clock;
+
+		// 从1B到1GiB，每次乘以4
+		constexpr Usize maxBytes = Usize(1) << 30;
+		// 每个尺寸大约处理的总字节数，小尺寸的次数有上限，避免耗时过长
+		constexpr Usize totalBytes = Usize(1) << 32;
+		constexpr Usize maxIterations = Usize(1) << 24;
+
+		// 源与目标之间多留一些空间，小尺寸时依次错开地址，避免编译器把重复的操作合并
+		constexpr Usize slack = 64;
+		std::unique_ptr<U8[]> source(new U8[maxBytes + slack]);
+		std::unique_ptr<U8[]> target(new U8[maxBytes + slack]);
+		std::memset(source.get(), 1, maxBytes + slack);
+		std::memset(target.get(), 1, maxBytes + slack);
+
+		auto measure = [&](Usize bytes, auto&& func)
+			{
+				Usize iterations = std::clamp<Usize>(totalBytes / bytes, 2, maxIterations);
+				Usize checksum = 0;
+				Clock::time_point start = Clock::now();
+				for (Usize i = 0; i < iterations; ++i)
+					checksum += func(i % slack);
+				double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+				// 返回吞吐量GiB/s，校验值参与输出，防止循环被优化掉
+				return std::pair(static_cast<double>(bytes) * static_cast<double>(iterations) / seconds / (1 << 30), checksum);
+			};
+
+		for (Usize bytes = 1; bytes <= maxBytes; bytes *= 4)
+		{
+			UNIT_TEST_CHECKPOINT(Format("{}B", bytes))
+			{
+				auto [memcpyRate, memcpySum] = measure(bytes, [&](Usize shift)
+					{
+						std::memcpy(target.get() + shift, source.get() + slack - shift, bytes);
+						return target[shift];
+					});
+				auto [copyRate, copySum] = measure(bytes, [&](Usize shift)
+					{
+						MemoryCopy(source.get() + slack - shift, target.get() + shift, bytes);
+						return target[shift];
+					});
+				UNIT_TEST_MESSAGE(Format("复制 memcpy：{:.2f}GiB/s MemoryCopy：{:.2f}GiB/s 校验：{}", memcpyRate, copyRate, memcpySum == copySum))
+
+				auto [memmoveRate, memmoveSum] = measure(bytes, [&](Usize shift)
+					{
+						std::memmove(target.get() + shift, target.get() + slack - shift, bytes);
+						return target[shift];
+					});
+				auto [moveRate, moveSum] = measure(bytes, [&](Usize shift)
+					{
+						MemoryMove(target.get() + slack - shift, target.get() + shift, bytes);
+						return target[shift];
+					});
+				UNIT_TEST_MESSAGE(Format("重叠移动 memmove：{:.2f}GiB/s MemoryMove：{:.2f}GiB/s 校验：{}", memmoveRate, moveRate, memmoveSum == moveSum))
+
+				auto [memsetRate, memsetSum] = measure(bytes, [&](Usize shift)
+					{
+						std::memset(target.get() + shift, 1, bytes);
+						return target[shift];
+					});
+				auto [setRate, setSum] = measure(bytes, [&](Usize shift)
+					{
+						MemorySet(target.get() + shift, U8(1), bytes);
+						return target[shift];
+					});
+				UNIT_TEST_MESSAGE(Format("填充 memset：{:.2f}GiB/s MemorySet：{:.2f}GiB/s 校验：{}", memsetRate, setRate, memsetSum == setSum))
+
+				// 两块内容相同，比较需要读完全部字节
+				auto [memcmpRate, memcmpSum] = measure(bytes, [&](Usize shift)
+					{
+						return static_cast<Usize>(std::memcmp(target.get() + shift, source.get() + slack - shift, bytes) == 0);
+					});
+				auto [compareRate, compareSum] = measure(bytes, [&](Usize shift)
+					{
+						return static_cast<Usize>(MemoryCompare(target.get() + shift, source.get() + slack - shift, bytes) == 0);
+					});
+				UNIT_TEST_MESSAGE(Format("比较 memcmp：{:.2f}GiB/s MemoryCompare：{:.2f}GiB/s 校验：{}", memcmpRate, compareRate, memcmpSum == compareSum))
+			}
+		}
+	}
+	UNIT_TEST_AREA_END(BenchmarkMemoryUtils)
+}
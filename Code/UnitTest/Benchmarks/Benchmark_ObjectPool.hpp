@@ -0,0 +1,130 @@
+// File /UnitTest/Benchmarks/Benchmark_ObjectPool.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Objects/ObjectPool.hpp"
+#include "../../Engine/Objects/WorldObject.h"
+#include "../../Engine/String/Format.hpp"
+#include "../UnitTestFramework.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		class BenchmarkWorldObject : public PenEngine::WorldObject
+		{
+		public:
+			explicit BenchmarkWorldObject(PenEngine::u64 value) : Value(value) {}
+
+			PenEngine::StringView GetMetaType() const noexcept override { return "BenchmarkWorldObject"; }
+			PenEngine::Usize GetMetaHash() const noexcept override { return 0; }
+
+			PenEngine::u64 Value;
+		};
+	}
+
+	UNIT_TEST_AREA_BEGIN(BenchmarkObjectPool)
+	{
+		using namespace PenEngine;
+		using Clock = std::chrono::steady_clock;
+		using Object = Detail::BenchmarkWorldObject;
+
+		auto measure = [](auto&& func)
+			{
+				Clock::time_point start = Clock::now();
+				func();
+				return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+			};
+
+		static constexpr Usize count = 200000;
+		static constexpr Usize rounds = 50;
+
+		UNIT_TEST_CHECKPOINT("遍历所有对象")
+		{
+			// 对象与其他分配交错创建，并打乱登记顺序，模拟运行一段时间后的堆
+			std::mt19937_64 random(42);
+			std::vector<std::unique_ptr<Object>> objects;
+			std::vector<std::unique_ptr<char[]>> noise;
+			for (Usize i = 0; i < count; ++i)
+			{
+				objects.push_back(std::make_unique<Object>(i));
+				noise.push_back(std::make_unique<char[]>(random() % 256 + 1));
+			}
+			std::shuffle(objects.begin(), objects.end(), random);
+
+			u64 newSum = 0;
+			auto newTime = measure([&]
+				{
+					for (Usize round = 0; round < rounds; ++round)
+						for (const auto& object : objects)
+							newSum += object->Value;
+				});
+			UNIT_TEST_MESSAGE(Format("new 用时：{}", newTime))
+
+			ObjectPool<Object> pool;
+			for (Usize i = 0; i < count; ++i)
+				pool.Create(i);
+
+			u64 poolSum = 0;
+			auto poolTime = measure([&]
+				{
+					for (Usize round = 0; round < rounds; ++round)
+						pool.ForEach([&](const Object& object) { poolSum += object.Value; });
+				});
+			UNIT_TEST_MESSAGE(Format("ObjectPool 用时：{} 校验：{}", poolTime, newSum == poolSum))
+		}
+
+		UNIT_TEST_CHECKPOINT("创建与销毁")
+		{
+			std::vector<std::unique_ptr<Object>> objects(count);
+			auto newTime = measure([&]
+				{
+					for (Usize round = 0; round < 10; ++round)
+					{
+						for (Usize i = 0; i < count; ++i)
+							objects[i] = std::make_unique<Object>(i);
+						for (Usize i = 0; i < count; ++i)
+							objects[i].reset();
+					}
+				});
+			UNIT_TEST_MESSAGE(Format("new/delete 用时：{}", newTime))
+
+			ObjectPool<Object> pool;
+			std::vector<ObjectID> ids(count);
+			auto poolTime = measure([&]
+				{
+					for (Usize round = 0; round < 10; ++round)
+					{
+						for (Usize i = 0; i < count; ++i)
+							ids[i] = pool.Create(i);
+						for (Usize i = 0; i < count; ++i)
+							pool.Destroy(ids[i]);
+					}
+				});
+			UNIT_TEST_MESSAGE(Format("ObjectPool 用时：{}", poolTime))
+
+			for (Usize i = 0; i < count; ++i)
+				ids[i] = pool.Create(i);
+			u64 checksum = 0;
+			auto getTime = measure([&]
+				{
+					for (Usize round = 0; round < 10; ++round)
+						for (Usize i = 0; i < count; ++i)
+							checksum += pool.Get(ids[i])->Value;
+				});
+			UNIT_TEST_MESSAGE(Format("ObjectPool::Get 用时：{} 校验：{}", getTime, checksum == 10 * (count - 1) * count / 2))
+		}
+	}
+	UNIT_TEST_AREA_END(BenchmarkObjectPool)
+}
@@ -0,0 +1,116 @@
+// File /UnitTest/Benchmarks/Benchmark_PoolAllocator.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Memory/PoolAllocator.h"
+#include "../../Engine/String/Format.hpp"
+#include "../../Engine/Utils/Parallel.hpp"
+#include "../UnitTestFramework.h"
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(BenchmarkPoolAllocator)
+	{
+		using namespace PenEngine;
+		using Clock = std::chrono::steady_clock;
+
+		auto measure = [](auto&& func)
+			{
+				Clock::time_point start = Clock::now();
+				func();
+				return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+			};
+
+		struct Allocator
+		{
+			const char* Name;
+			void* (*Allocate)(Usize bytes);
+			void (*Deallocate)(void* ptr, Usize bytes);
+		};
+
+		// 修改前Memory::Allocate<Ch>走的是带align_val_t的operator new
+		const Allocator allocators[] = {
+			{ "operator new(align_val_t)", [](Usize bytes) { return operator new(bytes, std::align_val_t{ 1 }); }, [](void* ptr, Usize bytes) { operator delete(ptr, bytes, std::align_val_t{ 1 }); } },
+			{ "operator new", [](Usize bytes) { return operator new(bytes); }, [](void* ptr, Usize bytes) { operator delete(ptr, bytes); } },
+			{ "PoolAllocate", [](Usize bytes) { return Memory::PoolAllocate(bytes); }, [](void* ptr, Usize bytes) { Memory::PoolDeallocate(ptr, bytes); } },
+		};
+
+		constexpr Usize rounds = 200;
+		constexpr Usize batch = 4096;
+		// 至少使用4个线程，保证跨线程释放的路径被覆盖
+		Usize threadCount = std::max<Usize>(4, HardwareConcurrency());
+
+		// 字符串常见的长度，按BasicString<Ch>的AllocateMask取整后再加上结尾空字符
+		std::vector<Usize> sizes(batch);
+		std::mt19937 engine(42);
+		std::uniform_int_distribution<Usize> lengthDistribution(24, 256);
+		for (Usize& size : sizes)
+			size = (lengthDistribution(engine) | 15) + 1;
+
+		UNIT_TEST_CHECKPOINT("每个线程独立分配与释放")
+		{
+			for (const Allocator& allocator : allocators)
+			{
+				auto time = measure([&]
+					{
+						ParallelFor(threadCount, [&](Usize)
+							{
+								std::vector<void*> ptrs(batch);
+								for (Usize round = 0; round < rounds; ++round)
+								{
+									for (Usize i = 0; i < batch; ++i)
+										ptrs[i] = allocator.Allocate(sizes[i]);
+									for (Usize i = 0; i < batch; ++i)
+										allocator.Deallocate(ptrs[i], sizes[i]);
+								}
+							}, threadCount);
+					});
+				UNIT_TEST_MESSAGE(Format("{} 线程数：{} 次数：{} 用时：{}", allocator.Name, threadCount, threadCount * rounds * batch, time))
+			}
+		}
+
+		UNIT_TEST_CHECKPOINT("跨线程释放")
+		{
+			// 第i个任务释放第i - 1个任务在上一轮分配的内存
+			for (const Allocator& allocator : allocators)
+			{
+				std::vector<std::vector<void*>> ptrs(threadCount, std::vector<void*>(batch));
+				auto time = measure([&]
+					{
+						for (Usize round = 0; round < rounds / 10; ++round)
+						{
+							ParallelFor(threadCount, [&](Usize task)
+								{
+									if (round != 0)
+									{
+										std::vector<void*>& previous = ptrs[(task + threadCount - 1) % threadCount];
+										for (Usize i = 0; i < batch; ++i)
+											allocator.Deallocate(previous[i], sizes[i]);
+									}
+								}, threadCount);
+							ParallelFor(threadCount, [&](Usize task)
+								{
+									for (Usize i = 0; i < batch; ++i)
+										ptrs[task][i] = allocator.Allocate(sizes[i]);
+								}, threadCount);
+						}
+					});
+
+				for (std::vector<void*>& list : ptrs)
+					for (Usize i = 0; i < batch; ++i)
+						allocator.Deallocate(list[i], sizes[i]);
+				UNIT_TEST_MESSAGE(Format("{} 线程数：{} 次数：{} 用时：{}", allocator.Name, threadCount, threadCount * rounds / 10 * batch, time))
+			}
+		}
+	}
+	UNIT_TEST_AREA_END(BenchmarkPoolAllocator)
+}
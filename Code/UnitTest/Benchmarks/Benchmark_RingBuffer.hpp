@@ -0,0 +1,194 @@
+// File /UnitTest/Benchmarks/Benchmark_RingBuffer.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Container/RingBuffer.hpp"
+#include "../../Engine/String/Format.hpp"
+#include "../UnitTestFramework.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		// 对照组：互斥锁加条件变量保护的std::deque，与改造前SpdlogSTSharedContext的做法相同
+		template <typename T>
+		class MutexQueue
+		{
+		public:
+			explicit MutexQueue(PenEngine::Usize capacity) : m_capacity(capacity) {}
+
+			void Push(T value)
+			{
+				std::unique_lock lock(m_mutex);
+				m_notFull.wait(lock, [this] { return m_queue.size() < m_capacity; });
+				m_queue.push_back(std::move(value));
+				lock.unlock();
+				m_notEmpty.notify_one();
+			}
+
+			T Pop()
+			{
+				std::unique_lock lock(m_mutex);
+				m_notEmpty.wait(lock, [this] { return !m_queue.empty(); });
+				T value = std::move(m_queue.front());
+				m_queue.pop_front();
+				lock.unlock();
+				m_notFull.notify_one();
+				return value;
+			}
+		private:
+			PenEngine::Usize m_capacity;
+			std::mutex m_mutex;
+			std::condition_variable m_notEmpty;
+			std::condition_variable m_notFull;
+			std::deque<T> m_queue;
+		};
+
+		// threads个生产者与threads个消费者共传递count个值，返回消费者收到的总和
+		template <typename Queue>
+		PenEngine::u64 RingBufferTransfer(Queue& queue, PenEngine::u64 threads, PenEngine::u64 count)
+		{
+			std::atomic<PenEngine::u64> sum = 0;
+			std::vector<std::thread> workers;
+			PenEngine::u64 perThread = count / threads;
+			for (PenEngine::u64 t = 0; t < threads; ++t)
+			{
+				workers.emplace_back([&queue, perThread]
+					{
+						for (PenEngine::u64 i = 0; i < perThread; ++i)
+							queue.Push(i);
+					});
+				workers.emplace_back([&queue, &sum, perThread]
+					{
+						PenEngine::u64 local = 0;
+						for (PenEngine::u64 i = 0; i < perThread; ++i)
+							local += queue.Pop();
+						sum += local;
+					});
+			}
+			for (auto& worker : workers)
+				worker.join();
+			return sum;
+		}
+	}
+
+	UNIT_TEST_AREA_BEGIN(BenchmarkRingBuffer)
+	{
+		using namespace PenEngine;
+		using Clock = std::chrono::steady_clock;
+
+		auto measure = [](auto&& func)
+			{
+				Clock::time_point start = Clock::now();
+				func();
+				return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+			};
+
+		static constexpr u64 count = 1 << 20;
+		static constexpr Usize capacity = 1024;
+
+		UNIT_TEST_MESSAGE(Format("硬件线程数：{}，线程数超过硬件线程数时结果主要反映调度开销", std::thread::hardware_concurrency()))
+
+		// 队列满或空时让出时间片而不是空转
+		UNIT_TEST_CHECKPOINT("单生产者单消费者")
+		{
+			u64 checksum = 0;
+			auto spscTime = measure([&]
+				{
+					SPSCRingBuffer<u64> queue(capacity);
+					std::thread producer([&]
+						{
+							for (u64 i = 0; i < count; ++i)
+							{
+								while (!queue.TryPush(i))
+									std::this_thread::yield();
+							}
+						});
+					for (u64 i = 0; i < count;)
+					{
+						if (std::optional<u64> value = queue.TryPop())
+						{
+							checksum += *value;
+							++i;
+						}
+						else
+						{
+							std::this_thread::yield();
+						}
+					}
+					producer.join();
+				});
+			UNIT_TEST_MESSAGE(Format("SPSCRingBuffer 用时：{} 校验：{}", spscTime, checksum == count * (count - 1) / 2))
+
+			checksum = 0;
+			auto batchTime = measure([&]
+				{
+					SPSCRingBuffer<u64> queue(capacity);
+					std::thread producer([&]
+						{
+							u64 values[64];
+							for (u64 i = 0; i < count;)
+							{
+								for (u64 j = 0; j < 64; ++j)
+									values[j] = i + j;
+								Usize n = queue.TryPushBatch(std::begin(values), std::begin(values) + std::min<u64>(64, count - i));
+								if (n == 0)
+									std::this_thread::yield();
+								i += n;
+							}
+						});
+					u64 values[64];
+					for (u64 i = 0; i < count;)
+					{
+						Usize n = queue.TryPopBatch(values, 64);
+						if (n == 0)
+							std::this_thread::yield();
+						for (Usize j = 0; j < n; ++j)
+							checksum += values[j];
+						i += n;
+					}
+					producer.join();
+				});
+			UNIT_TEST_MESSAGE(Format("SPSCRingBuffer 批量 用时：{} 校验：{}", batchTime, checksum == count * (count - 1) / 2))
+		}
+
+		UNIT_TEST_CHECKPOINT("多生产者多消费者")
+		{
+			for (u64 threads : { 1, 2, 4, 8 })
+			{
+				u64 expected = threads * (count / threads) * (count / threads - 1) / 2;
+
+				u64 mutexSum = 0;
+				auto mutexTime = measure([&]
+					{
+						Detail::MutexQueue<u64> queue(capacity);
+						mutexSum = Detail::RingBufferTransfer(queue, threads, count);
+					});
+
+				u64 ringSum = 0;
+				auto ringTime = measure([&]
+					{
+						BlockingRingBuffer<MPMCRingBuffer<u64>> queue(capacity);
+						ringSum = Detail::RingBufferTransfer(queue, threads, count);
+					});
+
+				UNIT_TEST_MESSAGE(Format("{}对线程 mutex+deque 用时：{} BlockingRingBuffer 用时：{} 校验：{}",
+										 threads, mutexTime, ringTime, mutexSum == expected && ringSum == expected))
+			}
+		}
+	}
+	UNIT_TEST_AREA_END(BenchmarkRingBuffer)
+}
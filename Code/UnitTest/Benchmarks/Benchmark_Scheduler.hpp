@@ -0,0 +1,142 @@
+// File /UnitTest/Benchmarks/Benchmark_Scheduler.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Coroutine/Scheduler.h"
+#include "../../Engine/String/Format.hpp"
+#include "../../Engine/Utils/Parallel.hpp"
+#include "../UnitTestFramework.h"
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		// 模拟一段有计算量的任务
+		inline PenEngine::u64 SchedulerWork(PenEngine::u64 seed)
+		{
+			PenEngine::u64 state = seed | 1;
+			for (int i = 0; i < 2000; ++i)
+			{
+				state ^= state << 13;
+				state ^= state >> 7;
+				state ^= state << 17;
+			}
+			return state & 0xFF;
+		}
+
+		inline PenEngine::AsyncTask<PenEngine::u64> SchedulerWorkTask(PenEngine::u64 seed)
+		{
+			co_return SchedulerWork(seed);
+		}
+
+		inline PenEngine::AsyncTask<PenEngine::u64> SchedulerTree(PenEngine::Scheduler* scheduler, PenEngine::u64 depth, PenEngine::u64 seed)
+		{
+			if (depth == 0)
+				co_return SchedulerWork(seed);
+
+			PenEngine::AsyncTask<PenEngine::u64> left = SchedulerTree(scheduler, depth - 1, seed * 2);
+			PenEngine::AsyncTask<PenEngine::u64> right = SchedulerTree(scheduler, depth - 1, seed * 2 + 1);
+			if (scheduler == nullptr)
+				co_return left.Get() + right.Get();
+
+			scheduler->Spawn(left);
+			PenEngine::u64 r = scheduler->Join(right);
+			PenEngine::u64 l = scheduler->Join(left);
+			co_return l + r;
+		}
+	}
+
+	UNIT_TEST_AREA_BEGIN(BenchmarkScheduler)
+	{
+		using namespace PenEngine;
+		using Clock = std::chrono::steady_clock;
+
+		auto measure = [](auto&& func)
+			{
+				Clock::time_point start = Clock::now();
+				func();
+				return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+			};
+
+		auto statistics = [](const Scheduler& scheduler)
+			{
+				String res;
+				for (Usize i = 0; i < scheduler.WorkerCount(); ++i)
+				{
+					Scheduler::WorkerStatistics s = scheduler.GetWorkerStatistics(i);
+					res += Format("[{}] 执行{} 窃取{}/{} 注入{} 休眠{} ", i, s.Executed, s.Stolen, s.StealAttempts, s.Injected, s.Parked);
+				}
+				return res;
+			};
+
+		static constexpr u64 depth = 14;
+		static constexpr u64 count = 1 << depth;
+
+		UNIT_TEST_MESSAGE(Format("硬件线程数：{}", HardwareConcurrency()))
+
+		UNIT_TEST_CHECKPOINT("分叉与合并")
+		{
+			u64 expected = 0;
+			auto serialTime = measure([&]
+				{
+					AsyncTask<u64> task = Detail::SchedulerTree(nullptr, depth, 1);
+					expected = task.Get();
+				});
+			UNIT_TEST_MESSAGE(Format("单线程 用时：{}", serialTime))
+
+			for (Usize workers : { 1, 2, 4, 8 })
+			{
+				Scheduler scheduler(workers);
+				u64 res = 0;
+				auto time = measure([&]
+					{
+						AsyncTask<u64> task = Detail::SchedulerTree(&scheduler, depth, 1);
+						scheduler.Spawn(task);
+						res = scheduler.Join(task);
+					});
+				UNIT_TEST_MESSAGE(Format("{}个工作线程 用时：{} 校验：{}", workers, time, res == expected))
+				UNIT_TEST_MESSAGE(statistics(scheduler))
+			}
+		}
+
+		UNIT_TEST_CHECKPOINT("从外部线程提交独立任务")
+		{
+			std::vector<u64> results(count);
+			auto parallelTime = measure([&]
+				{
+					ParallelFor(count, [&](Usize i) { results[i] = Detail::SchedulerWork(i); });
+				});
+			u64 expected = 0;
+			for (u64 v : results)
+				expected += v;
+			UNIT_TEST_MESSAGE(Format("ParallelFor 用时：{}", parallelTime))
+
+			Scheduler scheduler;
+			u64 sum = 0;
+			auto schedulerTime = measure([&]
+				{
+					std::vector<AsyncTask<u64>> tasks;
+					tasks.reserve(count);
+					for (u64 i = 0; i < count; ++i)
+					{
+						tasks.push_back(Detail::SchedulerWorkTask(i));
+						scheduler.Spawn(tasks.back());
+					}
+					for (auto& task : tasks)
+						sum += task.Get();
+				});
+			UNIT_TEST_MESSAGE(Format("Scheduler 用时：{} 校验：{}", schedulerTime, sum == expected))
+			UNIT_TEST_MESSAGE(statistics(scheduler))
+		}
+	}
+	UNIT_TEST_AREA_END(BenchmarkScheduler)
+}
@@ -0,0 +1,250 @@
+// File /UnitTest/Benchmarks/Benchmark_SmallVector.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Container/SmallVector.hpp"
+#include "../../Engine/String/Format.hpp"
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		inline thread_local PenEngine::u64 t_benchmarkVectorAllocations = 0;
+
+		// 修改前这些调用点使用std::vector，这里统计它的分配次数
+		template <typename T>
+		struct CountingAllocator
+		{
+			using value_type = T;
+
+			CountingAllocator() noexcept = default;
+			template <typename U>
+			CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+			T* allocate(PenEngine::Usize count)
+			{
+				++t_benchmarkVectorAllocations;
+				return std::allocator<T>().allocate(count);
+			}
+
+			void deallocate(T* ptr, PenEngine::Usize count) noexcept
+			{
+				std::allocator<T>().deallocate(ptr, count);
+			}
+
+			bool operator==(const CountingAllocator&) const noexcept = default;
+		};
+
+		// 与String相同，但没有特化IsTriviallyRelocatable，扩容时逐个移动构造
+		struct MovedString
+		{
+			PenEngine::String Value;
+		};
+	}
+
+	UNIT_TEST_AREA_BEGIN(BenchmarkSmallVector)
+	{
+		using namespace PenEngine;
+		using Clock = std::chrono::steady_clock;
+
+		auto measure = [](auto&& func)
+			{
+				Clock::time_point start = Clock::now();
+				func();
+				return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+			};
+
+		auto containerAllocations = []
+			{
+				return Memory::GetMemoryStatistics()[Memory::MemoryTag::Container].AllocationCount;
+			};
+
+		constexpr Usize rounds = 200000;
+
+		// 典型的相对路径与以逗号分隔的短列表
+		std::mt19937 engine(42);
+		std::vector<String> texts;
+		std::vector<std::vector<StringView>> paths;
+		const StringView blocks[] = { "Assets", "Textures", "..", "Characters", "Hero", ".", "Diffuse.png", "Shaders", "Common" };
+		for (Usize i = 0; i < 256; ++i)
+		{
+			String text;
+			std::vector<StringView> path;
+			Usize count = 2 + engine() % 6;
+			for (Usize j = 0; j < count; ++j)
+			{
+				if (j != 0)
+					text += ',';
+				text += blocks[engine() % std::size(blocks)];
+				path.push_back(blocks[engine() % std::size(blocks)]);
+			}
+			texts.push_back(std::move(text));
+			paths.push_back(std::move(path));
+		}
+
+		UNIT_TEST_CHECKPOINT("String::Split")
+		{
+			// 修改前的实现返回std::vector
+			auto splitToVector = [](const String& text, Ch ch)
+				{
+					std::vector<String, Detail::CountingAllocator<String>> res;
+					Usize st = 0;
+					while (true)
+					{
+						Usize off = text.Find(ch, st);
+						if (off == String::NPos)
+						{
+							res.emplace_back(text.Substr(st));
+							return res;
+						}
+						res.emplace_back(text.Substr(st, off - st));
+						st = off + 1;
+					}
+				};
+
+			Usize checksum = 0;
+			Detail::t_benchmarkVectorAllocations = 0;
+			auto vectorTime = measure([&]
+				{
+					for (Usize i = 0; i < rounds; ++i)
+						checksum += splitToVector(texts[i % texts.size()], ',').size();
+				});
+			UNIT_TEST_MESSAGE(Format("std::vector 用时：{} 容器分配次数：{}", vectorTime, Detail::t_benchmarkVectorAllocations))
+
+			u64 before = containerAllocations();
+			auto smallTime = measure([&]
+				{
+					for (Usize i = 0; i < rounds; ++i)
+						checksum -= texts[i % texts.size()].Split(',').size();
+				});
+			UNIT_TEST_MESSAGE(Format("SmallVector 用时：{} 容器分配次数：{} 校验：{}", smallTime, containerAllocations() - before, checksum == 0))
+		}
+
+		UNIT_TEST_CHECKPOINT("路径规范化的层级栈")
+		{
+			// 与Path::LexicallyNormal相同的压栈与弹栈
+			auto normalize = [&](auto& stack, const std::vector<StringView>& path)
+				{
+					for (StringView block : path)
+					{
+						if (block == ".")
+							continue;
+						if (block == ".." && !stack.empty() && stack.back() != "..")
+							stack.pop_back();
+						else
+							stack.push_back(block);
+					}
+					return stack.size();
+				};
+
+			Usize checksum = 0;
+			Detail::t_benchmarkVectorAllocations = 0;
+			auto vectorTime = measure([&]
+				{
+					for (Usize i = 0; i < rounds * 4; ++i)
+					{
+						std::vector<StringView, Detail::CountingAllocator<StringView>> stack;
+						checksum += normalize(stack, paths[i % paths.size()]);
+					}
+				});
+			UNIT_TEST_MESSAGE(Format("std::vector 用时：{} 容器分配次数：{}", vectorTime, Detail::t_benchmarkVectorAllocations))
+
+			u64 before = containerAllocations();
+			auto smallTime = measure([&]
+				{
+					for (Usize i = 0; i < rounds * 4; ++i)
+					{
+						SmallVector<StringView, 16> stack;
+						checksum -= normalize(stack, paths[i % paths.size()]);
+					}
+				});
+			UNIT_TEST_MESSAGE(Format("SmallVector 用时：{} 容器分配次数：{} 校验：{}", smallTime, containerAllocations() - before, checksum == 0))
+		}
+
+		UNIT_TEST_CHECKPOINT("每个文件的测试列表")
+		{
+			// UnitTestManager按文件登记，每个文件通常只有一到两个测试
+			struct Node
+			{
+				String TestName;
+				void* InvokerPtr;
+			};
+
+			Usize checksum = 0;
+			Detail::t_benchmarkVectorAllocations = 0;
+			auto vectorTime = measure([&]
+				{
+					for (Usize i = 0; i < rounds; ++i)
+					{
+						std::vector<Node, Detail::CountingAllocator<Node>> nodes;
+						for (Usize j = 0; j <= i % 3; ++j)
+							nodes.emplace_back(String("TestName"), nullptr);
+						checksum += nodes.size();
+					}
+				});
+			UNIT_TEST_MESSAGE(Format("std::vector 用时：{} 容器分配次数：{}", vectorTime, Detail::t_benchmarkVectorAllocations))
+
+			u64 before = containerAllocations();
+			auto smallTime = measure([&]
+				{
+					for (Usize i = 0; i < rounds; ++i)
+					{
+						SmallVector<Node, 4> nodes;
+						for (Usize j = 0; j <= i % 3; ++j)
+							nodes.emplace_back(String("TestName"), nullptr);
+						checksum -= nodes.size();
+					}
+				});
+			UNIT_TEST_MESSAGE(Format("SmallVector 用时：{} 容器分配次数：{} 校验：{}", smallTime, containerAllocations() - before, checksum == 0))
+		}
+
+		UNIT_TEST_CHECKPOINT("String元素的扩容与插入")
+		{
+			static constexpr Usize count = 1 << 16;
+			static constexpr Usize insertCount = 4096;
+
+			auto run = [&]<typename Element>(std::type_identity<Element>)
+				{
+					Usize checksum = 0;
+					auto growTime = measure([&]
+						{
+							for (Usize round = 0; round < 20; ++round)
+							{
+								SmallVector<Element, 4> v;
+								for (Usize i = 0; i < count; ++i)
+									v.push_back(Element{ String("a string that is stored on the heap") });
+								checksum += v.size();
+							}
+						});
+					auto insertTime = measure([&]
+						{
+							SmallVector<Element, 4> v;
+							for (Usize i = 0; i < insertCount; ++i)
+								v.insert(v.begin() + static_cast<Isize>(i / 2), Element{ String("short") });
+							for (Usize i = 0; i < insertCount; ++i)
+								v.erase(v.begin() + static_cast<Isize>(v.size() / 2));
+							checksum += v.size();
+						});
+					return std::tuple(growTime, insertTime, checksum);
+				};
+
+			auto [movedGrow, movedInsert, movedChecksum] = run(std::type_identity<Detail::MovedString>());
+			UNIT_TEST_MESSAGE(Format("逐个移动 扩容用时：{} 中间插入与删除用时：{}", movedGrow, movedInsert))
+
+			auto [relocatedGrow, relocatedInsert, relocatedChecksum] = run(std::type_identity<String>());
+			UNIT_TEST_MESSAGE(Format("按字节搬动 扩容用时：{} 中间插入与删除用时：{} 校验：{}", relocatedGrow, relocatedInsert, movedChecksum == relocatedChecksum))
+		}
+	}
+	UNIT_TEST_AREA_END(BenchmarkSmallVector)
+}
@@ -0,0 +1,88 @@
+// File /UnitTest/Benchmarks/Benchmark_StringSort.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/String/Format.hpp"
+#include "../../Engine/String/StringSort.hpp"
+#include "../UnitTestFramework.h"
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(BenchmarkStringSort)
+	{
+		using namespace PenEngine;
+		using Clock = std::chrono::steady_clock;
+
+		auto measure = [](auto&& func)
+			{
+				Clock::time_point start = Clock::now();
+				func();
+				return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+			};
+
+		auto makeKeys = [](Usize count, Usize minLength, Usize maxLength)
+			{
+				std::mt19937 engine(42);
+				std::uniform_int_distribution<Usize> lengthDistribution(minLength, maxLength);
+				std::uniform_int_distribution<int> charDistribution('a', 'z');
+
+				std::vector<String> res;
+				res.reserve(count);
+				for (Usize i = 0; i < count; ++i)
+				{
+					Usize length = lengthDistribution(engine);
+					String s(length);
+					for (Usize j = 0; j < length; ++j)
+						s.Append(static_cast<Ch>(charDistribution(engine)));
+					res.push_back(std::move(s));
+				}
+				return res;
+			};
+
+		auto lessView = [](const String& lhs, const String& rhs)
+			{
+				return std::string_view(lhs.Data(), lhs.Size()) < std::string_view(rhs.Data(), rhs.Size());
+			};
+
+		struct Case
+		{
+			const char* Name;
+			Usize Count;
+			Usize MinLength;
+			Usize MaxLength;
+		};
+
+		// 短键走SSO，长键位于堆上，std::sort的每次比较都需要跟随指针
+		constexpr Case cases[] = {
+			{ "短键（SSO）",1'000'000,4,16 },
+			{ "长键（堆）",1'000'000,32,96 },
+			{ "小规模串行",50'000,8,48 },
+		};
+
+		for (const Case& c : cases)
+		{
+			UNIT_TEST_CHECKPOINT(c.Name)
+			{
+				std::vector<String> keys = makeKeys(c.Count, c.MinLength, c.MaxLength);
+				std::vector<String> stdSorted = keys;
+				std::vector<String> radixSorted = keys;
+
+				auto stdTime = measure([&] { std::sort(stdSorted.begin(), stdSorted.end(), lessView); });
+				auto radixTime = measure([&] { StringRadixSort(radixSorted); });
+
+				UNIT_TEST_CONDITION("结果一致", stdSorted == radixSorted)
+				UNIT_TEST_MESSAGE(Format("{} 数量：{} std::sort：{} StringRadixSort：{}", c.Name, c.Count, stdTime, radixTime))
+			}
+		}
+	}
+	UNIT_TEST_AREA_END(BenchmarkStringSort)
+}
@@ -0,0 +1,115 @@
+// File /UnitTest/Benchmarks/Benchmark_WhenAll.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Coroutine/Scheduler.h"
+#include "../../Engine/Coroutine/WhenAll.hpp"
+#include "../../Engine/String/Format.hpp"
+#include "../UnitTestFramework.h"
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		inline PenEngine::AsyncTask<PenEngine::u64> WhenAllLoad(PenEngine::Scheduler& scheduler, PenEngine::u64 seed)
+		{
+			co_await scheduler.Schedule();
+			PenEngine::u64 state = seed | 1;
+			for (int i = 0; i < 500; ++i)
+			{
+				state ^= state << 13;
+				state ^= state >> 7;
+				state ^= state << 17;
+			}
+			co_return state & 0xFF;
+		}
+
+		// 在协程中逐个等待
+		inline PenEngine::AsyncTask<PenEngine::u64> WhenAllSequential(std::vector<PenEngine::AsyncTask<PenEngine::u64>>& tasks)
+		{
+			PenEngine::u64 sum = 0;
+			for (auto& task : tasks)
+				sum += co_await task;
+			co_return sum;
+		}
+
+		inline PenEngine::AsyncTask<PenEngine::u64> WhenAllFanOut(std::vector<PenEngine::AsyncTask<PenEngine::u64>>& tasks)
+		{
+			PenEngine::u64 sum = 0;
+			for (PenEngine::u64 v : co_await PenEngine::WhenAll(tasks))
+				sum += v;
+			co_return sum;
+		}
+	}
+
+	UNIT_TEST_AREA_BEGIN(BenchmarkWhenAll)
+	{
+		using namespace PenEngine;
+		using Clock = std::chrono::steady_clock;
+
+		static constexpr u64 count = 500;
+		static constexpr u64 rounds = 40;
+
+		auto measure = [](auto&& func)
+			{
+				Clock::time_point start = Clock::now();
+				func();
+				return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+			};
+
+		Scheduler scheduler;
+		auto run = [&](auto&& join)
+			{
+				u64 sum = 0;
+				for (u64 r = 0; r < rounds; ++r)
+				{
+					std::vector<AsyncTask<u64>> tasks;
+					tasks.reserve(count);
+					for (u64 i = 0; i < count; ++i)
+						tasks.push_back(Detail::WhenAllLoad(scheduler, i));
+					sum += join(tasks);
+				}
+				return sum;
+			};
+
+		UNIT_TEST_CHECKPOINT(Format("{}轮，每轮等待{}个task", rounds, count))
+		{
+			u64 expected = 0;
+			auto getTime = measure([&]
+				{
+					expected = run([](std::vector<AsyncTask<u64>>& tasks)
+						{
+							u64 sum = 0;
+							for (auto& task : tasks)
+								sum += task.Get();
+							return sum;
+						});
+				});
+			UNIT_TEST_MESSAGE(Format("逐个Get 用时：{}", getTime))
+
+			u64 sequential = 0;
+			auto sequentialTime = measure([&]
+				{
+					sequential = run([](std::vector<AsyncTask<u64>>& tasks) { return Detail::WhenAllSequential(tasks).Get(); });
+				});
+			UNIT_TEST_MESSAGE(Format("逐个co_await 用时：{} 校验：{}", sequentialTime, sequential == expected))
+
+			u64 fanOut = 0;
+			auto whenAllTime = measure([&]
+				{
+					fanOut = run([](std::vector<AsyncTask<u64>>& tasks) { return Detail::WhenAllFanOut(tasks).Get(); });
+				});
+			UNIT_TEST_MESSAGE(Format("WhenAll 用时：{} 校验：{}", whenAllTime, fanOut == expected))
+		}
+	}
+	UNIT_TEST_AREA_END(BenchmarkWhenAll)
+}
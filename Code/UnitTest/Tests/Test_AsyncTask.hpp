@@ -0,0 +1,223 @@
+// File /UnitTest/Tests/Test_AsyncTask.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Coroutine/AsyncTask.hpp"
+#include "../../Engine/Coroutine/Awaiter.hpp"
+#include "../../Engine/Coroutine/Scheduler.h"
+#include "../../Engine/Memory/MonotonicArena.h"
+#include "../UnitTestFramework.h"
+#include <memory>
+#include <stdexcept>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		inline PenEngine::AsyncTask<int> AsyncTaskAdd(int a, int b)
+		{
+			co_return a + b;
+		}
+
+		inline PenEngine::AsyncTask<int> AsyncTaskThrow()
+		{
+			throw std::runtime_error("coroutine");
+			co_return 0;
+		}
+
+		inline PenEngine::AsyncTask<int> AsyncTaskInArena(std::allocator_arg_t, std::pmr::memory_resource*, int value)
+		{
+			co_return value * 2;
+		}
+
+		struct AsyncTaskOwner
+		{
+			int Base = 100;
+
+			PenEngine::AsyncTask<int> Add(std::allocator_arg_t, std::pmr::memory_resource*, int value)
+			{
+				co_return Base + value;
+			}
+		};
+
+		inline PenEngine::AsyncTask<int> AsyncTaskAwaitAdd(int a, int b)
+		{
+			PenEngine::AsyncTask<int> first = AsyncTaskAdd(a, b);
+			int x = co_await first;
+			int y = co_await first;
+			co_return x + y + co_await AsyncTaskAdd(a, b);
+		}
+
+		inline PenEngine::AsyncTask<void> AsyncTaskIncrement(int& value)
+		{
+			++value;
+			co_return;
+		}
+
+		inline PenEngine::AsyncTask<void> AsyncTaskIncrementTwice(int& value)
+		{
+			co_await AsyncTaskIncrement(value);
+			co_await AsyncTaskIncrement(value);
+		}
+
+		// 只能移动，也不能默认构造
+		struct AsyncTaskNoDefault
+		{
+			explicit AsyncTaskNoDefault(int value) : Value(value) {}
+			int Value;
+		};
+
+		inline PenEngine::AsyncTask<std::unique_ptr<int>> AsyncTaskMakeUnique(int value)
+		{
+			co_return std::make_unique<int>(value);
+		}
+
+		inline PenEngine::AsyncTask<AsyncTaskNoDefault> AsyncTaskMoveOnly(int value)
+		{
+			std::unique_ptr<int> p = co_await AsyncTaskMakeUnique(value);
+			co_return AsyncTaskNoDefault(*p + 1);
+		}
+
+		inline PenEngine::AsyncTask<int> AsyncTaskCatch()
+		{
+			try
+			{
+				co_await AsyncTaskThrow();
+			}
+			catch (const std::runtime_error&)
+			{
+				co_return 1;
+			}
+			co_return 0;
+		}
+
+		inline PenEngine::AsyncTask<void> AsyncTaskRethrow()
+		{
+			co_await AsyncTaskThrow();
+		}
+
+		// 每一层都等待下一层，没有对称转移时会在栈上嵌套depth层resume
+		inline PenEngine::AsyncTask<PenEngine::u64> AsyncTaskChain(PenEngine::u64 depth)
+		{
+			if (depth == 0)
+				co_return 0;
+			co_return co_await AsyncTaskChain(depth - 1) + 1;
+		}
+
+		inline PenEngine::AsyncTask<int> AsyncTaskAwaitScheduled(PenEngine::Scheduler& scheduler)
+		{
+			PenEngine::AsyncTask<int> child = AsyncTaskAdd(20, 22);
+			scheduler.Spawn(child);
+			co_return co_await child;
+		}
+	}
+
+	UNIT_TEST_AREA_BEGIN(TestAsyncTask)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 AsyncTask")
+
+		UNIT_TEST_CHECKPOINT("协程帧从内存池分配")
+		{
+			u64 before = GetPooledCoroutineFrameCount();
+			{
+				AsyncTask<int> task = Detail::AsyncTaskAdd(1, 2);
+				AsyncTask<int> other = Detail::AsyncTaskAdd(3, 4);
+				UNIT_TEST_CONDITION("统计使用中的帧", GetPooledCoroutineFrameCount() == before + 2)
+				UNIT_TEST_CONDITION("结果", task.Get() == 3 && other.Get() == 7 && task.Done())
+				UNIT_TEST_CONDITION("结束后帧仍然保留", GetPooledCoroutineFrameCount() == before + 2 && task.Get() == 3)
+
+				AsyncTask<int> moved = std::move(task);
+				UNIT_TEST_CONDITION("移动", moved.Get() == 3 && GetPooledCoroutineFrameCount() == before + 2)
+			}
+			UNIT_TEST_CONDITION("析构时释放帧", GetPooledCoroutineFrameCount() == before)
+		}
+
+		UNIT_TEST_CHECKPOINT("协程帧从内存资源分配")
+		{
+			MonotonicArena arena(4096);
+			u64 before = GetPooledCoroutineFrameCount();
+			AsyncTask<int> task = Detail::AsyncTaskInArena(std::allocator_arg, &arena, 21);
+			Detail::AsyncTaskOwner owner;
+			AsyncTask<int> member = owner.Add(std::allocator_arg, &arena, 1);
+			UNIT_TEST_CONDITION("帧位于内存资源中", arena.UsedBytes() > 0 && GetPooledCoroutineFrameCount() == before)
+			UNIT_TEST_CONDITION("结果", task.Get() == 42 && member.Get() == 101)
+		}
+
+		UNIT_TEST_CHECKPOINT("异常")
+		{
+			AsyncTask<int> task = Detail::AsyncTaskThrow();
+			bool thrown = false;
+			try
+			{
+				task.Get();
+			}
+			catch (const std::runtime_error&)
+			{
+				thrown = true;
+			}
+			UNIT_TEST_CONDITION("Get时重新抛出", thrown && task.Done())
+
+			AsyncTask<int> caught = Detail::AsyncTaskCatch();
+			UNIT_TEST_CONDITION("在co_await处重新抛出", caught.Get() == 1)
+
+			AsyncTask<void> rethrown = Detail::AsyncTaskRethrow();
+			thrown = false;
+			try
+			{
+				rethrown.Get();
+			}
+			catch (const std::runtime_error&)
+			{
+				thrown = true;
+			}
+			UNIT_TEST_CONDITION("沿等待链向上传递", thrown)
+		}
+
+		UNIT_TEST_CHECKPOINT("co_await")
+		{
+			static_assert(Awaitable<AsyncTask<int>&> && Awaitable<AsyncTask<void>>);
+			static_assert(std::same_as<AwaitResultT<AsyncTask<int>&>, int&> && std::same_as<AwaitResultT<AsyncTask<int>>, int>);
+
+			AsyncTask<int> task = Detail::AsyncTaskAwaitAdd(1, 2);
+			UNIT_TEST_CONDITION("等待其他task", task.Get() == 9)
+
+			int value = 0;
+			AsyncTask<void> increment = Detail::AsyncTaskIncrementTwice(value);
+			increment.Get();
+			UNIT_TEST_CONDITION("void", value == 2 && increment.Done())
+
+			AsyncTask<Detail::AsyncTaskNoDefault> moveOnly = Detail::AsyncTaskMoveOnly(41);
+			UNIT_TEST_CONDITION("只能移动且不能默认构造的结果", moveOnly.Get().Value == 42)
+
+			Scheduler scheduler(2);
+			AsyncTask<int> scheduled = Detail::AsyncTaskAwaitScheduled(scheduler);
+			UNIT_TEST_CONDITION("等待交给调度器的task", scheduled.Get() == 42)
+		}
+
+		UNIT_TEST_CHECKPOINT("对称转移")
+		{
+			// GCC只在-O2及以上且没有开启Sanitizer时把对称转移编译为尾调用，无法通过宏区分，因此缩短等待链
+			#if defined(__GNUC__) && !defined(__clang__)
+			static constexpr u64 depth = 1000;
+			#else
+			static constexpr u64 depth = 1000000;
+			#endif
+
+			u64 before = GetPooledCoroutineFrameCount();
+			AsyncTask<u64> task = Detail::AsyncTaskChain(depth);
+			UNIT_TEST_CONDITION("深度等待链", task.Get() == depth)
+			UNIT_TEST_CONDITION("子task的帧全部释放", GetPooledCoroutineFrameCount() == before + 1)
+		}
+	}
+	UNIT_TEST_AREA_END(TestAsyncTask)
+}
@@ -0,0 +1,279 @@
+// File /UnitTest/Tests/Test_BinaryCodec.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/String/BinaryCodec.hpp"
+#include "../UnitTestFramework.h"
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestBinaryCodec)
+	{
+		using namespace PenEngine;
+
+		// 按固定块长依次吐出数据的源
+		class ChunkedSource : public IOutputStream
+		{
+		public:
+			ChunkedSource(std::vector<B8> data, Usize chunkSize) : m_data(std::move(data)), m_chunkSize(chunkSize) {}
+
+			std::pair<B8*, Usize> ReadBuffer() override
+			{
+				Usize size = std::min(m_chunkSize, m_data.size() - m_offset);
+				B8* ptr = m_data.data() + m_offset;
+				m_offset += size;
+				return { ptr,size };
+			}
+		private:
+			std::vector<B8> m_data;
+			Usize m_chunkSize;
+			Usize m_offset = 0;
+		};
+
+		class CollectSink : public IInputStream
+		{
+		public:
+			void PrepareBuffer(Usize requiredLen) override { Data.reserve(Data.size() + requiredLen); }
+			void WriteBuffer(B8* data, Usize actualLen) override { Data.insert(Data.end(), data, data + actualLen); }
+
+			std::vector<B8> Data;
+		};
+
+		auto bytesOf = [](StringView str)
+			{
+				return std::vector<B8>(reinterpret_cast<const B8*>(str.Data()), reinterpret_cast<const B8*>(str.Data()) + str.Size());
+			};
+
+		auto makeRandomBytes = [](Usize size, U32 seed)
+			{
+				std::mt19937 engine(seed);
+				std::uniform_int_distribution<int> distribution(0, 255);
+				std::vector<B8> res(size);
+				for (B8& b : res)
+					b = static_cast<B8>(distribution(engine));
+				return res;
+			};
+
+		UNIT_TEST_MESSAGE("测试 Base64")
+
+		UNIT_TEST_CHECKPOINT("RFC 4648 测试向量")
+		{
+			UNIT_TEST_CONDITION("空", Base64Encode(bytesOf("")) == "")
+			UNIT_TEST_CONDITION("f", Base64Encode(bytesOf("f")) == "Zg==")
+			UNIT_TEST_CONDITION("fo", Base64Encode(bytesOf("fo")) == "Zm8=")
+			UNIT_TEST_CONDITION("foo", Base64Encode(bytesOf("foo")) == "Zm9v")
+			UNIT_TEST_CONDITION("foobar", Base64Encode(bytesOf("foobar")) == "Zm9vYmFy")
+			UNIT_TEST_CONDITION("解码", Base64Decode("Zm9vYg==") == "foob" && Base64Decode("Zm9vYmE=") == "fooba" && Base64Decode("") == "")
+			UNIT_TEST_CONDITION("精确长度", Base64EncodedSize(5) == 8 && Base64DecodedSize("Zm9vYmE=") == 5 && Base64DecodedSize("Zm9vYg==") == 4)
+		}
+
+		UNIT_TEST_CHECKPOINT("各长度往返")
+		{
+			// 覆盖向量块与标量尾部的所有组合，并与逐字节的参考实现比对
+			auto reference = [](const std::vector<B8>& data)
+				{
+					constexpr const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+					std::string res;
+					for (Usize i = 0; i < data.size(); i += 3)
+					{
+						U32 v = static_cast<U32>(data[i]) << 16;
+						if (i + 1 < data.size()) v |= static_cast<U32>(data[i + 1]) << 8;
+						if (i + 2 < data.size()) v |= data[i + 2];
+						res += alphabet[v >> 18];
+						res += alphabet[(v >> 12) & 0x3F];
+						res += i + 1 < data.size() ? alphabet[(v >> 6) & 0x3F] : '=';
+						res += i + 2 < data.size() ? alphabet[v & 0x3F] : '=';
+					}
+					return res;
+				};
+
+			bool encodeMatched = true;
+			bool decodeMatched = true;
+			for (Usize size = 0; size <= 200; ++size)
+			{
+				std::vector<B8> data = makeRandomBytes(size, static_cast<U32>(size));
+				String encoded = Base64Encode(data);
+				encodeMatched = encodeMatched && encoded == reference(data);
+
+				std::vector<B8> decoded(Base64DecodedSize(encoded));
+				Usize written = Base64Decode(encoded, decoded.data());
+				decodeMatched = decodeMatched && written == size && decoded == data;
+			}
+			UNIT_TEST_CONDITION("编码与参考实现一致", encodeMatched)
+			UNIT_TEST_CONDITION("解码得到原数据", decodeMatched)
+		}
+
+		UNIT_TEST_CHECKPOINT("追加到已有字符串")
+		{
+			String s = "data:";
+			Base64Encode(reinterpret_cast<const B8*>("foobar"), 6, s);
+			UNIT_TEST_CONDITION("编码追加", s == "data:Zm9vYmFy")
+
+			String bytes = "x";
+			Base64Decode("Zm9v", bytes);
+			UNIT_TEST_CONDITION("解码追加", bytes == "xfoo")
+		}
+
+		UNIT_TEST_CHECKPOINT("非法输入")
+		{
+			auto throws = [](StringView src)
+				{
+					String out = "keep";
+					try
+					{
+						Base64Decode(src, out);
+					}
+					catch (const InvalidArgument&)
+					{
+						return out == "keep";
+					}
+					return false;
+				};
+
+			UNIT_TEST_CONDITION("长度不是4的倍数", throws("Zm9"))
+			UNIT_TEST_CONDITION("中间出现填充", throws("Zg==Zm9v"))
+			UNIT_TEST_CONDITION("非法填充", throws("Z===") && throws("Zm=v"))
+
+			// 在向量块中的每个位置放入非法字符
+			String valid = Base64Encode(makeRandomBytes(96, 1));
+			bool allThrown = true;
+			for (Usize i = 0; i < valid.Size(); ++i)
+			{
+				for (Ch bad : { '-', '_', '\x80', ' ', '\0' })
+				{
+					String broken = valid;
+					broken[i] = bad;
+					allThrown = allThrown && throws(broken);
+				}
+			}
+			UNIT_TEST_CONDITION("任意位置的非法字符", allThrown)
+		}
+
+		UNIT_TEST_MESSAGE("测试 Hex")
+
+		UNIT_TEST_CHECKPOINT("编码与解码")
+		{
+			std::vector<B8> data = { 0x00,0x01,0x7F,0x80,0xAB,0xFF };
+			UNIT_TEST_CONDITION("小写", HexEncode(data) == "00017f80abff")
+			UNIT_TEST_CONDITION("大写", HexEncode(data, HexCase::Upper) == "00017F80ABFF")
+			UNIT_TEST_CONDITION("解码大小写混合", HexDecode("00017F80abFF") == String(reinterpret_cast<const Ch*>(data.data()), data.size()))
+
+			bool allMatched = true;
+			for (Usize size = 0; size <= 100; ++size)
+			{
+				std::vector<B8> bytes = makeRandomBytes(size, static_cast<U32>(size) + 1000);
+				String encoded = HexEncode(bytes, size % 2 == 0 ? HexCase::Lower : HexCase::Upper);
+
+				bool encodedMatched = encoded.Size() == size * 2;
+				for (Usize i = 0; i < size && encodedMatched; ++i)
+				{
+					const char* alphabet = size % 2 == 0 ? "0123456789abcdef" : "0123456789ABCDEF";
+					encodedMatched = encoded[i * 2] == alphabet[bytes[i] >> 4] && encoded[i * 2 + 1] == alphabet[bytes[i] & 0x0F];
+				}
+
+				std::vector<B8> decoded(size);
+				HexDecode(encoded, decoded.data());
+				allMatched = allMatched && encodedMatched && decoded == bytes;
+			}
+			UNIT_TEST_CONDITION("各长度往返", allMatched)
+		}
+
+		UNIT_TEST_CHECKPOINT("非法输入")
+		{
+			String valid = HexEncode(makeRandomBytes(64, 2));
+			bool allThrown = true;
+			for (Usize i = 0; i < valid.Size(); ++i)
+			{
+				for (Ch bad : { 'g', 'G', '/', ':', '@', '`', '\xB0' })
+				{
+					String broken = valid;
+					broken[i] = bad;
+					try
+					{
+						HexDecode(broken);
+						allThrown = false;
+					}
+					catch (const InvalidArgument&) {}
+				}
+			}
+			UNIT_TEST_CONDITION("任意位置的非法字符", allThrown)
+
+			bool oddThrown = false;
+			try
+			{
+				HexDecode("abc");
+			}
+			catch (const InvalidArgument&)
+			{
+				oddThrown = true;
+			}
+			UNIT_TEST_CONDITION("奇数长度", oddThrown)
+		}
+
+		UNIT_TEST_MESSAGE("测试流式接口")
+
+		UNIT_TEST_CHECKPOINT("分块编解码与一次性结果一致")
+		{
+			std::vector<B8> data = makeRandomBytes(1000, 3);
+			String base64 = Base64Encode(data);
+			String hex = HexEncode(data);
+
+			bool allMatched = true;
+			for (Usize chunkSize : { 1, 2, 3, 4, 5, 7, 16, 31, 64, 333, 4096 })
+			{
+				ChunkedSource encodeSource(data, chunkSize);
+				CollectSink encoded;
+				Base64EncodeStream(encodeSource, encoded);
+				allMatched = allMatched && encoded.Data == bytesOf(base64);
+
+				ChunkedSource decodeSource(encoded.Data, chunkSize);
+				CollectSink decoded;
+				Base64DecodeStream(decodeSource, decoded);
+				allMatched = allMatched && decoded.Data == data;
+
+				ChunkedSource hexSource(data, chunkSize);
+				CollectSink hexEncoded;
+				HexEncodeStream(hexSource, hexEncoded);
+				allMatched = allMatched && hexEncoded.Data == bytesOf(hex);
+
+				ChunkedSource hexDecodeSource(hexEncoded.Data, chunkSize);
+				CollectSink hexDecoded;
+				HexDecodeStream(hexDecodeSource, hexDecoded);
+				allMatched = allMatched && hexDecoded.Data == data;
+			}
+			UNIT_TEST_CONDITION("所有块长", allMatched)
+		}
+
+		UNIT_TEST_CHECKPOINT("流式非法输入")
+		{
+			auto decodeThrows = [&](StringView src, Usize chunkSize)
+				{
+					ChunkedSource source(bytesOf(src), chunkSize);
+					CollectSink sink;
+					try
+					{
+						Base64DecodeStream(source, sink);
+					}
+					catch (const InvalidArgument&)
+					{
+						return true;
+					}
+					return false;
+				};
+
+			UNIT_TEST_CONDITION("中间出现填充", decodeThrows("Zg==Zm9v", 3) && decodeThrows("Zg==Zm9v", 4) && decodeThrows("Zg==Zm9v", 100))
+			UNIT_TEST_CONDITION("长度不完整", decodeThrows("Zm9vY", 2))
+			UNIT_TEST_CONDITION("合法输入不抛出", !decodeThrows("Zm9vYg==", 3))
+		}
+	}
+	UNIT_TEST_AREA_END(TestBinaryCodec)
+}
@@ -0,0 +1,139 @@
+// File /UnitTest/Tests/Test_CodePointView.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/String/CodePointView.hpp"
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestCodePointView)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 CodePointView")
+
+		auto collect = []<typename View>(View view)
+			{
+				std::u32string res;
+				for (Ch32 cp : view)
+					res.push_back(cp);
+				return res;
+			};
+
+		UNIT_TEST_CHECKPOINT("解码")
+		{
+			// 1~4字节的UTF-8序列混合ASCII
+			StringView text = "a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80z";
+			UNIT_TEST_CONDITION("UTF-8", collect(CodePointView(text)) == U"aé中\U0001F600z")
+			UNIT_TEST_CONDITION("UTF-16", collect(U16CodePointView(std::u16string_view(u"aé中\U0001F600z"))) == U"aé中\U0001F600z")
+			UNIT_TEST_CONDITION("UTF-32", collect(U32CodePointView(U32View(U"中\U0001F600"))) == U"中\U0001F600")
+			UNIT_TEST_CONDITION("满足forward_range", std::ranges::forward_range<CodePointView> && std::ranges::forward_range<U16GraphemeView>)
+
+			CodePointView::Iterator it = CodePointView(text).Begin();
+			++it;
+			UNIT_TEST_CONDITION("码点位置", it.Data() == text.Data() + 1 && it.Length() == 2)
+		}
+
+		UNIT_TEST_CHECKPOINT("非法序列")
+		{
+			// 孤立的延续字节、过长编码、代理项、被截断的序列
+			UNIT_TEST_CONDITION("孤立延续字节", collect(CodePointView(StringView("\x80" "a"))) == U"\uFFFDa")
+			UNIT_TEST_CONDITION("过长编码", collect(CodePointView(StringView("\xC0\xAF"))) == U"\uFFFD\uFFFD")
+			UNIT_TEST_CONDITION("代理项", collect(CodePointView(StringView("\xED\xA0\x80"))) == U"\uFFFD\uFFFD\uFFFD")
+			UNIT_TEST_CONDITION("截断的序列", collect(CodePointView(StringView("\xE4\xB8" "a"))) == U"\uFFFDa" && collect(CodePointView(StringView("\xF0\x9F\x98"))) == U"\uFFFD")
+			UNIT_TEST_CONDITION("孤立的UTF-16代理项", collect(U16CodePointView(std::u16string_view(u"\xD800" u"a" u"\xDC00", 3))) == U"\uFFFDa\uFFFD")
+		}
+
+		UNIT_TEST_CHECKPOINT("计数、偏移与截断")
+		{
+			// 构造跨越多个向量块的混合文本，并用逐个解码的结果作为参考
+			std::mt19937 engine(23);
+			std::uniform_int_distribution<int> kindDistribution(0, 5);
+			std::uniform_int_distribution<Usize> lengthDistribution(0, 300);
+			const char* pieces[] = { "a", "b", "\xC3\xA9", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80", "0123456789abcdef" };
+
+			bool allMatched = true;
+			for (Usize n = 0; n < 200; ++n)
+			{
+				String text;
+				std::u16string wide;
+				Usize length = lengthDistribution(engine);
+				for (Usize i = 0; i < length; ++i)
+					text.Append(pieces[kindDistribution(engine)]);
+
+				std::vector<Usize> offsets;
+				for (CodePointView::Iterator it = CodePointView(text).Begin(); it != CodePointView(text).End(); ++it)
+				{
+					offsets.push_back(static_cast<Usize>(it.Data() - text.Data()));
+					Ch32 cp = *it;
+					if (cp >= 0x10000)
+					{
+						wide.push_back(static_cast<Ch16>(0xD800 + ((cp - 0x10000) >> 10)));
+						wide.push_back(static_cast<Ch16>(0xDC00 + ((cp - 0x10000) & 0x3FF)));
+					}
+					else
+						wide.push_back(static_cast<Ch16>(cp));
+				}
+
+				CodePointView view(text);
+				U16CodePointView wideView(wide);
+				allMatched = allMatched && view.Count() == offsets.size() && wideView.Count() == offsets.size();
+				allMatched = allMatched && collect(view) == collect(wideView);
+				for (Usize i = 0; i < offsets.size(); i += 7)
+					allMatched = allMatched && view.Offset(i) == offsets[i] && view.Truncate(i).Text().Size() == offsets[i];
+				allMatched = allMatched && view.Offset(offsets.size()) == text.Size() && view.Offset(offsets.size() + 1) == NPos;
+				allMatched = allMatched && view.Truncate(offsets.size() + 5).Text().Size() == text.Size();
+
+				// 按编码单元截断后一定结束于码点边界
+				for (Usize maxLength = 0; maxLength <= text.Size(); maxLength += 5)
+				{
+					Usize truncated = view.TruncateUnits(maxLength).Text().Size();
+					allMatched = allMatched && truncated <= maxLength && (truncated == text.Size() || std::ranges::binary_search(offsets, truncated)) && maxLength - truncated < 4;
+				}
+			}
+			UNIT_TEST_CONDITION("与逐个解码的结果一致", allMatched)
+		}
+
+		UNIT_TEST_MESSAGE("测试 GraphemeView")
+
+		auto clusters = []<typename View>(View view)
+			{
+				std::vector<typename View::SourceView> res;
+				for (auto cluster : view)
+					res.push_back(cluster);
+				return res;
+			};
+
+		UNIT_TEST_CHECKPOINT("字素簇")
+		{
+			UNIT_TEST_CONDITION("ASCII与CRLF", clusters(GraphemeView(StringView("ab\r\nc"))).size() == 4 && clusters(GraphemeView(StringView("ab\r\nc")))[2] == "\r\n")
+			UNIT_TEST_CONDITION("组合附加符号", clusters(GraphemeView(StringView("e\xCC\x81x"))).size() == 2 && clusters(GraphemeView(StringView("e\xCC\x81x")))[0] == "e\xCC\x81")
+
+			// 👨‍👩‍👧 由ZWJ连接，🇨🇳🇯🇵 是两个国旗，👍🏽 带肤色修饰
+			std::u16string_view family = u"\U0001F468\u200D\U0001F469\u200D\U0001F467";
+			UNIT_TEST_CONDITION("ZWJ序列", U16GraphemeView(family).Count() == 1)
+			UNIT_TEST_CONDITION("区域指示符成对", U32GraphemeView(U32View(U"\U0001F1E8\U0001F1F3\U0001F1EF\U0001F1F5\U0001F1FA")).Count() == 3)
+			UNIT_TEST_CONDITION("肤色修饰", GraphemeView(StringView("\xF0\x9F\x91\x8D\xF0\x9F\x8F\xBD!")).Count() == 2)
+			UNIT_TEST_CONDITION("谚文音节", U32GraphemeView(U32View(U"각가")).Count() == 2)
+			UNIT_TEST_CONDITION("ZWJ之前不是表情时断开", U32GraphemeView(U32View(U"a\u200D\U0001F468")).Count() == 2)
+			UNIT_TEST_CONDITION("控制字符之后断开", U32GraphemeView(U32View(U"\n\u0301")).Count() == 2)
+			UNIT_TEST_CONDITION("空文本", GraphemeView(StringView("")).Count() == 0 && clusters(GraphemeView()).empty())
+
+			String text = "Hello, 世界\xF0\x9F\x91\x8B\xF0\x9F\x8F\xBB!";
+			std::vector<StringView> parts = clusters(GraphemeView(text));
+			UNIT_TEST_CONDITION("混合文本", parts.size() == 11 && parts[9] == "\xF0\x9F\x91\x8B\xF0\x9F\x8F\xBB" && parts[10] == "!")
+		}
+	}
+	UNIT_TEST_AREA_END(TestCodePointView)
+}
@@ -0,0 +1,145 @@
+// File /UnitTest/Tests/Test_Escape.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/String/Escape.hpp"
+#include "../UnitTestFramework.h"
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestEscape)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 CharSet")
+
+		UNIT_TEST_CHECKPOINT("查找与计数")
+		{
+			constexpr CharSet set = CharSet("\"\\") | CharSet::Range(0x00, 0x1F);
+			UNIT_TEST_CONDITION("Contain", set.Contain('"') && set.Contain('\n') && !set.Contain('a') && !set.Contain(U'\x10022'))
+
+			// 在每个位置放入目标字符，覆盖向量块与尾部
+			bool allMatched = true;
+			for (Usize length : { 1, 15, 16, 17, 31, 32, 33, 70 })
+			{
+				for (Usize i = 0; i < length; ++i)
+				{
+					String s('a', length);
+					s[i] = '\\';
+					allMatched = allMatched && set.FindFirstIn(s.Data(), s.Size()) == i && set.CountIn(s.Data(), s.Size()) == 1;
+				}
+				String clean('z', length);
+				allMatched = allMatched && set.FindFirstIn(clean.Data(), clean.Size()) == length;
+			}
+			UNIT_TEST_CONDITION("各位置的查找结果", allMatched)
+
+			// 与逐字符判断比较，覆盖所有256个字节值
+			CharSet highSet = CharSet::Range(0x80, 0x9F) | CharSet("\xFF" "A0");
+			bool classifyMatched = true;
+			String all;
+			for (U32 ch = 0; ch < 256; ++ch)
+				all.Append(static_cast<Ch>(ch));
+			Usize expectedCount = 0;
+			for (U32 ch = 0; ch < 256; ++ch)
+				expectedCount += highSet.Contain(static_cast<Ch>(ch));
+			classifyMatched = highSet.CountIn(all.Data(), all.Size()) == expectedCount && expectedCount == 35;
+			classifyMatched = classifyMatched && highSet.FindFirstIn(all.Data(), all.Size()) == '0' && highSet.FindFirstIn(all.Data() + 0x42, all.Size() - 0x42) == 0x80 - 0x42;
+			UNIT_TEST_CONDITION("所有字节值", classifyMatched)
+		}
+
+		UNIT_TEST_MESSAGE("测试 Escape / Unescape")
+
+		UNIT_TEST_CHECKPOINT("Json")
+		{
+			String escaped = Escape("say \"hi\"\n\tpath\\to\x01\x1f", EscapeStyle::Json);
+			UNIT_TEST_CONDITION("转义结果", escaped == "say \\\"hi\\\"\\n\\tpath\\\\to\\u0001\\u001f")
+			UNIT_TEST_CONDITION("精确长度", EscapedSize("say \"hi\"\n\tpath\\to\x01\x1f", EscapeStyle::Json) == escaped.Size())
+			UNIT_TEST_CONDITION("往返", Unescape(escaped, EscapeStyle::Json) == "say \"hi\"\n\tpath\\to\x01\x1f")
+			UNIT_TEST_CONDITION("非ASCII字符原样保留", Escape("中文", EscapeStyle::Json) == "中文")
+			UNIT_TEST_CONDITION("Unicode 转义", Unescape("\\u4e2d\\u6587\\/\\b\\f", EscapeStyle::Json) == "中文/\b\f")
+			UNIT_TEST_CONDITION("代理对", Unescape("\\ud83d\\ude00", EscapeStyle::Json) == "\xF0\x9F\x98\x80" && Unescape(U"\\ud83d\\ude00", EscapeStyle::Json) == U"\U0001F600")
+		}
+
+		UNIT_TEST_CHECKPOINT("Log")
+		{
+			String escaped = Escape("line1\r\nline2\\\x7f\x1b[0m \"quoted\"", EscapeStyle::Log);
+			UNIT_TEST_CONDITION("转义结果", escaped == "line1\\r\\nline2\\\\\\x7f\\x1b[0m \"quoted\"")
+			UNIT_TEST_CONDITION("往返", Unescape(escaped, EscapeStyle::Log) == "line1\r\nline2\\\x7f\x1b[0m \"quoted\"")
+		}
+
+		UNIT_TEST_CHECKPOINT("Shell")
+		{
+			UNIT_TEST_CONDITION("空串", Escape("", EscapeStyle::Shell) == "''")
+			UNIT_TEST_CONDITION("单引号", Escape("it's $HOME", EscapeStyle::Shell) == "'it'\\''s $HOME'")
+			UNIT_TEST_CONDITION("往返", Unescape("'it'\\''s $HOME'", EscapeStyle::Shell) == "it's $HOME")
+			UNIT_TEST_CONDITION("混合写法", Unescape("a\\ b'c d'e", EscapeStyle::Shell) == "a bc de")
+		}
+
+		UNIT_TEST_CHECKPOINT("追加与随机往返")
+		{
+			String out = "{\"msg\":\"";
+			Escape("a\"b", out, EscapeStyle::Json);
+			out.Append("\"}");
+			UNIT_TEST_CONDITION("追加到已有内容", out == "{\"msg\":\"a\\\"b\"}")
+
+			std::mt19937 engine(11);
+			std::uniform_int_distribution<int> charDistribution(0, 127);
+			std::uniform_int_distribution<Usize> lengthDistribution(0, 100);
+
+			bool allMatched = true;
+			for (Usize n = 0; n < 300; ++n)
+			{
+				String src;
+				Usize length = lengthDistribution(engine);
+				for (Usize i = 0; i < length; ++i)
+					src.Append(static_cast<Ch>(charDistribution(engine)));
+
+				for (EscapeStyle style : { EscapeStyle::Json, EscapeStyle::Log, EscapeStyle::Shell })
+				{
+					String escaped = Escape(src, style);
+					allMatched = allMatched && escaped.Size() == EscapedSize(src, style) && Unescape(escaped, style) == src;
+				}
+
+				U32String wide;
+				for (Usize i = 0; i < src.Size(); ++i)
+					wide.Append(static_cast<Ch32>(src[i]));
+				wide.Append(U'\x4E2D');
+				allMatched = allMatched && Unescape(Escape(wide, EscapeStyle::Json), EscapeStyle::Json) == wide;
+			}
+			UNIT_TEST_CONDITION("所有风格往返一致", allMatched)
+		}
+
+		UNIT_TEST_CHECKPOINT("非法转义序列")
+		{
+			auto throws = [](StringView src, EscapeStyle style)
+				{
+					String out = "keep";
+					try
+					{
+						Unescape<Ch>(src, out, style);
+					}
+					catch (const InvalidArgument&)
+					{
+						return out == "keep";
+					}
+					return false;
+				};
+
+			UNIT_TEST_CONDITION("结尾的反斜杠", throws("abc\\", EscapeStyle::Json) && throws("abc\\", EscapeStyle::Shell))
+			UNIT_TEST_CONDITION("未知转义", throws("\\q", EscapeStyle::Json) && throws("\\\"", EscapeStyle::Log))
+			UNIT_TEST_CONDITION("不完整的十六进制", throws("\\u12", EscapeStyle::Json) && throws("\\x1", EscapeStyle::Log) && throws("\\u12g4", EscapeStyle::Json))
+			UNIT_TEST_CONDITION("不成对的代理项", throws("\\ud83d", EscapeStyle::Json) && throws("\\ude00", EscapeStyle::Json) && throws("\\ud83d\\u0041", EscapeStyle::Json))
+			UNIT_TEST_CONDITION("未闭合的引号", throws("'abc", EscapeStyle::Shell))
+		}
+	}
+	UNIT_TEST_AREA_END(TestEscape)
+}
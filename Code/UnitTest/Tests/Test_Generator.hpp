@@ -0,0 +1,224 @@
+// File /UnitTest/Tests/Test_Generator.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Coroutine/Generator.hpp"
+#include "../../Engine/Utils/Ranges.hpp"
+#include "../UnitTestFramework.h"
+#include <memory_resource>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		struct GeneratorCopyCounter
+		{
+			static inline int Copies = 0;
+			static inline int Moves = 0;
+
+			int Value = 0;
+
+			explicit GeneratorCopyCounter(int value) noexcept : Value(value) {}
+			GeneratorCopyCounter(const GeneratorCopyCounter& other) noexcept : Value(other.Value) { ++Copies; }
+			GeneratorCopyCounter(GeneratorCopyCounter&& other) noexcept : Value(other.Value) { ++Moves; }
+		};
+
+		struct GeneratorGuard
+		{
+			int& Destroyed;
+			~GeneratorGuard() { ++Destroyed; }
+		};
+
+		inline PenEngine::Generator<int> GeneratorIota(int count, int& produced)
+		{
+			for (int i = 0; i < count; ++i)
+			{
+				++produced;
+				co_yield i;
+			}
+		}
+
+		inline PenEngine::Generator<PenEngine::u64> GeneratorFibonacci()
+		{
+			PenEngine::u64 a = 0;
+			PenEngine::u64 b = 1;
+			while (true)
+			{
+				co_yield a;
+				b = std::exchange(a, b) + b;
+			}
+		}
+
+		inline PenEngine::Generator<int&> GeneratorElements(std::vector<int>& values)
+		{
+			for (int& v : values)
+				co_yield v;
+		}
+
+		inline PenEngine::Generator<GeneratorCopyCounter> GeneratorTemporaries(int count)
+		{
+			for (int i = 0; i < count; ++i)
+				co_yield GeneratorCopyCounter(i);
+		}
+
+		inline PenEngine::Generator<GeneratorCopyCounter> GeneratorLvalues(int count)
+		{
+			GeneratorCopyCounter counter(0);
+			for (int i = 0; i < count; ++i)
+			{
+				counter.Value = i;
+				co_yield counter;
+			}
+		}
+
+		inline PenEngine::Generator<const GeneratorCopyCounter&> GeneratorConstReferences(int count)
+		{
+			GeneratorCopyCounter counter(0);
+			for (int i = 0; i < count; ++i)
+			{
+				counter.Value = i;
+				co_yield counter;
+			}
+		}
+
+		inline PenEngine::Generator<int> GeneratorGuarded(int& destroyed)
+		{
+			GeneratorGuard guard{ destroyed };
+			for (int i = 0;; ++i)
+				co_yield i;
+		}
+
+		inline PenEngine::Generator<int> GeneratorThrow(int count)
+		{
+			for (int i = 0; i < count; ++i)
+				co_yield i;
+			throw std::runtime_error("generator");
+		}
+
+		inline PenEngine::Generator<int> GeneratorWithResource(std::allocator_arg_t, std::pmr::memory_resource*, int count)
+		{
+			for (int i = 0; i < count; ++i)
+				co_yield i;
+		}
+	}
+
+	UNIT_TEST_AREA_BEGIN(TestGenerator)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 Generator")
+
+		UNIT_TEST_CHECKPOINT("范围")
+		{
+			static_assert(std::ranges::input_range<Generator<int>> && std::ranges::view<Generator<int>>);
+			static_assert(std::same_as<std::ranges::range_reference_t<Generator<int>>, int&&>);
+			static_assert(std::same_as<std::ranges::range_reference_t<Generator<int&>>, int&>);
+			static_assert(std::same_as<std::ranges::range_value_t<Generator<const int&>>, int>);
+			static_assert(IsSupportRange<Generator<int>&> && std::same_as<RangeReferenceType<Generator<int>>, int&&>);
+
+			int produced = 0;
+			Generator<int> iota = Detail::GeneratorIota(5, produced);
+			UNIT_TEST_CONDITION("创建时不执行", produced == 0)
+
+			int sum = 0;
+			for (auto it = PenEngine::Begin(iota); it != PenEngine::End(iota); ++it)
+				sum += *it;
+			UNIT_TEST_CONDITION("通过Begin/End遍历", sum == 10 && produced == 5)
+
+			std::vector<u64> fibonacci;
+			for (u64 v : Detail::GeneratorFibonacci() | std::views::filter([](u64 v) { return v % 2 == 0; }) | std::views::take(5))
+				fibonacci.push_back(v);
+			UNIT_TEST_CONDITION("无限生成器与标准库视图组合", fibonacci == std::vector<u64>({ 0, 2, 8, 34, 144 }))
+
+			Generator<int> empty = Detail::GeneratorIota(0, produced);
+			UNIT_TEST_CONDITION("空生成器", empty.begin() == empty.end())
+		}
+
+		UNIT_TEST_CHECKPOINT("引用与复制")
+		{
+			std::vector<int> values = { 1, 2, 3 };
+			for (int& v : Detail::GeneratorElements(values))
+				v *= 10;
+			UNIT_TEST_CONDITION("Generator<T&>产出原对象的引用", values == std::vector<int>({ 10, 20, 30 }))
+
+			Detail::GeneratorCopyCounter::Copies = 0;
+			Detail::GeneratorCopyCounter::Moves = 0;
+			int sum = 0;
+			for (auto&& v : Detail::GeneratorTemporaries(100))
+				sum += v.Value;
+			UNIT_TEST_CONDITION("产出临时对象不复制也不移动", sum == 4950 && Detail::GeneratorCopyCounter::Copies == 0 && Detail::GeneratorCopyCounter::Moves == 0)
+
+			sum = 0;
+			for (auto&& v : Detail::GeneratorConstReferences(100))
+				sum += v.Value;
+			UNIT_TEST_CONDITION("Generator<const T&>产出左值不复制", sum == 4950 && Detail::GeneratorCopyCounter::Copies == 0)
+
+			sum = 0;
+			for (auto&& v : Detail::GeneratorLvalues(100))
+				sum += v.Value;
+			UNIT_TEST_CONDITION("Generator<T>产出左值复制一次", sum == 4950 && Detail::GeneratorCopyCounter::Copies == 100 && Detail::GeneratorCopyCounter::Moves == 0)
+
+			std::vector<Detail::GeneratorCopyCounter> moved;
+			for (Detail::GeneratorCopyCounter v : Detail::GeneratorTemporaries(3))
+				moved.push_back(std::move(v));
+			UNIT_TEST_CONDITION("可以移动出产出的值", moved.size() == 3 && moved[2].Value == 2 && Detail::GeneratorCopyCounter::Copies == 100)
+		}
+
+		UNIT_TEST_CHECKPOINT("生命周期与异常")
+		{
+			int destroyed = 0;
+			u64 frames = GetPooledCoroutineFrameCount();
+			{
+				Generator<int> guarded = Detail::GeneratorGuarded(destroyed);
+				UNIT_TEST_CONDITION("协程帧从池中分配", GetPooledCoroutineFrameCount() == frames + 1)
+				for (int v : guarded)
+					if (v == 10)
+						break;
+			}
+			UNIT_TEST_CONDITION("提前结束遍历时销毁局部变量与协程帧", destroyed == 1 && GetPooledCoroutineFrameCount() == frames)
+
+			int seen = 0;
+			bool thrown = false;
+			try
+			{
+				for (int v : Detail::GeneratorThrow(3))
+					seen += v + 1;
+			}
+			catch (const std::runtime_error&)
+			{
+				thrown = true;
+			}
+			UNIT_TEST_CONDITION("异常在递增迭代器时抛出", thrown && seen == 6)
+
+			thrown = false;
+			try
+			{
+				Generator<int> failed = Detail::GeneratorThrow(0);
+				failed.begin();
+			}
+			catch (const std::runtime_error&)
+			{
+				thrown = true;
+			}
+			UNIT_TEST_CONDITION("异常在Begin时抛出", thrown)
+
+			std::pmr::monotonic_buffer_resource resource;
+			int sum = 0;
+			for (int v : Detail::GeneratorWithResource(std::allocator_arg, &resource, 4))
+				sum += v;
+			UNIT_TEST_CONDITION("使用指定的内存资源", sum == 6 && GetPooledCoroutineFrameCount() == frames)
+		}
+	}
+	UNIT_TEST_AREA_END(TestGenerator)
+}
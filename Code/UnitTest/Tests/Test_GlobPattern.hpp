@@ -0,0 +1,124 @@
+// File /UnitTest/Tests/Test_GlobPattern.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/IO/GlobPattern.h"
+#include "../UnitTestFramework.h"
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestGlobPattern)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 GlobPattern")
+
+		UNIT_TEST_CHECKPOINT("基础通配符")
+		{
+			GlobPattern star("*.png");
+			UNIT_TEST_CONDITION("*", star.Match("a.png") && star.Match(".png") && !star.Match("a.png.bak") && !star.Match("dir/a.png"))
+
+			GlobPattern question("Textures/??_*.dds");
+			UNIT_TEST_CONDITION("?", question.Match("Textures/ab_normal.dds") && !question.Match("Textures/a_normal.dds") && !question.Match("Textures/a/_x.dds"))
+
+			GlobPattern bracket("[a-c!]x[!0-9]");
+			UNIT_TEST_CONDITION("字符集合", bracket.Match("bxz") && bracket.Match("!xa") && !bracket.Match("dxz") && !bracket.Match("ax5") && !bracket.Match("ax/"))
+
+			GlobPattern escaped("\\*\\?[]]");
+			UNIT_TEST_CONDITION("转义与字面']'", escaped.Match("*?]") && !escaped.Match("a?]"))
+
+			GlobPattern literal("abc");
+			UNIT_TEST_CONDITION("完全匹配", literal.Match("abc") && !literal.Match("abcd") && !literal.Match("ab") && GlobPattern("").Match("") && !GlobPattern("").Match("a"))
+		}
+
+		UNIT_TEST_CHECKPOINT("路径分隔符")
+		{
+			GlobPattern any("**/*.png");
+			UNIT_TEST_CONDITION("零层目录", any.Match("a.png"))
+			UNIT_TEST_CONDITION("多层目录", any.Match("a/b/c.png") && any.Match("a\\b\\c.png") && !any.Match("a/b/c.jpg"))
+
+			GlobPattern middle("Assets/**/Textures/*.dds");
+			UNIT_TEST_CONDITION("中间的**", middle.Match("Assets/Textures/a.dds") && middle.Match("Assets/x/y/Textures/a.dds") && !middle.Match("Assets/xTextures/a.dds"))
+
+			GlobPattern trailing("Assets/**");
+			UNIT_TEST_CONDITION("结尾的**", trailing.Match("Assets/a") && trailing.Match("Assets/a/b/c") && !trailing.Match("Assets") && !trailing.Match("Other/a"))
+
+			GlobPattern notSegment("a**b");
+			UNIT_TEST_CONDITION("非完整路径段的**等同于*", notSegment.Match("axxb") && !notSegment.Match("a/b"))
+
+			GlobPattern plain("*.png", GlobOption::None);
+			UNIT_TEST_CONDITION("非路径模式下*匹配分隔符", plain.Match("dir/a.png"))
+
+			UNIT_TEST_CONDITION("匹配Path", any.Match(Path("Textures/Stone/albedo.png")) && !any.Match(Path("Textures/readme.txt")))
+		}
+
+		UNIT_TEST_CHECKPOINT("忽略大小写")
+		{
+			GlobPattern pattern("*.PNG", GlobOption::PathSeparator | GlobOption::CaseInsensitive);
+			UNIT_TEST_CONDITION("大小写", pattern.Match("a.png") && pattern.Match("B.Png") && !GlobPattern("*.PNG").Match("a.png"))
+		}
+
+		UNIT_TEST_CHECKPOINT("多模式")
+		{
+			GlobPattern set = { "**/*.png", "Textures/*", "*.dds", "Textures/??.png" };
+			UNIT_TEST_CONDITION("模式数量与DFA", set.PatternCount() == 4 && set.IsDeterministic())
+			UNIT_TEST_CONDITION("第一个匹配的模式", set.MatchIndex("Textures/ab.png") == 0 && set.MatchIndex("Textures/a.dds") == 1 && set.MatchIndex("a.dds") == 2 && set.MatchIndex("a.txt") == NPos)
+			UNIT_TEST_CONDITION("全部匹配的模式", set.MatchAll("Textures/ab.png") == std::vector<Usize>({ 0,1,3 }) && set.MatchAll("x/y.txt").empty())
+
+			// 大量相互交错的模式使DFA状态数超过上限，退回NFA模拟后结果应保持一致
+			std::vector<String> storage;
+			for (Usize i = 0; i < 40; ++i)
+			{
+				String pattern = "*a";
+				for (Usize j = 0; j < i % 13; ++j)
+					pattern.Append('?');
+				pattern.Append("b*");
+				storage.push_back(pattern);
+			}
+			std::vector<StringView> patterns(storage.begin(), storage.end());
+			GlobPattern many(patterns, GlobOption::None);
+
+			bool allMatched = true;
+			const char* texts[] = { "ab", "axxb", "xaxxxxxxxxxxxxbx", "aaaaaaaaaaaaaaaaab", "bbbb" };
+			for (const char* text : texts)
+			{
+				std::vector<Usize> expected;
+				for (Usize i = 0; i < storage.size(); ++i)
+				{
+					if (GlobPattern(storage[i], GlobOption::None).Match(text))
+						expected.push_back(i);
+				}
+				allMatched = allMatched && many.MatchAll(text) == expected && many.MatchIndex(text) == (expected.empty() ? NPos : expected.front());
+			}
+			UNIT_TEST_CONDITION("NFA模拟与逐个匹配一致", allMatched && !many.IsDeterministic())
+		}
+
+		UNIT_TEST_CHECKPOINT("非法模式")
+		{
+			auto throws = [](StringView pattern)
+				{
+					try
+					{
+						GlobPattern p(pattern);
+					}
+					catch (const InvalidArgument&)
+					{
+						return true;
+					}
+					return false;
+				};
+			UNIT_TEST_CONDITION("未闭合的字符集合", throws("[abc"))
+			UNIT_TEST_CONDITION("结尾的转义符", throws("abc\\"))
+			UNIT_TEST_CONDITION("非法范围", throws("[z-a]"))
+		}
+	}
+	UNIT_TEST_AREA_END(TestGlobPattern)
+}
@@ -0,0 +1,99 @@
+// File /UnitTest/Tests/Test_HeapProfiler.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Memory/HeapProfiler.h"
+#include "../../Engine/String/Format.hpp"
+#include "../UnitTestFramework.h"
+#include <sstream>
+
+namespace PenFramework::UnitTest
+{
+	namespace
+	{
+		// 不内联，保证调用栈中出现这个函数
+		NOINLINE void HeapProfilerTestAllocate(std::vector<PenEngine::U8>& arena, PenEngine::Usize count, PenEngine::Usize bytes, PenEngine::Memory::MemoryTag tag)
+		{
+			for (PenEngine::Usize i = 0; i < count; ++i)
+				PenEngine::Memory::HeapProfilerRecordAllocate(arena.data() + i * bytes, bytes, tag);
+		}
+	}
+
+	UNIT_TEST_AREA_BEGIN(TestHeapProfiler)
+	{
+		using namespace PenEngine;
+		using namespace PenEngine::Memory;
+
+		UNIT_TEST_MESSAGE("测试 HeapProfiler")
+
+		// 用一段连续内存中的地址模拟互不相同的分配
+		std::vector<U8> arena(1 << 20);
+		U8 warmUp = 0;
+
+		UNIT_TEST_CHECKPOINT("逐个采样")
+		{
+			HeapProfilerOptions options;
+			options.SampleIntervalBytes = 1;
+			StartHeapProfiler(options);
+			HeapProfilerRecordAllocate(&warmUp, 1);
+			HeapProfilerRecordDeallocate(&warmUp);
+			UNIT_TEST_CONDITION("开始运行", IsHeapProfilerRunning())
+
+			HeapProfilerTestAllocate(arena, 100, 64, MemoryTag::Object);
+			HeapProfileSummary summary = GetHeapProfileSummary();
+			UNIT_TEST_CONDITION("每个分配都被采样", summary.LiveSampleCount == 100 && summary.EstimatedLiveBytes == 6400 && summary.StackCount >= 1)
+
+			for (Usize i = 0; i < 50; ++i)
+				HeapProfilerRecordDeallocate(arena.data() + i * 64);
+			HeapProfilerRecordDeallocate(arena.data() + 1);
+			summary = GetHeapProfileSummary();
+			UNIT_TEST_CONDITION("释放后移除记录", summary.LiveSampleCount == 50 && summary.EstimatedLiveBytes == 3200)
+
+			std::ostringstream folded;
+			DumpHeapProfile(folded, HeapProfileFormat::Folded);
+			std::string foldedText = folded.str();
+			UNIT_TEST_CONDITION("折叠格式", foldedText.starts_with("Object;") && foldedText.find(" 3200\n") != std::string::npos)
+
+			std::ostringstream pprof;
+			DumpHeapProfile(pprof, HeapProfileFormat::Pprof);
+			UNIT_TEST_CONDITION("pprof格式", pprof.str().starts_with("heap profile: 50: 3200 [100: 6400] @ heap_v2/1\n"))
+
+			StopHeapProfiler();
+			summary = GetHeapProfileSummary();
+			UNIT_TEST_CONDITION("停止后丢弃记录", !IsHeapProfilerRunning() && summary.LiveSampleCount == 0 && summary.StackCount == 0)
+		}
+
+		UNIT_TEST_CHECKPOINT("按采样率估计")
+		{
+			HeapProfilerOptions options;
+			options.SampleIntervalBytes = 4096;
+			StartHeapProfiler(options);
+
+			constexpr Usize count = 16384;
+			constexpr Usize bytes = 64;
+			HeapProfilerTestAllocate(arena, count, bytes, MemoryTag::Container);
+			HeapProfileSummary summary = GetHeapProfileSummary();
+
+			// 期望采样约256次，估计值的相对误差大约为1/16
+			double ratio = static_cast<double>(summary.EstimatedLiveBytes) / static_cast<double>(count * bytes);
+			UNIT_TEST_CONDITION("只采样一部分", summary.LiveSampleCount > 0 && summary.LiveSampleCount < count / 8)
+			UNIT_TEST_CONDITION("估计的存活字节数", ratio > 0.6 && ratio < 1.4)
+			UNIT_TEST_MESSAGE(Format("采样次数：{} 估计字节数：{} 实际字节数：{}", summary.LiveSampleCount, summary.EstimatedLiveBytes, count * bytes))
+
+			for (Usize i = 0; i < count; ++i)
+				HeapProfilerRecordDeallocate(arena.data() + i * bytes);
+			UNIT_TEST_CONDITION("全部释放", GetHeapProfileSummary().LiveSampleCount == 0)
+
+			StopHeapProfiler();
+		}
+	}
+	UNIT_TEST_AREA_END(TestHeapProfiler)
+}
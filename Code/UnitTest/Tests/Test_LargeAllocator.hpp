@@ -0,0 +1,109 @@
+// File /UnitTest/Tests/Test_LargeAllocator.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Memory/Memory.hpp"
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <algorithm>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestLargeAllocator)
+	{
+		using namespace PenEngine;
+		using namespace PenEngine::Memory;
+
+		UNIT_TEST_MESSAGE("测试 LargeAllocator")
+
+		UNIT_TEST_CHECKPOINT("映射大小")
+		{
+			UNIT_TEST_CONDITION("按普通页取整", LargeAllocationMappingBytes(1) == LargeAllocationPageBytes && LargeAllocationMappingBytes(LargeAllocationPageBytes + 1) == 2 * LargeAllocationPageBytes)
+			UNIT_TEST_CONDITION("按大页取整", LargeAllocationMappingBytes(LargeAllocationHugePageBytes + 1) == 2 * LargeAllocationHugePageBytes)
+		}
+
+		auto verifyPattern = [](const U8* data, Usize bytes, U8 seed)
+			{
+				for (Usize i = 0; i < bytes; i += 4093)
+				{
+					if (data[i] != static_cast<U8>(seed + i / 4093))
+						return false;
+				}
+				return true;
+			};
+
+		auto fillPattern = [](U8* data, Usize bytes, U8 seed)
+			{
+				for (Usize i = 0; i < bytes; i += 4093)
+					data[i] = static_cast<U8>(seed + i / 4093);
+			};
+
+		UNIT_TEST_CHECKPOINT("分配与调整大小")
+		{
+			const LargeAllocationOptionFlag optionSets[] = {
+				LargeAllocationOption::None,
+				LargeAllocationOption::TransparentHugePage,
+				LargeAllocationOption::TransparentHugePage | LargeAllocationOption::Prefault,
+				LargeAllocationOption::ExplicitHugePage | LargeAllocationOption::Prefault,
+			};
+
+			bool allValid = true;
+			for (LargeAllocationOptionFlag options : optionSets)
+			{
+				constexpr Usize bytes = 5 * 1024 * 1024 + 123;
+				U8* data = static_cast<U8*>(LargeAllocate(bytes, options));
+				allValid = allValid && reinterpret_cast<Usize>(data) % LargeAllocationPageBytes == 0;
+				allValid = allValid && std::all_of(data, data + bytes, [](U8 v) { return v == 0; });
+				fillPattern(data, bytes, 7);
+
+				// 增长、缩小，内容都要保留
+				U8* grown = static_cast<U8*>(LargeReallocate(data, bytes, 3 * bytes));
+				allValid = allValid && verifyPattern(grown, bytes, 7);
+				grown[3 * bytes - 1] = 1;
+
+				U8* shrunk = static_cast<U8*>(LargeReallocate(grown, 3 * bytes, bytes / 2));
+				allValid = allValid && verifyPattern(shrunk, bytes / 2, 7);
+				LargeDeallocate(shrunk, bytes / 2);
+			}
+			UNIT_TEST_CONDITION("各种选项下的内容", allValid)
+		}
+
+		UNIT_TEST_CHECKPOINT("经由Memory与String")
+		{
+			Usize count = LargeAllocationThresholdBytes / sizeof(u64) * 2;
+			u64* numbers = Allocate<u64>(count);
+			for (Usize i = 0; i < count; ++i)
+				numbers[i] = i;
+			numbers = Reallocate(numbers, count, count * 4, count);
+			bool kept = true;
+			for (Usize i = 0; i < count; ++i)
+				kept = kept && numbers[i] == i;
+			numbers = Reallocate(numbers, count * 4, 16, 16);
+			kept = kept && numbers[15] == 15;
+			Deallocate(numbers, 16);
+			UNIT_TEST_CONDITION("跨越阈值的Reallocate", kept)
+
+			// 逐段追加到远超阈值，每次扩容都经过Reallocate
+			String text;
+			String piece = "0123456789abcdefghijklmnopqrstuvwxyz";
+			while (text.Size() < 8 * LargeAllocationThresholdBytes)
+				text.Append(piece);
+			bool intact = text.Size() % piece.Size() == 0;
+			for (Usize i = 0; i < text.Size(); i += 9973)
+				intact = intact && text[i] == piece[i % piece.Size()];
+			UNIT_TEST_CONDITION("String增长", intact && text.Data()[text.Size()] == '\0')
+
+			text.ShrinkToFit();
+			UNIT_TEST_CONDITION("String收缩", text.Size() == text.Capacity() && text[text.Size() - 1] == 'z')
+		}
+	}
+	UNIT_TEST_AREA_END(TestLargeAllocator)
+}
@@ -0,0 +1,134 @@
+// File /UnitTest/Tests/Test_LineView.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/String/LineView.hpp"
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestLineView)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 LineView")
+
+		auto collect = [](LineView view)
+			{
+				std::vector<StringView> res;
+				for (StringView line : view)
+					res.push_back(line);
+				return res;
+			};
+
+		UNIT_TEST_CHECKPOINT("基础遍历")
+		{
+			std::vector<StringView> lines = collect(LineView("first\nsecond\r\n\nlast"));
+			UNIT_TEST_CONDITION("行数", lines.size() == 4)
+			UNIT_TEST_CONDITION("内容", lines[0] == "first" && lines[1] == "second" && lines[2].Empty() && lines[3] == "last")
+
+			UNIT_TEST_CONDITION("空文本", collect(LineView("")).empty() && LineView("").Count() == 0)
+			UNIT_TEST_CONDITION("结尾换行不产生空行", collect(LineView("a\nb\n")).size() == 2 && LineView("a\nb\n").Count() == 2)
+			UNIT_TEST_CONDITION("只有换行", collect(LineView("\n\n")).size() == 2 && LineView("\r\n").Count() == 1 && collect(LineView("\r\n"))[0].Empty())
+			UNIT_TEST_CONDITION("单独的\\r保留在行内", collect(LineView("a\rb\n"))[0] == "a\rb")
+			UNIT_TEST_CONDITION("满足forward_range", std::ranges::forward_range<LineView>)
+		}
+
+		UNIT_TEST_CHECKPOINT("长文本与std::string_view逐行比较")
+		{
+			std::mt19937 engine(5);
+			std::uniform_int_distribution<Usize> lengthDistribution(0, 150);
+			std::uniform_int_distribution<int> crDistribution(0, 3);
+
+			String text;
+			std::vector<std::string> expected;
+			for (Usize i = 0; i < 3000; ++i)
+			{
+				std::string line(lengthDistribution(engine), 'x');
+				for (Usize j = 0; j < line.size(); j += 7)
+					line[j] = static_cast<char>('a' + j % 26);
+				expected.push_back(line);
+				text.Append(line);
+				if (crDistribution(engine) == 0)
+					text.Append('\r');
+				text.Append('\n');
+			}
+
+			bool allMatched = true;
+			Usize index = 0;
+			for (StringView line : LineView(text))
+			{
+				allMatched = allMatched && index < expected.size() && std::string_view(line.Data(), line.Size()) == expected[index];
+				++index;
+			}
+			UNIT_TEST_CONDITION("逐行内容一致", allMatched && index == expected.size())
+			UNIT_TEST_CONDITION("Count", LineView(text).Count() == expected.size())
+			UNIT_TEST_CONDITION("ParallelCount", LineView(text).ParallelCount() == expected.size())
+		}
+
+		UNIT_TEST_CHECKPOINT("按行边界分块")
+		{
+			String text;
+			for (Usize i = 0; i < 1000; ++i)
+			{
+				text.Append(std::to_string(i));
+				text.Append('\n');
+			}
+			text.Append("tail");
+
+			LineView view(text);
+			bool allMatched = true;
+			for (Usize chunkCount : { 1, 2, 3, 7, 64, 5000 })
+			{
+				std::vector<LineView> chunks = view.Chunks(chunkCount);
+				Usize totalSize = 0;
+				Usize totalLines = 0;
+				const Ch* expectedBegin = text.Data();
+				for (const LineView& chunk : chunks)
+				{
+					// 各块首尾相接，除最后一块外都以换行符结尾
+					allMatched = allMatched && chunk.Text().Data() == expectedBegin && !chunk.Empty();
+					allMatched = allMatched && (&chunk == &chunks.back() || chunk.Text().Back() == '\n');
+					expectedBegin = chunk.Text().EndData();
+					totalSize += chunk.Text().Size();
+					totalLines += chunk.Count();
+				}
+				allMatched = allMatched && chunks.size() <= chunkCount && totalSize == text.Size() && totalLines == 1001;
+			}
+			UNIT_TEST_CONDITION("分块覆盖全部文本且不拆分行", allMatched)
+
+			std::atomic<Usize> lineCount = 0;
+			view.ParallelForEachChunk([&](Usize, LineView chunk)
+				{
+					for (StringView line : chunk)
+						lineCount.fetch_add(line.Empty() ? 0 : 1);
+				});
+			UNIT_TEST_CONDITION("ParallelForEachChunk", lineCount == 1001)
+		}
+
+		UNIT_TEST_CHECKPOINT("U32LineView")
+		{
+			U32String text = U"第一行\r\n第二行\n";
+			std::vector<U32View> lines;
+			for (U32View line : U32LineView(text))
+				lines.push_back(line);
+			UNIT_TEST_CONDITION("内容", lines.size() == 2 && lines[0] == U"第一行" && lines[1] == U"第二行")
+
+			U32String longText;
+			for (Usize i = 0; i < 100; ++i)
+				longText.Append(U"行\n");
+			UNIT_TEST_CONDITION("Count", U32LineView(longText).Count() == 100)
+		}
+	}
+	UNIT_TEST_AREA_END(TestLineView)
+}
@@ -0,0 +1,93 @@
+// File /UnitTest/Tests/Test_MemoryTracker.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Memory/Memory.hpp"
+#include "../../Engine/Memory/MemoryReport.hpp"
+#include "../../Engine/Utils/Parallel.hpp"
+#include "../UnitTestFramework.h"
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestMemoryTracker)
+	{
+		using namespace PenEngine;
+		using namespace PenEngine::Memory;
+
+		UNIT_TEST_MESSAGE("测试 MemoryTracker")
+
+		UNIT_TEST_CHECKPOINT("直方图分桶")
+		{
+			UNIT_TEST_CONDITION("小于16字节", MemoryHistogramBucket(0) == 0 && MemoryHistogramBucket(15) == 0)
+			UNIT_TEST_CONDITION("2的幂边界", MemoryHistogramBucket(16) == 1 && MemoryHistogramBucket(31) == 1 && MemoryHistogramBucket(32) == 2 && MemoryHistogramBucketLowerBound(2) == 32)
+			UNIT_TEST_CONDITION("最后一个桶", MemoryHistogramBucket(Usize(1) << 40) == MemoryHistogramBucketCount - 1)
+		}
+
+		UNIT_TEST_CHECKPOINT("按标签计数")
+		{
+			MemoryStatistics before = GetMemoryStatistics();
+
+			U8* object = Allocate<U8>(100, MemoryTag::Object);
+			U8* io = Allocate<U8>(3000, MemoryTag::Container);
+			MemoryStatistics middle = GetMemoryStatistics();
+			UNIT_TEST_CONDITION("当前字节数", middle[MemoryTag::Object].CurrentBytes - before[MemoryTag::Object].CurrentBytes == 100 && middle[MemoryTag::Container].CurrentBytes - before[MemoryTag::Container].CurrentBytes == 3000)
+			UNIT_TEST_CONDITION("分配次数", middle[MemoryTag::Object].AllocationCount - before[MemoryTag::Object].AllocationCount == 1)
+			UNIT_TEST_CONDITION("直方图", middle[MemoryTag::Container].Histogram[MemoryHistogramBucket(3000)] - before[MemoryTag::Container].Histogram[MemoryHistogramBucket(3000)] == 1)
+
+			Deallocate(object, 100, MemoryTag::Object);
+			Deallocate(io, 3000, MemoryTag::Container);
+			MemoryStatistics after = GetMemoryStatistics();
+			UNIT_TEST_CONDITION("释放后恢复", after[MemoryTag::Object].CurrentBytes == before[MemoryTag::Object].CurrentBytes && after[MemoryTag::Container].DeallocationCount - before[MemoryTag::Container].DeallocationCount == 1)
+			UNIT_TEST_CONDITION("累计分配字节数", after[MemoryTag::Container].AllocatedBytes - before[MemoryTag::Container].AllocatedBytes == 3000)
+
+			String str(static_cast<Usize>(200));
+			UNIT_TEST_CONDITION("String计入String标签", GetMemoryStatistics()[MemoryTag::String].CurrentBytes - after[MemoryTag::String].CurrentBytes >= 200)
+		}
+
+		UNIT_TEST_CHECKPOINT("峰值与多线程")
+		{
+			ResetMemoryPeak();
+			MemoryStatistics before = GetMemoryStatistics();
+
+			// 超过合并阈值的分配会立即反映到峰值上
+			constexpr Usize bigBytes = 4 * MemoryTrackerFlushBytes;
+			U8* big = Allocate<U8>(bigBytes, MemoryTag::Container);
+			Deallocate(big, bigBytes, MemoryTag::Container);
+			MemoryStatistics afterBig = GetMemoryStatistics();
+			UNIT_TEST_CONDITION("峰值", afterBig[MemoryTag::Container].PeakBytes - before[MemoryTag::Container].CurrentBytes >= static_cast<Isize>(bigBytes) && afterBig[MemoryTag::Container].CurrentBytes == before[MemoryTag::Container].CurrentBytes)
+
+			// 在一个线程分配、在另一个线程释放，线程退出后分片中的计数不会丢失
+			constexpr Usize taskCount = 8;
+			constexpr Usize perTask = 1000;
+			std::vector<std::vector<U8*>> blocks(taskCount);
+			ParallelFor(taskCount, [&](Usize task)
+				{
+					for (Usize i = 0; i < perTask; ++i)
+						blocks[task].push_back(Allocate<U8>(64, MemoryTag::Coroutine));
+				}, taskCount);
+			MemoryStatistics allocated = GetMemoryStatistics();
+
+			ParallelFor(taskCount, [&](Usize task)
+				{
+					for (U8* ptr : blocks[(task + 1) % taskCount])
+						Deallocate(ptr, 64, MemoryTag::Coroutine);
+				}, taskCount);
+			MemoryStatistics freed = GetMemoryStatistics();
+
+			UNIT_TEST_CONDITION("多线程分配", allocated[MemoryTag::Coroutine].CurrentBytes - before[MemoryTag::Coroutine].CurrentBytes == static_cast<Isize>(taskCount * perTask * 64))
+			UNIT_TEST_CONDITION("多线程释放", freed[MemoryTag::Coroutine].CurrentBytes == before[MemoryTag::Coroutine].CurrentBytes && freed[MemoryTag::Coroutine].DeallocationCount - before[MemoryTag::Coroutine].DeallocationCount == taskCount * perTask)
+			UNIT_TEST_CONDITION("分配速率", freed.AllocationRate(before, MemoryTag::Coroutine) > 0)
+
+			UNIT_TEST_MESSAGE(FormatMemoryStatistics(freed, &before))
+		}
+	}
+	UNIT_TEST_AREA_END(TestMemoryTracker)
+}
@@ -0,0 +1,148 @@
+// File /UnitTest/Tests/Test_MemoryUtils.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Memory/Utils.hpp"
+#include "../UnitTestFramework.h"
+#include <random>
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		constexpr bool MemoryUtilsConstexprCheck()
+		{
+			PenEngine::Ch32 text[8] = { U'a', U'b', U'c', U'd', U'e', U'f', U'g', U'h' };
+			PenEngine::Ch32 copy[8] = {};
+			PenEngine::MemoryCopy(text, copy, 8);
+			PenEngine::MemoryMove(text, text + 2, 6);
+			PenEngine::MemorySet(copy + 6, U'z', 2);
+			return text[2] == U'a' && text[7] == U'f' && copy[5] == U'f' && copy[7] == U'z'
+				&& PenEngine::MemoryCompare(copy, copy, 8) == 0 && PenEngine::MemoryCompare(text, copy, 8) < 0;
+		}
+
+		static_assert(MemoryUtilsConstexprCheck());
+	}
+
+	UNIT_TEST_AREA_BEGIN(TestMemoryUtils)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 MemoryCopy/MemoryMove/MemorySet/MemoryCompare")
+
+		std::mt19937 engine(7);
+		std::vector<U8> source(1 << 20);
+		for (U8& b : source)
+			b = static_cast<U8>(engine());
+
+		// 覆盖所有小尺寸分支与向量长度附近的边界
+		std::vector<Usize> sizes;
+		for (Usize i = 0; i <= 300; ++i)
+			sizes.push_back(i);
+		for (Usize size : { 511, 512, 513, 4095, 4096, 4097, 65537, 300000 })
+			sizes.push_back(size);
+
+		auto runChecks = [&]
+			{
+				bool copyValid = true;
+				bool moveValid = true;
+				bool setValid = true;
+				bool compareValid = true;
+
+				for (Usize size : sizes)
+				{
+					for (Usize offset : { 0, 1, 7, 31 })
+					{
+						// 前后各留一段哨兵，检查没有越界写入
+						std::vector<U8> target(size + 128, 0xCD);
+						MemoryCopy(source.data() + offset, target.data() + 64 - offset % 8, size);
+						copyValid = copyValid && std::memcmp(target.data() + 64 - offset % 8, source.data() + offset, size) == 0
+							&& target[63 - offset % 8] == 0xCD && target[64 - offset % 8 + size] == 0xCD;
+
+						std::vector<U8> expected(source.begin(), source.begin() + size + 64);
+						std::vector<U8> actual = expected;
+						std::memmove(expected.data() + offset, expected.data() + 32, size);
+						MemoryMove(actual.data() + 32, actual.data() + offset, size);
+						moveValid = moveValid && expected == actual;
+						std::memmove(expected.data() + 32, expected.data() + offset, size);
+						MemoryMove(actual.data() + offset, actual.data() + 32, size);
+						moveValid = moveValid && expected == actual;
+
+						MemorySet(target.data() + offset, U8(0x5A), size);
+						setValid = setValid && std::all_of(target.data() + offset, target.data() + offset + size, [](U8 b) { return b == 0x5A; })
+							&& target[offset + size] != 0x5A;
+
+						std::vector<U8> other(source.begin() + offset, source.begin() + offset + size);
+						compareValid = compareValid && MemoryCompare(other.data(), source.data() + offset, size) == 0;
+						if (size != 0)
+						{
+							Usize position = engine() % size;
+							other[position] ^= 0x80;
+							int res = MemoryCompare(other.data(), source.data() + offset, size);
+							int ref = std::memcmp(other.data(), source.data() + offset, size);
+							compareValid = compareValid && res != 0 && (res < 0) == (ref < 0);
+						}
+					}
+				}
+
+				UNIT_TEST_CONDITION("MemoryCopy", copyValid)
+				UNIT_TEST_CONDITION("MemoryMove", moveValid)
+				UNIT_TEST_CONDITION("MemorySet", setValid)
+				UNIT_TEST_CONDITION("MemoryCompare", compareValid)
+			};
+
+		UNIT_TEST_CHECKPOINT("默认阈值")
+		{
+			runChecks();
+		}
+
+		UNIT_TEST_CHECKPOINT("非临时存储")
+		{
+			// 把阈值调低，让中等大小也走非临时存储
+			SetNonTemporalThresholdBytes(256);
+			UNIT_TEST_CONDITION("阈值", GetNonTemporalThresholdBytes() == 256)
+			runChecks();
+			SetNonTemporalThresholdBytes(0);
+			UNIT_TEST_CONDITION("重新检测", GetNonTemporalThresholdBytes() > 256)
+
+			#if defined(SIMD_SSE2_SUPPORT)
+			// 使用glibc时复制不会走非临时存储，这里直接检查
+			bool streamValid = true;
+			for (Usize size : { 64, 65, 127, 128, 129, 4097, 300000 })
+			{
+				for (Usize offset : { 0, 1, 31 })
+				{
+					std::vector<U8> target(size + 64, 0xCD);
+					PenEngine::Detail::StreamCopyBytes(target.data() + offset, source.data() + offset * 3, size);
+					streamValid = streamValid && std::memcmp(target.data() + offset, source.data() + offset * 3, size) == 0 && target[offset + size] == 0xCD;
+				}
+			}
+			UNIT_TEST_CONDITION("StreamCopyBytes", streamValid)
+			#endif // SIMD_SSE2_SUPPORT
+		}
+
+		UNIT_TEST_CHECKPOINT("多字节元素")
+		{
+			std::vector<U32> values(1000, 0);
+			MemorySet(values.data(), U32(0x01020304), values.size());
+			bool repeated = std::all_of(values.begin(), values.end(), [](U32 v) { return v == 0x01020304; });
+			MemorySet(values.data() + 10, U32(0xFFFFFFFF), 500);
+			bool uniform = values[9] == 0x01020304 && values[10] == 0xFFFFFFFF && values[509] == 0xFFFFFFFF && values[510] == 0x01020304;
+			UNIT_TEST_CONDITION("MemorySet<U32>", repeated && uniform)
+
+			std::vector<U32> copy(values.size());
+			MemoryCopy(values.data(), copy.data(), values.size());
+			UNIT_TEST_CONDITION("MemoryCopy<U32>", copy == values && MemoryCompare(copy.data(), values.data(), copy.size()) == 0)
+		}
+	}
+	UNIT_TEST_AREA_END(TestMemoryUtils)
+}
@@ -0,0 +1,105 @@
+// File /UnitTest/Tests/Test_MonotonicArena.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Memory/MonotonicArena.h"
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <map>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestMonotonicArena)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 MonotonicArena")
+
+		UNIT_TEST_CHECKPOINT("对齐与跨块分配")
+		{
+			MonotonicArena arena(1024);
+			bool aligned = true;
+			std::vector<std::pair<U8*, Usize>> allocations;
+			for (Usize i = 0; i < 400; ++i)
+			{
+				Usize alignment = Usize(1) << (i % 7);
+				Usize bytes = 1 + i % 37;
+				U8* ptr = static_cast<U8*>(arena.Allocate(bytes, alignment));
+				aligned = aligned && reinterpret_cast<Usize>(ptr) % alignment == 0;
+				std::fill_n(ptr, bytes, static_cast<U8>(i));
+				allocations.emplace_back(ptr, bytes);
+			}
+			UNIT_TEST_CONDITION("地址满足对齐", aligned)
+
+			// 之后的分配不能覆盖之前的内容
+			bool intact = true;
+			for (Usize i = 0; i < allocations.size(); ++i)
+				intact = intact && std::all_of(allocations[i].first, allocations[i].first + allocations[i].second, [i](U8 v) { return v == static_cast<U8>(i); });
+			UNIT_TEST_CONDITION("内容互不重叠", intact)
+			UNIT_TEST_CONDITION("分配了多个块", arena.BlockCount() > 1 && arena.ReservedBytes() >= arena.UsedBytes())
+
+			// 超过块大小的请求与大对齐
+			void* big = arena.Allocate(5000, 256);
+			UNIT_TEST_CONDITION("大块与大对齐", big != nullptr && reinterpret_cast<Usize>(big) % 256 == 0)
+		}
+
+		UNIT_TEST_CHECKPOINT("标记、重置与统计")
+		{
+			MonotonicArena arena(256);
+			arena.Allocate<u64>(4);
+			MonotonicArena::Marker marker = arena.GetMarker();
+			Usize usedAtMarker = arena.UsedBytes();
+
+			U8* first = arena.Allocate<U8>(100);
+			for (Usize i = 0; i < 10; ++i)
+				arena.Allocate<U8>(100);
+			Usize peak = arena.UsedBytes();
+			Usize blocks = arena.BlockCount();
+
+			arena.Rewind(marker);
+			UNIT_TEST_CONDITION("回退后的已用字节数", arena.UsedBytes() == usedAtMarker && arena.HighWaterBytes() == peak)
+			UNIT_TEST_CONDITION("回退后复用相同的地址", arena.Allocate<U8>(100) == first)
+
+			arena.Reset();
+			UNIT_TEST_CONDITION("重置后保留块", arena.UsedBytes() == 0 && arena.BlockCount() == blocks && arena.HighWaterBytes() == peak)
+			for (Usize i = 0; i < 11; ++i)
+				arena.Allocate<U8>(100);
+			UNIT_TEST_CONDITION("复用时不再申请新块", arena.BlockCount() == blocks)
+
+			arena.Release();
+			UNIT_TEST_CONDITION("释放后归还全部块", arena.BlockCount() == 0 && arena.ReservedBytes() == 0 && arena.UsedBytes() == 0)
+		}
+
+		UNIT_TEST_CHECKPOINT("作为容器与字符串的内存来源")
+		{
+			MonotonicArena arena(512);
+
+			std::pmr::vector<Usize> numbers(&arena);
+			for (Usize i = 0; i < 1000; ++i)
+				numbers.push_back(i);
+			UNIT_TEST_CONDITION("std::pmr::vector", numbers.size() == 1000 && numbers[999] == 999 && arena.UsedBytes() >= 1000 * sizeof(Usize))
+
+			std::map<int, int, std::less<>, ArenaAllocator<std::pair<const int, int>>> map{ ArenaAllocator<std::pair<const int, int>>(arena) };
+			for (int i = 0; i < 100; ++i)
+				map.emplace(i, i * i);
+			UNIT_TEST_CONDITION("ArenaAllocator", map.size() == 100 && map.at(9) == 81 && map.get_allocator().Arena() == &arena)
+
+			String source = "a string that is too long for the local buffer";
+			StringView copy = arena.CopyString<Ch>(source);
+			UNIT_TEST_CONDITION("CopyString", copy == source && copy.Data() != source.Data() && copy.Data()[copy.Size()] == '\0')
+
+			String* str = arena.New<String>(copy);
+			UNIT_TEST_CONDITION("New", *str == source)
+			Memory::Destroy(str);
+		}
+	}
+	UNIT_TEST_AREA_END(TestMonotonicArena)
+}
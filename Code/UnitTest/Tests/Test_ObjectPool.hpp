@@ -0,0 +1,157 @@
+// File /UnitTest/Tests/Test_ObjectPool.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Objects/ObjectPool.hpp"
+#include "../../Engine/Objects/WorldObject.h"
+#include "../UnitTestFramework.h"
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		class PooledWorldObject : public PenEngine::WorldObject
+		{
+		public:
+			static inline std::atomic<int> LiveCount = 0;
+
+			explicit PooledWorldObject(int value, bool fail = false) : Value(value)
+			{
+				if (fail)
+					throw std::runtime_error("construct");
+				++LiveCount;
+			}
+
+			~PooledWorldObject() override { --LiveCount; }
+
+			PenEngine::StringView GetMetaType() const noexcept override { return "PooledWorldObject"; }
+			PenEngine::Usize GetMetaHash() const noexcept override { return 0; }
+
+			int Value;
+		};
+	}
+
+	UNIT_TEST_AREA_BEGIN(TestObjectPool)
+	{
+		using namespace PenEngine;
+		using Object = Detail::PooledWorldObject;
+
+		UNIT_TEST_MESSAGE("测试 ObjectPool")
+
+		UNIT_TEST_CHECKPOINT("创建与查找")
+		{
+			ObjectPool<Object> pool;
+			ObjectID a = pool.Create(1);
+			ObjectID b = pool.Create(2);
+			UNIT_TEST_CONDITION("ID有效且不同", a != InvalidObjectID && b != InvalidObjectID && a != b)
+			UNIT_TEST_CONDITION("通过ID查找", pool.Get(a)->Value == 1 && pool.Get(b)->Value == 2 && pool.Size() == 2)
+			UNIT_TEST_CONDITION("对象记录自己的ID", pool.Get(a)->GetObjectID() == a && pool.Get(b)->GetObjectID() == b)
+			UNIT_TEST_CONDITION("无效ID", pool.Get(InvalidObjectID) == nullptr && pool.Get(MakeObjectID(100000, 1)) == nullptr && pool.Get(MakeObjectID(GetObjectIndex(a), 2)) == nullptr)
+		}
+
+		UNIT_TEST_CHECKPOINT("销毁与复用")
+		{
+			ObjectPool<Object> pool;
+			ObjectID a = pool.Create(1);
+			ObjectID b = pool.Create(2);
+			Object* address = pool.Get(a);
+			UNIT_TEST_CONDITION("销毁", pool.Destroy(a) && !pool.Contains(a) && pool.Size() == 1 && pool.Get(b)->Value == 2)
+			UNIT_TEST_CONDITION("重复销毁失败", !pool.Destroy(a))
+
+			ObjectID c = pool.Create(3);
+			UNIT_TEST_CONDITION("复用同一个位置", GetObjectIndex(c) == GetObjectIndex(a) && pool.Get(c) == address)
+			UNIT_TEST_CONDITION("旧ID失效", c != a && GetObjectGeneration(c) == GetObjectGeneration(a) + 2 && pool.Get(a) == nullptr && !pool.Destroy(a))
+			UNIT_TEST_CONDITION("新ID有效", pool.Get(c)->Value == 3)
+		}
+
+		UNIT_TEST_CHECKPOINT("分块存放与遍历")
+		{
+			int before = Object::LiveCount;
+			{
+				ObjectPool<Object> pool;
+				std::vector<ObjectID> ids;
+				for (int i = 0; i < 3000; ++i)
+					ids.push_back(pool.Create(i));
+				for (int i = 0; i < 3000; i += 2)
+					pool.Destroy(ids[i]);
+
+				long long sum = 0;
+				Usize count = 0;
+				pool.ForEach([&](Object& object)
+					{
+						sum += object.Value;
+						++count;
+					});
+				UNIT_TEST_CONDITION("遍历所有对象", count == 1500 && sum == 1500LL * 1500 && pool.Size() == 1500)
+				UNIT_TEST_CONDITION("块内连续存放", pool.Get(ids[3]) + 2 == pool.Get(ids[5]) && pool.Capacity() == 3 * ObjectPool<Object>::ChunkCapacity)
+			}
+			UNIT_TEST_CONDITION("析构时销毁剩余对象", Object::LiveCount == before)
+		}
+
+		UNIT_TEST_CHECKPOINT("构造函数抛出异常")
+		{
+			ObjectPool<Object> pool;
+			bool thrown = false;
+			try
+			{
+				pool.Create(1, true);
+			}
+			catch (const std::runtime_error&)
+			{
+				thrown = true;
+			}
+			ObjectID a = pool.Create(2);
+			UNIT_TEST_CONDITION("位置归还并复用", thrown && pool.Size() == 1 && GetObjectIndex(a) == 0 && GetObjectGeneration(a) == 1)
+		}
+
+		UNIT_TEST_CHECKPOINT("多线程创建与销毁")
+		{
+			static constexpr int threadCount = 4;
+			static constexpr int perThread = 20000;
+			ObjectPool<Object> pool;
+			std::vector<std::vector<ObjectID>> kept(threadCount);
+			{
+				std::vector<std::jthread> threads;
+				for (int t = 0; t < threadCount; ++t)
+				{
+					threads.emplace_back([&, t]
+						{
+							for (int i = 0; i < perThread; ++i)
+							{
+								ObjectID id = pool.Create(t * perThread + i);
+								if (i % 4 == 0)
+									kept[t].push_back(id);
+								else
+									pool.Destroy(id);
+							}
+						});
+				}
+			}
+
+			std::unordered_set<ObjectID> unique;
+			bool valid = true;
+			for (int t = 0; t < threadCount; ++t)
+			{
+				for (ObjectID id : kept[t])
+				{
+					unique.insert(id);
+					valid = valid && pool.Get(id) != nullptr && pool.Get(id)->Value / perThread == t;
+				}
+			}
+			UNIT_TEST_CONDITION("保留的对象有效且ID唯一", valid && unique.size() == threadCount * perThread / 4 && pool.Size() == unique.size())
+		}
+	}
+	UNIT_TEST_AREA_END(TestObjectPool)
+}
@@ -0,0 +1,114 @@
+// File /UnitTest/Tests/Test_ParallelStrSearch.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestParallelStrSearch)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试并行查找")
+
+		// 阈值设为0并使用很小的分块，让短串也被拆成多块，从而覆盖跨块的匹配
+		auto splitOptions = [](Usize workers)
+			{
+				ParallelSearchOptions options;
+				options.SerialThreshold = 0;
+				options.MinChunkBytes = 1;
+				options.MaxWorkerCount = workers;
+				return options;
+			};
+
+		UNIT_TEST_CHECKPOINT("跨块匹配")
+		{
+			// 每块只有几个字符，needle必然跨越块边界
+			StringView s = "xxxxabcdexxxxabcdexx";
+			ParallelSearchOptions options = splitOptions(8);
+			UNIT_TEST_CONDITION("第一个", s.ParallelFind("abcde", options) == 4 && s.ParallelFind('e', options) == 8)
+			UNIT_TEST_CONDITION("最后一个", s.ParallelFindLast("abcde", options) == 13 && s.ParallelFindLast('a', options) == 13)
+			UNIT_TEST_CONDITION("全部", s.ParallelFindAll("abcde", MatchMode::NonOverlapping, options) == std::vector<Usize>({ 4,13 }) && s.ParallelCount("abcde", MatchMode::NonOverlapping, options) == 2)
+			UNIT_TEST_CONDITION("FindFirstOf", s.ParallelFindFirstOf("edc", options) == 6 && s.ParallelFindFirstOf("z", options) == NPos)
+			UNIT_TEST_CONDITION("不存在", s.ParallelFind("abcdf", options) == NPos && s.ParallelFindLast("abcdf", options) == NPos && s.ParallelCount('z', options) == 0)
+			UNIT_TEST_CONDITION("空子串", s.ParallelFind("", options) == 0 && s.ParallelFindLast("", options) == s.Size() && s.ParallelCount("", MatchMode::NonOverlapping, options) == 0)
+		}
+
+		UNIT_TEST_CHECKPOINT("不重叠匹配的跨块修正")
+		{
+			// 周期性文本中不同起点的贪心匹配永远不会重新对齐，必须依赖合并时的修正
+			String s('a', 1001);
+			ParallelSearchOptions options = splitOptions(7);
+			UNIT_TEST_CONDITION("不重叠", s.ParallelCount("aa", MatchMode::NonOverlapping, options) == 500 && s.ParallelCount("aaa", MatchMode::NonOverlapping, options) == 333)
+			UNIT_TEST_CONDITION("重叠", s.ParallelCount("aa", MatchMode::Overlapping, options) == 1000)
+			UNIT_TEST_CONDITION("位置", s.ParallelFindAll("aaa", MatchMode::NonOverlapping, options) == s.FindAll("aaa", MatchMode::NonOverlapping))
+		}
+
+		UNIT_TEST_CHECKPOINT("随机数据与串行结果一致")
+		{
+			std::mt19937 engine(17);
+			std::uniform_int_distribution<int> charDistribution('a', 'c');
+			std::uniform_int_distribution<Usize> lengthDistribution(0, 400);
+			std::uniform_int_distribution<Usize> needleDistribution(1, 6);
+			std::uniform_int_distribution<Usize> workerDistribution(1, 9);
+
+			bool allMatched = true;
+			for (Usize n = 0; n < 300; ++n)
+			{
+				String source;
+				Usize length = lengthDistribution(engine);
+				for (Usize i = 0; i < length; ++i)
+					source.Append(static_cast<Ch>(charDistribution(engine)));
+
+				String needle;
+				Usize needleLength = needleDistribution(engine);
+				for (Usize i = 0; i < needleLength; ++i)
+					needle.Append(static_cast<Ch>(charDistribution(engine)));
+
+				StringView view = source;
+				ParallelSearchOptions options = splitOptions(workerDistribution(engine));
+				std::vector<Usize> all = view.FindAll(needle, MatchMode::Overlapping);
+
+				allMatched = allMatched && view.ParallelFind(needle, options) == (all.empty() ? NPos : all.front());
+				allMatched = allMatched && view.ParallelFindLast(needle, options) == (all.empty() ? NPos : all.back());
+				allMatched = allMatched && view.ParallelFind(needle[0], options) == view.Find(needle[0]);
+				allMatched = allMatched && view.ParallelFindFirstOf(needle, options) == view.FindFirstOf(needle);
+				allMatched = allMatched && view.ParallelCount(needle[0], options) == view.Count(needle[0]);
+				allMatched = allMatched && view.ParallelFindAll(needle[0], options) == view.FindAll(needle[0]);
+				for (MatchMode mode : { MatchMode::NonOverlapping, MatchMode::Overlapping })
+				{
+					allMatched = allMatched && view.ParallelFindAll(needle, mode, options) == view.FindAll(needle, mode);
+					allMatched = allMatched && view.ParallelCount(needle, mode, options) == view.Count(needle, mode);
+				}
+			}
+			UNIT_TEST_CONDITION("所有组合", allMatched)
+		}
+
+		UNIT_TEST_CHECKPOINT("阈值与大文本")
+		{
+			U32String text;
+			for (Usize i = 0; i < 1000000; ++i)
+				text.Append(U"行文");
+			text.Append(U"结束");
+
+			// 默认阈值下该文本会被拆分，小于阈值时串行执行，两者结果应一致
+			ParallelSearchOptions serial;
+			serial.SerialThreshold = NPos;
+			UNIT_TEST_CONDITION("查找", text.ParallelFind(U"结束") == 2000000 && text.ParallelFind(U"结束", serial) == 2000000)
+			UNIT_TEST_CONDITION("统计", text.ParallelCount(U'行') == 1000000 && text.ParallelCount(U"文行") == 999999 && text.ParallelCount(U"文行", MatchMode::NonOverlapping, serial) == 999999)
+			UNIT_TEST_CONDITION("最后一个", text.ParallelFindLast(U"行文") == 1999998)
+		}
+	}
+	UNIT_TEST_AREA_END(TestParallelStrSearch)
+}
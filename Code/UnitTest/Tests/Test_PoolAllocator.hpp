@@ -0,0 +1,118 @@
+// File /UnitTest/Tests/Test_PoolAllocator.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Memory/PoolAllocator.h"
+#include "../../Engine/Utils/Parallel.hpp"
+#include "../UnitTestFramework.h"
+#include <algorithm>
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestPoolAllocator)
+	{
+		using namespace PenEngine;
+		using namespace PenEngine::Memory;
+
+		UNIT_TEST_MESSAGE("测试 PoolAllocator")
+
+		UNIT_TEST_CHECKPOINT("大小分级")
+		{
+			bool covered = true;
+			for (Usize bytes = 0; bytes <= PoolMaxBlockBytes; ++bytes)
+			{
+				Usize sizeClass = Memory::Detail::PoolSizeClass(bytes);
+				Usize classBytes = Memory::Detail::PoolClassBytes(sizeClass);
+				covered = covered && sizeClass < Memory::Detail::PoolSizeClassCount && classBytes >= bytes && classBytes % PoolAlignment == 0;
+				covered = covered && (sizeClass == 0 || Memory::Detail::PoolClassBytes(sizeClass - 1) < bytes);
+			}
+			UNIT_TEST_CONDITION("每个大小落在能容纳它的最小一级", covered)
+		}
+
+		UNIT_TEST_CHECKPOINT("分配与复用")
+		{
+			std::mt19937 engine(7);
+			std::uniform_int_distribution<Usize> sizeDistribution(0, 1500);
+
+			std::vector<std::pair<U8*, Usize>> allocations;
+			bool valid = true;
+			for (Usize i = 0; i < 20000; ++i)
+			{
+				Usize bytes = sizeDistribution(engine);
+				U8* ptr = static_cast<U8*>(PoolAllocate(bytes));
+				valid = valid && reinterpret_cast<Usize>(ptr) % PoolAlignment == 0;
+				std::fill_n(ptr, bytes, static_cast<U8>(i));
+				allocations.emplace_back(ptr, bytes);
+
+				// 随机归还一部分，让之后的分配复用空闲块
+				if (i % 3 == 0)
+				{
+					Usize index = engine() % allocations.size();
+					auto [freed, freedBytes] = allocations[index];
+					valid = valid && std::all_of(freed, freed + freedBytes, [v = freed[0]](U8 x) { return x == v; });
+					PoolDeallocate(freed, freedBytes);
+					allocations[index] = allocations.back();
+					allocations.pop_back();
+				}
+			}
+
+			for (auto [ptr, bytes] : allocations)
+				PoolDeallocate(ptr, bytes);
+			UNIT_TEST_CONDITION("对齐且内容不被其他分配覆盖", valid)
+
+			void* first = PoolAllocate(48);
+			PoolDeallocate(first, 48);
+			void* second = PoolAllocate(40);
+			UNIT_TEST_CONDITION("同一级的块被立即复用", first == second)
+			PoolDeallocate(second, 40);
+		}
+
+		UNIT_TEST_CHECKPOINT("跨线程归还")
+		{
+			// 每个任务归还前一个任务分配的块，块在线程之间流动
+			constexpr Usize taskCount = 16;
+			constexpr Usize perTask = 5000;
+			std::vector<std::vector<U8*>> blocks(taskCount);
+			ParallelFor(taskCount, [&](Usize task)
+				{
+					for (Usize i = 0; i < perTask; ++i)
+					{
+						U8* ptr = static_cast<U8*>(PoolAllocate(64));
+						std::fill_n(ptr, 64, static_cast<U8>(task));
+						blocks[task].push_back(ptr);
+					}
+				});
+
+			std::atomic<bool> intact = true;
+			ParallelFor(taskCount, [&](Usize task)
+				{
+					for (U8* ptr : blocks[(task + 1) % taskCount])
+					{
+						if (!std::all_of(ptr, ptr + 64, [task, taskCount](U8 v) { return v == static_cast<U8>((task + 1) % taskCount); }))
+							intact = false;
+						PoolDeallocate(ptr, 64);
+					}
+					PoolFlushThreadCache();
+				});
+			UNIT_TEST_CONDITION("不同线程之间的块互不重叠", intact.load())
+
+			std::vector<void*> again;
+			for (Usize i = 0; i < taskCount * perTask; ++i)
+				again.push_back(PoolAllocate(64));
+			std::ranges::sort(again);
+			UNIT_TEST_CONDITION("交还的块可以被再次分配且不重复", std::ranges::adjacent_find(again) == again.end())
+			for (void* ptr : again)
+				PoolDeallocate(ptr, 64);
+		}
+	}
+	UNIT_TEST_AREA_END(TestPoolAllocator)
+}
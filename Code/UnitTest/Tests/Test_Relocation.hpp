@@ -0,0 +1,120 @@
+// File /UnitTest/Tests/Test_Relocation.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Math/Vec4.hpp"
+#include "../../Engine/Memory/Relocation.hpp"
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <list>
+#include <stdexcept>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		// 第ThrowAt次移动构造时抛出异常
+		struct ThrowingMove
+		{
+			static inline int MoveCount = 0;
+			static inline int ThrowAt = -1;
+			static inline int LiveCount = 0;
+
+			int Value;
+
+			explicit ThrowingMove(int value) : Value(value) { ++LiveCount; }
+			ThrowingMove(const ThrowingMove& other) : Value(other.Value) { ++LiveCount; }
+			ThrowingMove(ThrowingMove&& other) : Value(other.Value)
+			{
+				if (MoveCount++ == ThrowAt)
+					throw std::runtime_error("move");
+				other.Value = -1;
+				++LiveCount;
+			}
+			~ThrowingMove() { --LiveCount; }
+		};
+	}
+
+	UNIT_TEST_AREA_BEGIN(TestRelocation)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 Relocation")
+
+		UNIT_TEST_CHECKPOINT("类型特征")
+		{
+			UNIT_TEST_CONDITION("平凡复制的类型", Memory::IsTriviallyRelocatableV<int> && Memory::IsTriviallyRelocatableV<const u64>)
+			UNIT_TEST_CONDITION("特化的框架类型", Memory::IsTriviallyRelocatableV<String> && Memory::IsTriviallyRelocatableV<BasicString<Ch32>> && Memory::IsTriviallyRelocatableV<Vec4> && Memory::IsTriviallyRelocatableV<const Vec4>)
+			UNIT_TEST_CONDITION("没有特化的类型", !Memory::IsTriviallyRelocatableV<std::list<int>> && !Memory::IsTriviallyRelocatableV<Detail::ThrowingMove>)
+			UNIT_TEST_CONDITION("不抛出异常", Memory::IsNothrowRelocatableV<String> && Memory::IsNothrowRelocatableV<std::list<int>> && !Memory::IsNothrowRelocatableV<Detail::ThrowingMove>)
+		}
+
+		UNIT_TEST_CHECKPOINT("RelocateRange")
+		{
+			auto stringAllocations = []
+				{
+					return Memory::GetMemoryStatistics()[Memory::MemoryTag::String].AllocationCount;
+				};
+
+			alignas(String) std::byte source[4 * sizeof(String)];
+			alignas(String) std::byte target[4 * sizeof(String)];
+			String* from = reinterpret_cast<String*>(source);
+			String* to = reinterpret_cast<String*>(target);
+			std::construct_at(from, "sso");
+			std::construct_at(from + 1, "a string that is stored on the heap");
+			std::construct_at(from + 2);
+			std::construct_at(from + 3, "another heap string, long enough");
+
+			u64 before = stringAllocations();
+			Memory::RelocateRange(from, from + 4, to);
+			UNIT_TEST_CONDITION("字符串按字节搬动", to[0] == "sso" && to[1] == "a string that is stored on the heap" && to[2].Empty() && to[3] == "another heap string, long enough")
+			UNIT_TEST_CONDITION("搬动时不分配", stringAllocations() == before)
+
+			Memory::Relocate(to + 3, from);
+			Memory::RelocateOverlappingRange(to, to + 3, to + 1);
+			UNIT_TEST_CONDITION("重叠区间", to[1] == "sso" && to[2] == "a string that is stored on the heap" && to[3].Empty() && from[0] == "another heap string, long enough")
+			std::destroy(to + 1, to + 4);
+			std::destroy_at(from);
+		}
+
+		UNIT_TEST_CHECKPOINT("移动构造抛出异常")
+		{
+			alignas(Detail::ThrowingMove) std::byte source[3 * sizeof(Detail::ThrowingMove)];
+			alignas(Detail::ThrowingMove) std::byte target[3 * sizeof(Detail::ThrowingMove)];
+			auto* from = reinterpret_cast<Detail::ThrowingMove*>(source);
+			auto* to = reinterpret_cast<Detail::ThrowingMove*>(target);
+			for (int i = 0; i < 3; ++i)
+				std::construct_at(from + i, i);
+
+			Detail::ThrowingMove::MoveCount = 0;
+			Detail::ThrowingMove::ThrowAt = 2;
+			bool thrown = false;
+			try
+			{
+				Memory::RelocateRange(from, from + 3, to);
+			}
+			catch (const std::runtime_error&)
+			{
+				thrown = true;
+			}
+			UNIT_TEST_CONDITION("已经搬动的对象被析构", thrown && Detail::ThrowingMove::LiveCount == 3)
+
+			// 移动构造已经修改了前两个原对象
+			for (int i = 0; i < 3; ++i)
+				from[i].Value = i;
+			Detail::ThrowingMove::ThrowAt = -1;
+			Memory::RelocateRange(from, from + 3, to);
+			UNIT_TEST_CONDITION("逐个移动并析构原对象", Detail::ThrowingMove::LiveCount == 3 && to[0].Value == 0 && to[2].Value == 2)
+			std::destroy(to, to + 3);
+		}
+	}
+	UNIT_TEST_AREA_END(TestRelocation)
+}
@@ -0,0 +1,201 @@
+// File /UnitTest/Tests/Test_RingBuffer.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Container/RingBuffer.hpp"
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestRingBuffer)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 SPSCRingBuffer、MPMCRingBuffer 与 BlockingRingBuffer")
+
+		UNIT_TEST_CHECKPOINT("单线程")
+		{
+			SPSCRingBuffer<int> spsc(3);
+			MPMCRingBuffer<int> mpmc(3);
+			UNIT_TEST_CONDITION("容量取整为2的幂", spsc.Capacity() == 4 && mpmc.Capacity() == 4 && MPMCRingBuffer<int>(1).Capacity() == 2)
+			UNIT_TEST_CONDITION("空队列", !spsc.TryPop() && !mpmc.TryPop() && spsc.EmptyApprox() && mpmc.EmptyApprox())
+
+			bool pushed = true;
+			for (int i = 0; i < 4; ++i)
+				pushed = pushed && spsc.TryPush(i) && mpmc.TryPush(i);
+			UNIT_TEST_CONDITION("放满", pushed && spsc.SizeApprox() == 4 && mpmc.SizeApprox() == 4)
+			UNIT_TEST_CONDITION("满时放入失败", !spsc.TryPush(4) && !mpmc.TryPush(4))
+
+			// 反复绕回，检查先进先出
+			bool ordered = true;
+			for (int i = 4; i < 100; ++i)
+			{
+				ordered = ordered && spsc.TryPop() == i - 4 && mpmc.TryPop() == i - 4;
+				ordered = ordered && spsc.TryPush(i) && mpmc.TryPush(i);
+			}
+			UNIT_TEST_CONDITION("绕回后先进先出", ordered && spsc.SizeApprox() == 4 && mpmc.SizeApprox() == 4)
+		}
+
+		UNIT_TEST_CHECKPOINT("批量操作")
+		{
+			SPSCRingBuffer<int> spsc(8);
+			MPMCRingBuffer<int> mpmc(8);
+			std::vector<int> input = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+			UNIT_TEST_CONDITION("批量放入受容量限制", spsc.TryPushBatch(input.begin(), input.end()) == 8 && mpmc.TryPushBatch(input.begin(), input.end()) == 8)
+			UNIT_TEST_CONDITION("满时批量放入", spsc.TryPushBatch(input.begin(), input.end()) == 0 && mpmc.TryPushBatch(input.begin(), input.end()) == 0)
+
+			std::vector<int> spscOut, mpmcOut;
+			UNIT_TEST_CONDITION("批量取出", spsc.TryPopBatch(std::back_inserter(spscOut), 5) == 5 && mpmc.TryPopBatch(std::back_inserter(mpmcOut), 5) == 5)
+			UNIT_TEST_CONDITION("跨越末尾放入", spsc.TryPushBatch(input.begin(), input.begin() + 4) == 4 && mpmc.TryPushBatch(input.begin(), input.begin() + 4) == 4)
+			UNIT_TEST_CONDITION("取出剩余", spsc.TryPopBatch(std::back_inserter(spscOut), 100) == 7 && mpmc.TryPopBatch(std::back_inserter(mpmcOut), 100) == 7)
+			UNIT_TEST_CONDITION("空时批量取出", spsc.TryPopBatch(std::back_inserter(spscOut), 100) == 0 && mpmc.TryPopBatch(std::back_inserter(mpmcOut), 100) == 0)
+
+			std::vector<int> expected = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3 };
+			UNIT_TEST_CONDITION("顺序", spscOut == expected && mpmcOut == expected)
+		}
+
+		UNIT_TEST_CHECKPOINT("非平凡类型")
+		{
+			Memory::MemoryStatistics before = Memory::GetMemoryStatistics();
+			{
+				SPSCRingBuffer<String> spsc(4);
+				MPMCRingBuffer<String> mpmc(4);
+				String value("a string that does not fit into the small buffer");
+				for (int i = 0; i < 3; ++i)
+				{
+					spsc.TryPush(value);
+					mpmc.TryEmplace(value);
+				}
+				std::optional<String> spscValue = spsc.TryPop();
+				std::optional<String> mpmcValue = mpmc.TryPop();
+				UNIT_TEST_CONDITION("取出", spscValue == value && mpmcValue == value)
+			}
+			Memory::MemoryStatistics after = Memory::GetMemoryStatistics();
+			UNIT_TEST_CONDITION("析构时销毁剩余元素",
+								after[Memory::MemoryTag::String].AllocationCount - before[Memory::MemoryTag::String].AllocationCount ==
+								after[Memory::MemoryTag::String].DeallocationCount - before[Memory::MemoryTag::String].DeallocationCount)
+		}
+
+		UNIT_TEST_CHECKPOINT("多线程")
+		{
+			static constexpr u64 count = 200000;
+
+			SPSCRingBuffer<u64> spsc(64);
+			bool spscOrdered = true;
+			std::thread consumer([&]
+				{
+					for (u64 expected = 0; expected < count;)
+					{
+						if (std::optional<u64> value = spsc.TryPop())
+						{
+							spscOrdered = spscOrdered && *value == expected;
+							++expected;
+						}
+					}
+				});
+			for (u64 i = 0; i < count;)
+			{
+				if (spsc.TryPush(i))
+					++i;
+			}
+			consumer.join();
+			UNIT_TEST_CONDITION("SPSC 顺序", spscOrdered)
+
+			// 每个生产者的值在消费者一端保持各自的顺序，总和不变
+			static constexpr u64 threads = 4;
+			MPMCRingBuffer<u64> mpmc(64);
+			std::atomic<u64> sum = 0;
+			std::atomic<u64> popped = 0;
+			std::atomic<bool> mpmcOrdered = true;
+			std::vector<std::thread> workers;
+			for (u64 t = 0; t < threads; ++t)
+			{
+				workers.emplace_back([&, t]
+					{
+						std::vector<u64> batch;
+						for (u64 i = 0; i < count; i += batch.size())
+						{
+							batch.clear();
+							for (u64 j = i; j < std::min(i + 3, count); ++j)
+								batch.push_back(t << 32 | j);
+							Usize pushed = 0;
+							while (pushed == 0)
+								pushed = mpmc.TryPushBatch(batch.begin(), batch.end());
+							batch.resize(pushed);
+						}
+					});
+				workers.emplace_back([&]
+					{
+						u64 last[threads];
+						std::fill(std::begin(last), std::end(last), ~0ull);
+						u64 buffer[4];
+						while (popped.load(std::memory_order::relaxed) < threads * count)
+						{
+							Usize n = mpmc.TryPopBatch(buffer, 4);
+							for (Usize i = 0; i < n; ++i)
+							{
+								u64 producer = buffer[i] >> 32, index = buffer[i] & 0xFFFFFFFF;
+								if (last[producer] != ~0ull && index <= last[producer])
+									mpmcOrdered = false;
+								last[producer] = index;
+								sum += index;
+							}
+							popped += n;
+						}
+					});
+			}
+			for (auto& worker : workers)
+				worker.join();
+			UNIT_TEST_CONDITION("MPMC 数量与总和", popped == threads * count && sum == threads * (count * (count - 1) / 2))
+			UNIT_TEST_CONDITION("MPMC 单个生产者内的顺序", mpmcOrdered)
+		}
+
+		UNIT_TEST_CHECKPOINT("阻塞")
+		{
+			static constexpr u64 count = 100000;
+			BlockingRingBuffer<SPSCRingBuffer<u64>> spsc(4);
+			BlockingRingBuffer<MPMCRingBuffer<u64>> mpmc(4);
+
+			std::thread producer([&]
+				{
+					for (u64 i = 0; i < count; ++i)
+						spsc.Push(i);
+					u64 values[] = { 1, 2, 3, 4, 5, 6, 7 };
+					for (u64 i = 0; i < count; i += 7)
+						mpmc.PushBatch(std::begin(values), std::end(values));
+				});
+
+			bool ordered = true;
+			for (u64 i = 0; i < count; ++i)
+				ordered = ordered && spsc.Pop() == i;
+
+			u64 sum = 0;
+			u64 received = 0;
+			u64 buffer[5];
+			while (received < (count + 6) / 7 * 7)
+			{
+				Usize n = mpmc.PopBatch(buffer, 5);
+				for (Usize i = 0; i < n; ++i)
+					sum += buffer[i];
+				received += n;
+			}
+			producer.join();
+
+			UNIT_TEST_CONDITION("阻塞的 Push 与 Pop", ordered)
+			UNIT_TEST_CONDITION("阻塞的批量操作", sum == (count + 6) / 7 * 28 && mpmc.EmptyApprox())
+		}
+	}
+	UNIT_TEST_AREA_END(TestRingBuffer)
+}
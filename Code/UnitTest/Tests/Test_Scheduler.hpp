@@ -0,0 +1,144 @@
+// File /UnitTest/Tests/Test_Scheduler.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Coroutine/Scheduler.h"
+#include "../UnitTestFramework.h"
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		struct SchedulerThreadRecord
+		{
+			std::thread::id Before;
+			std::thread::id After;
+			bool OnWorker = false;
+		};
+
+		inline PenEngine::AsyncTask<int> SchedulerMoveToWorker(PenEngine::Scheduler& scheduler, SchedulerThreadRecord& record)
+		{
+			record.Before = std::this_thread::get_id();
+			co_await scheduler.Schedule();
+			record.After = std::this_thread::get_id();
+			record.OnWorker = scheduler.IsWorkerThread();
+			co_return 1;
+		}
+
+		inline PenEngine::AsyncTask<PenEngine::u64> SchedulerSquare(PenEngine::u64 value)
+		{
+			co_return value * value;
+		}
+
+		// 每一层分出一个子任务交给调度器，另一个在当前线程执行
+		inline PenEngine::AsyncTask<PenEngine::u64> SchedulerFibonacci(PenEngine::Scheduler& scheduler, PenEngine::u64 n)
+		{
+			if (n < 2)
+				co_return n;
+
+			PenEngine::AsyncTask<PenEngine::u64> left = SchedulerFibonacci(scheduler, n - 1);
+			PenEngine::AsyncTask<PenEngine::u64> right = SchedulerFibonacci(scheduler, n - 2);
+			scheduler.Spawn(left);
+			PenEngine::u64 r = scheduler.Join(right);
+			PenEngine::u64 l = scheduler.Join(left);
+			co_return l + r;
+		}
+
+		inline PenEngine::AsyncTask<int> SchedulerThrow(PenEngine::Scheduler& scheduler)
+		{
+			co_await scheduler.Schedule();
+			throw std::runtime_error("worker");
+			co_return 0;
+		}
+	}
+
+	UNIT_TEST_AREA_BEGIN(TestScheduler)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 Scheduler")
+
+		UNIT_TEST_CHECKPOINT("移动到工作线程")
+		{
+			Scheduler scheduler(2);
+			UNIT_TEST_CONDITION("工作线程数量", scheduler.WorkerCount() == 2 && !scheduler.IsWorkerThread() && Scheduler(0).WorkerCount() == 1)
+
+			Detail::SchedulerThreadRecord record;
+			AsyncTask<int> task = Detail::SchedulerMoveToWorker(scheduler, record);
+			UNIT_TEST_CONDITION("结果", task.Get() == 1 && task.Done())
+			UNIT_TEST_CONDITION("co_await Schedule之后在工作线程上执行",
+								record.Before == std::this_thread::get_id() && record.After != record.Before && record.OnWorker)
+		}
+
+		UNIT_TEST_CHECKPOINT("从外部线程提交")
+		{
+			static constexpr u64 count = 5000;
+			Scheduler scheduler(3, 64);
+			std::vector<AsyncTask<u64>> tasks;
+			for (u64 i = 0; i < count; ++i)
+			{
+				tasks.push_back(Detail::SchedulerSquare(i));
+				scheduler.Spawn(tasks.back());
+			}
+
+			u64 sum = 0;
+			for (auto& task : tasks)
+				sum += task.Get();
+			UNIT_TEST_CONDITION("结果", sum == (count - 1) * count * (2 * count - 1) / 6)
+
+			u64 executed = 0, injected = 0;
+			for (Usize i = 0; i < scheduler.WorkerCount(); ++i)
+			{
+				Scheduler::WorkerStatistics statistics = scheduler.GetWorkerStatistics(i);
+				executed += statistics.Executed;
+				injected += statistics.Injected;
+			}
+			UNIT_TEST_CONDITION("统计", executed == count && injected == count)
+		}
+
+		UNIT_TEST_CHECKPOINT("分叉与合并")
+		{
+			Scheduler scheduler(4);
+			AsyncTask<u64> task = Detail::SchedulerFibonacci(scheduler, 20);
+			scheduler.Spawn(task);
+			UNIT_TEST_CONDITION("结果", scheduler.Join(task) == 6765)
+
+			// fib(20)共有21891次调用，根任务之外每次调用恰好恢复一次
+			u64 executed = 0;
+			for (Usize i = 0; i < scheduler.WorkerCount(); ++i)
+				executed += scheduler.GetWorkerStatistics(i).Executed;
+			UNIT_TEST_CONDITION("由工作线程执行的任务数", executed > 0 && executed <= 21891)
+
+			AsyncTask<u64> inline_ = Detail::SchedulerFibonacci(scheduler, 10);
+			UNIT_TEST_CONDITION("未提交的任务在当前线程执行", scheduler.Join(inline_) == 55)
+		}
+
+		UNIT_TEST_CHECKPOINT("异常")
+		{
+			Scheduler scheduler(2);
+			AsyncTask<int> task = Detail::SchedulerThrow(scheduler);
+			bool thrown = false;
+			try
+			{
+				task.Get();
+			}
+			catch (const std::runtime_error&)
+			{
+				thrown = true;
+			}
+			UNIT_TEST_CONDITION("在等待的线程重新抛出", thrown && task.Done())
+		}
+	}
+	UNIT_TEST_AREA_END(TestScheduler)
+}
@@ -0,0 +1,215 @@
+// File /UnitTest/Tests/Test_SmallVector.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Container/SmallVector.hpp"
+#include "../../Engine/Memory/MonotonicArena.h"
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <list>
+
+namespace PenFramework::UnitTest
+{
+	namespace
+	{
+		// 移动构造可能抛出异常且不能复制，扩容时只能逐个移动
+		struct SmallVectorMoveOnly
+		{
+			int Value;
+
+			explicit SmallVectorMoveOnly(int value) : Value(value) {}
+			SmallVectorMoveOnly(SmallVectorMoveOnly&& other) noexcept(false) : Value(std::exchange(other.Value, -1)) {}
+			SmallVectorMoveOnly(const SmallVectorMoveOnly&) = delete;
+		};
+
+		// 移动构造可能抛出异常但可以复制，扩容时应当复制
+		struct SmallVectorCopyPreferred
+		{
+			int Value;
+			int* Copies;
+
+			SmallVectorCopyPreferred(int value, int* copies) : Value(value), Copies(copies) {}
+			SmallVectorCopyPreferred(SmallVectorCopyPreferred&& other) noexcept(false) : Value(std::exchange(other.Value, -1)), Copies(other.Copies) {}
+			SmallVectorCopyPreferred(const SmallVectorCopyPreferred& other) : Value(other.Value), Copies(other.Copies) { ++*Copies; }
+		};
+	}
+
+	UNIT_TEST_AREA_BEGIN(TestSmallVector)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 SmallVector")
+
+		auto containerAllocations = []
+			{
+				return Memory::GetMemoryStatistics()[Memory::MemoryTag::Container].AllocationCount;
+			};
+
+		UNIT_TEST_CHECKPOINT("内部存储与扩容")
+		{
+			u64 before = containerAllocations();
+			SmallVector<int, 8> v;
+			for (int i = 0; i < 8; ++i)
+				v.push_back(i);
+			UNIT_TEST_CONDITION("不超过N时不分配", v.IsInline() && v.size() == 8 && v.capacity() == 8 && containerAllocations() == before)
+
+			v.push_back(8);
+			bool sequential = true;
+			for (int i = 0; i < 9; ++i)
+				sequential = sequential && v[i] == i;
+			UNIT_TEST_CONDITION("超过N后转到堆内存", !v.IsInline() && v.capacity() >= 9 && sequential && containerAllocations() == before + 1)
+
+			// 参数引用自身的元素时扩容也要得到正确的值
+			SmallVector<int, 2> alias = { 5, 6 };
+			alias.push_back(alias[0]);
+			alias.insert(alias.begin(), 3, alias[2]);
+			UNIT_TEST_CONDITION("参数引用自身元素", (alias == SmallVector<int, 2>{ 5, 5, 5, 5, 6, 5 }))
+
+			v.resize(3);
+			v.shrink_to_fit();
+			UNIT_TEST_CONDITION("缩小后回到内部存储", v.IsInline() && v.size() == 3 && v[2] == 2)
+		}
+
+		UNIT_TEST_CHECKPOINT("与std::vector一致的修改")
+		{
+			SmallVector<int, 4> v = { 1, 2, 3 };
+			v.insert(v.begin() + 1, { 10, 11 });
+			v.emplace(v.end(), 20);
+			v.erase(v.begin());
+			v.insert(v.end(), 2, 7);
+			std::list<int> tail = { 30, 31 };
+			v.insert(v.begin() + 2, tail.begin(), tail.end());
+			UNIT_TEST_CONDITION("插入与删除", (v == SmallVector<int, 4>{ 10, 11, 30, 31, 2, 3, 20, 7, 7 }))
+
+			v.erase(v.begin() + 1, v.begin() + 5);
+			v.pop_back();
+			UNIT_TEST_CONDITION("区间删除", (v == SmallVector<int, 4>{ 10, 3, 20, 7 }) && v.front() == 10 && v.back() == 7)
+
+			v.assign(6, 9);
+			UNIT_TEST_CONDITION("assign", v.size() == 6 && std::all_of(v.begin(), v.end(), [](int x) { return x == 9; }))
+
+			SmallVector<int, 4> smaller = { 9, 9, 9 };
+			UNIT_TEST_CONDITION("比较", smaller < v && smaller != v)
+
+			bool thrown = false;
+			try
+			{
+				v.at(6);
+			}
+			catch (const std::out_of_range&)
+			{
+				thrown = true;
+			}
+			UNIT_TEST_CONDITION("at越界抛出异常", thrown)
+		}
+
+		UNIT_TEST_CHECKPOINT("非平凡类型")
+		{
+			SmallVector<String, 2> v;
+			v.emplace_back("first element that does not fit in sso");
+			v.emplace_back("second");
+			v.emplace_back(v[0]);
+			v.insert(v.begin(), String("zero"));
+			UNIT_TEST_CONDITION("扩容时移动元素", v.size() == 4 && v[0] == "zero" && v[1] == v[3] && v[2] == "second")
+
+			SmallVector<String, 2> copy = v;
+			SmallVector<String, 2> moved = std::move(v);
+			UNIT_TEST_CONDITION("复制与移动", copy == moved && v.empty() && v.IsInline())
+
+			SmallVector<String, 2> inlineVector = { "a" };
+			inlineVector.swap(moved);
+			UNIT_TEST_CONDITION("内部存储与堆内存交换", inlineVector == copy && moved.size() == 1 && moved[0] == "a")
+
+			inlineVector.erase(inlineVector.begin(), inlineVector.begin() + 3);
+			inlineVector.shrink_to_fit();
+			UNIT_TEST_CONDITION("删除后缩小", inlineVector.IsInline() && inlineVector.size() == 1 && inlineVector[0] == copy[3])
+		}
+
+		UNIT_TEST_CHECKPOINT("按字节搬动")
+		{
+			SmallVector<String, 2> v;
+			for (int i = 0; i < 6; ++i)
+				v.emplace_back(String("element that does not fit in sso ") + String(1, static_cast<Ch>('0' + i)));
+			String expected = v[3];
+			v.emplace(v.begin() + 1, "inserted");
+			UNIT_TEST_CONDITION("插入单个元素", v.size() == 7 && v[1] == "inserted" && v[4] == expected)
+
+			SmallVector<String, 2> many(12, String("many elements which live on the heap"));
+			v.insert(v.begin() + 2, many.begin(), many.end());
+			UNIT_TEST_CONDITION("插入超过暂存区的元素", v.size() == 19 && v[1] == "inserted" && v[2] == many[0] && v[13] == many[11] && v[16] == expected)
+
+			v.erase(v.begin() + 2, v.begin() + 14);
+			UNIT_TEST_CONDITION("删除后平移", v.size() == 7 && v[1] == "inserted" && v[4] == expected)
+
+			SmallVector<u64, 4> large;
+			large.reserve((2 << 20) / sizeof(u64));
+			for (u64 i = 0; i < large.capacity(); ++i)
+				large.push_back(i);
+			large.reserve(large.capacity() * 2);
+			UNIT_TEST_CONDITION("大块缓冲区调整大小", large.size() * 2 == large.capacity() && large[12345] == 12345 && large.back() == large.size() - 1)
+		}
+
+		UNIT_TEST_CHECKPOINT("不能按字节搬动的类型")
+		{
+			// std::list的哨兵节点存放在对象内部，只能逐个移动
+			static_assert(!Memory::IsTriviallyRelocatableV<std::list<int>>);
+			SmallVector<std::list<int>, 2> v;
+			for (int i = 0; i < 5; ++i)
+				v.emplace_back(3, i);
+			v.emplace(v.begin(), 1, 10);
+			v.insert(v.begin() + 2, 3, std::list<int>{ 20, 21 });
+			v.erase(v.begin() + 1);
+			UNIT_TEST_CONDITION("扩容、插入与删除", v.size() == 8 && v[0].front() == 10 && v[1].back() == 21 && v[3].back() == 21 && v[4].size() == 3 && v[4].front() == 1 && v[7].back() == 4)
+
+			static_assert(!Memory::IsNothrowRelocatableV<SmallVectorMoveOnly>);
+			SmallVector<SmallVectorMoveOnly, 2> moveOnly;
+			for (int i = 0; i < 5; ++i)
+				moveOnly.emplace_back(i);
+			moveOnly.reserve(16);
+			moveOnly.pop_back();
+			moveOnly.pop_back();
+			moveOnly.shrink_to_fit();
+			UNIT_TEST_CONDITION("移动可能抛出异常且不能复制", moveOnly.size() == 3 && moveOnly[0].Value == 0 && moveOnly[2].Value == 2)
+
+			int copies = 0;
+			SmallVector<SmallVectorCopyPreferred, 2> copyPreferred;
+			for (int i = 0; i < 3; ++i)
+				copyPreferred.emplace_back(i, &copies);
+			copyPreferred.reserve(8);
+			UNIT_TEST_CONDITION("移动可能抛出异常时复制", copies == 5 && copyPreferred[0].Value == 0 && copyPreferred[2].Value == 2)
+		}
+
+		UNIT_TEST_CHECKPOINT("内存资源")
+		{
+			MonotonicArena arena(4096);
+			u64 before = containerAllocations();
+			SmallVector<u64, 4> v(&arena);
+			for (u64 i = 0; i < 100; ++i)
+				v.push_back(i);
+			UNIT_TEST_CONDITION("从内存资源分配", v.GetMemoryResource() == &arena && arena.UsedBytes() >= 100 * sizeof(u64) && containerAllocations() == before)
+
+			SmallVector<u64, 4> moved = std::move(v);
+			UNIT_TEST_CONDITION("移动时沿用内存资源", moved.GetMemoryResource() == &arena && moved.size() == 100 && moved[99] == 99)
+
+			SmallVector<u64, 4> copy = moved;
+			UNIT_TEST_CONDITION("复制时使用默认分配", copy.GetMemoryResource() == nullptr && copy == moved)
+		}
+
+		UNIT_TEST_CHECKPOINT("String::Split")
+		{
+			auto parts = String("a,bb,,c").Split(',');
+			UNIT_TEST_CONDITION("切分结果", parts.size() == 4 && parts[0] == "a" && parts[1] == "bb" && parts[2].Empty() && parts[3] == "c")
+			UNIT_TEST_CONDITION("不超过4段时不分配", parts.IsInline())
+			UNIT_TEST_CONDITION("没有分隔符", String("abc").Split(',').size() == 1 && String().Split(',').size() == 1)
+		}
+	}
+	UNIT_TEST_AREA_END(TestSmallVector)
+}
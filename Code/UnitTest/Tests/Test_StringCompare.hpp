@@ -0,0 +1,151 @@
+// File /UnitTest/Tests/Test_StringCompare.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <map>
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestStringCompare)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 Compare / operator<=>")
+
+		UNIT_TEST_CHECKPOINT("三路比较")
+		{
+			String a = "apple";
+			StringView b = "apply";
+
+			UNIT_TEST_CONDITION("String < StringView", a < b)
+			UNIT_TEST_CONDITION("StringView > String", b > a)
+			UNIT_TEST_CONDITION("与 C 字符串比较", a < "banana" && "banana" > a)
+			UNIT_TEST_CONDITION("与 std::string 比较", a >= std::string("apple") && a < std::string("applf"))
+			UNIT_TEST_CONDITION("前缀较小", StringView("app") < StringView("apple"))
+			UNIT_TEST_CONDITION("空串最小", StringView() < StringView("a") && (String() <=> StringView()) == 0)
+			UNIT_TEST_CONDITION("高位字节按无符号比较", StringView("\x7f") < StringView("\xff"))
+		}
+
+		UNIT_TEST_CHECKPOINT("第一个不同码元的下标")
+		{
+			StringCompareResult res = StringView("hello world").Compare("hello there");
+			UNIT_TEST_CONDITION("不同点", res.Ordering == std::strong_ordering::greater && res.MismatchIndex == 6)
+
+			res = StringView("abc").Compare("abcdef");
+			UNIT_TEST_CONDITION("前缀", res.Ordering == std::strong_ordering::less && res.MismatchIndex == 3)
+
+			res = String("same").Compare("same");
+			UNIT_TEST_CONDITION("相等", res.Ordering == std::strong_ordering::equal && res.MismatchIndex == 4)
+
+			// 覆盖向量块、8字节块与尾部标量的所有边界
+			bool allMatched = true;
+			for (Usize length : { 1, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 100 })
+			{
+				String lhs('x', length);
+				for (Usize i = 0; i < length; ++i)
+				{
+					String rhs = lhs;
+					rhs[i] = 'y';
+					StringCompareResult r = lhs.Compare(rhs);
+					allMatched = allMatched && r.MismatchIndex == i && r.Ordering == std::strong_ordering::less;
+				}
+			}
+			UNIT_TEST_CONDITION("各长度下的不同点", allMatched)
+		}
+
+		UNIT_TEST_CHECKPOINT("U32String")
+		{
+			U32String a = U"\U00010000\U00020000abc";
+			U32String b = U"\U00010000\U00020000abd";
+			StringCompareResult res = a.Compare(b);
+			UNIT_TEST_CONDITION("码元下标", res.MismatchIndex == 4 && res.Ordering == std::strong_ordering::less)
+			UNIT_TEST_CONDITION("按码元大小比较", U32View(U"\x100") > U32View(U"\xff") && U32View(U"\x100") < U32View(U"\x101"))
+
+			bool allMatched = true;
+			U32String lhs(U'a', 40);
+			for (Usize i = 0; i < 40; ++i)
+			{
+				U32String rhs = lhs;
+				// 只改变码元的高位字节，下标必须按码元而不是字节计算
+				rhs[i] = U'a' + 0x10000;
+				allMatched = allMatched && lhs.Compare(rhs).MismatchIndex == i && lhs < rhs;
+			}
+			UNIT_TEST_CONDITION("高位字节不同", allMatched)
+		}
+
+		UNIT_TEST_CHECKPOINT("随机数据与std::string_view结果一致")
+		{
+			std::mt19937 engine(7);
+			std::uniform_int_distribution<Usize> lengthDistribution(0, 48);
+			std::uniform_int_distribution<int> charDistribution(0, 3);
+
+			bool allMatched = true;
+			for (Usize n = 0; n < 2000; ++n)
+			{
+				String lhs, rhs;
+				Usize lhsLength = lengthDistribution(engine);
+				Usize rhsLength = lengthDistribution(engine);
+				for (Usize i = 0; i < lhsLength; ++i)
+					lhs.Append(static_cast<Ch>('a' + charDistribution(engine)));
+				for (Usize i = 0; i < rhsLength; ++i)
+					rhs.Append(static_cast<Ch>('a' + charDistribution(engine)));
+
+				std::string_view l(lhs.Data(), lhs.Size());
+				std::string_view r(rhs.Data(), rhs.Size());
+				allMatched = allMatched && (lhs <=> rhs) == (l <=> r);
+			}
+			UNIT_TEST_CONDITION("比较结果一致", allMatched)
+		}
+
+		UNIT_TEST_CHECKPOINT("有序容器")
+		{
+			std::map<String, int, std::less<>> map = { { "b",2 },{ "a",1 },{ "c",3 } };
+			UNIT_TEST_CONDITION("按字典序排列", map.begin()->first == "a" && map.rbegin()->first == "c")
+			UNIT_TEST_CONDITION("透明查找", map.find(StringView("b")) != map.end() && map.find("b")->second == 2)
+		}
+
+		UNIT_TEST_MESSAGE("测试 NaturalCompare")
+
+		UNIT_TEST_CHECKPOINT("数字按数值比较")
+		{
+			UNIT_TEST_CONDITION("file9 < file10", StringView("file9").NaturalCompare("file10") < 0)
+			UNIT_TEST_CONDITION("file10 > file9", StringView("file10").NaturalCompare("file9") > 0)
+			UNIT_TEST_CONDITION("不同点位于数字串中间", StringView("v1.123").NaturalCompare("v1.45") > 0)
+			UNIT_TEST_CONDITION("多段数字", String("1.2.10").NaturalCompare("1.2.9") > 0 && String("1.10.1").NaturalCompare("1.9.99") > 0)
+			UNIT_TEST_CONDITION("数字与字母", StringView("a1").NaturalCompare("ab") < 0 && StringView("a").NaturalCompare("a0") < 0)
+			UNIT_TEST_CONDITION("相等", StringView("img12.png").NaturalCompare("img12.png") == 0)
+			UNIT_TEST_CONDITION("超长数字不溢出", StringView("x123456789012345678901234567890").NaturalCompare("x123456789012345678901234567891") < 0)
+		}
+
+		UNIT_TEST_CHECKPOINT("前导0")
+		{
+			UNIT_TEST_CONDITION("数值优先", StringView("a007").NaturalCompare("a10") < 0)
+			UNIT_TEST_CONDITION("数值相同时前导0少的较小", StringView("a7").NaturalCompare("a007") < 0 && StringView("a007").NaturalCompare("a7") > 0)
+			UNIT_TEST_CONDITION("后续字符优先于前导0", StringView("a007b").NaturalCompare("a7c") < 0)
+			UNIT_TEST_CONDITION("全0", StringView("0").NaturalCompare("00") < 0 && StringView("00").NaturalCompare("1") < 0)
+		}
+
+		UNIT_TEST_CHECKPOINT("NaturalLess 排序")
+		{
+			std::vector<String> v = { "file10.txt","file2.txt","file1.txt","file01.txt","file100.txt","file20.txt" };
+			std::ranges::sort(v, NaturalLess());
+			UNIT_TEST_CONDITION("排序结果", v[0] == "file1.txt" && v[1] == "file01.txt" && v[2] == "file2.txt" && v[3] == "file10.txt" && v[4] == "file20.txt" && v[5] == "file100.txt")
+
+			std::vector<U32String> u = { U"第10章",U"第2章",U"第1章" };
+			std::ranges::sort(u, NaturalLess());
+			UNIT_TEST_CONDITION("U32String", u[0] == U"第1章" && u[1] == U"第2章" && u[2] == U"第10章")
+		}
+	}
+	UNIT_TEST_AREA_END(TestStringCompare)
+}
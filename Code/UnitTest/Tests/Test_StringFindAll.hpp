@@ -0,0 +1,115 @@
+// File /UnitTest/Tests/Test_StringFindAll.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/String/String.hpp"
+#include "../UnitTestFramework.h"
+#include <array>
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestStringFindAll)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 Count / FindAll")
+
+		// 逐位置比较的参考实现
+		auto reference = [](std::string_view source, std::string_view needle, MatchMode mode)
+			{
+				std::vector<Usize> res;
+				if (needle.empty())
+					return res;
+				for (Usize i = 0; i + needle.size() <= source.size();)
+				{
+					if (source.substr(i, needle.size()) == needle)
+					{
+						res.push_back(i);
+						i += mode == MatchMode::Overlapping ? 1 : needle.size();
+					}
+					else
+						++i;
+				}
+				return res;
+			};
+
+		UNIT_TEST_CHECKPOINT("字符")
+		{
+			String s = "a,b,,c,";
+			UNIT_TEST_CONDITION("Count", s.Count(',') == 4 && s.Count('x') == 0 && StringView().Count('a') == 0)
+			UNIT_TEST_CONDITION("FindAll", s.FindAll(',') == std::vector<Usize>({ 1,3,4,6 }))
+
+			std::array<Usize, 2> buffer;
+			UNIT_TEST_CONDITION("写满span后停止", s.FindAll(',', buffer) == 2 && buffer[0] == 1 && buffer[1] == 3)
+
+			std::vector<Usize> appended = { 100 };
+			StringView(s).FindAll('a', appended);
+			UNIT_TEST_CONDITION("追加到vector", appended == std::vector<Usize>({ 100,0 }))
+		}
+
+		UNIT_TEST_CHECKPOINT("子串重叠与不重叠")
+		{
+			StringView s = "aaaa";
+			UNIT_TEST_CONDITION("不重叠", s.FindAll("aa") == std::vector<Usize>({ 0,2 }) && s.Count("aa") == 2)
+			UNIT_TEST_CONDITION("重叠", s.FindAll("aa", MatchMode::Overlapping) == std::vector<Usize>({ 0,1,2 }) && s.Count("aa", MatchMode::Overlapping) == 3)
+			UNIT_TEST_CONDITION("空子串", s.Count("") == 0 && s.FindAll("").empty())
+			UNIT_TEST_CONDITION("子串长于源串", s.Count("aaaaa") == 0)
+			UNIT_TEST_CONDITION("整串匹配", s.FindAll("aaaa") == std::vector<Usize>({ 0 }))
+		}
+
+		UNIT_TEST_CHECKPOINT("随机数据与参考实现一致")
+		{
+			std::mt19937 engine(13);
+			std::uniform_int_distribution<int> charDistribution('a', 'c');
+			std::uniform_int_distribution<Usize> lengthDistribution(0, 200);
+			std::uniform_int_distribution<Usize> needleDistribution(1, 5);
+
+			bool allMatched = true;
+			for (Usize n = 0; n < 500; ++n)
+			{
+				String source;
+				Usize length = lengthDistribution(engine);
+				for (Usize i = 0; i < length; ++i)
+					source.Append(static_cast<Ch>(charDistribution(engine)));
+
+				String needle;
+				Usize needleLength = needleDistribution(engine);
+				for (Usize i = 0; i < needleLength; ++i)
+					needle.Append(static_cast<Ch>(charDistribution(engine)));
+
+				std::string_view src(source.Data(), source.Size());
+				std::string_view ndl(needle.Data(), needle.Size());
+				for (MatchMode mode : { MatchMode::NonOverlapping, MatchMode::Overlapping })
+				{
+					std::vector<Usize> expected = reference(src, ndl, mode);
+					allMatched = allMatched && source.FindAll(needle, mode) == expected && source.Count(needle, mode) == expected.size();
+				}
+
+				allMatched = allMatched && source.FindAll(needle[0]) == reference(src, ndl.substr(0, 1), MatchMode::Overlapping);
+			}
+			UNIT_TEST_CONDITION("所有组合", allMatched)
+		}
+
+		UNIT_TEST_CHECKPOINT("U32String")
+		{
+			U32String s = U"中文,中文,文中";
+			UNIT_TEST_CONDITION("字符", s.Count(U'中') == 3 && s.FindAll(U',') == std::vector<Usize>({ 2,5 }))
+			UNIT_TEST_CONDITION("子串", s.FindAll(U"中文") == std::vector<Usize>({ 0,3 }))
+
+			U32String longText;
+			for (Usize i = 0; i < 50; ++i)
+				longText.Append(U"ab");
+			UNIT_TEST_CONDITION("跨越向量块", longText.Count(U"ba") == 49 && longText.Count(U'a') == 50 && longText.FindAll(U"bab", MatchMode::Overlapping).size() == 49)
+		}
+	}
+	UNIT_TEST_AREA_END(TestStringFindAll)
+}
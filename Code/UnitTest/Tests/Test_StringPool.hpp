@@ -0,0 +1,107 @@
+// File /UnitTest/Tests/Test_StringPool.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/String/StringPool.hpp"
+#include "../../Engine/String/StringUnorderedMap.hpp"
+#include "../UnitTestFramework.h"
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestStringPool)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 StringPool")
+
+		UNIT_TEST_CHECKPOINT("添加与地址稳定")
+		{
+			StringPool pool(false, 256);
+			std::vector<StringView> views;
+			std::vector<String> expected;
+			for (Usize i = 0; i < 500; ++i)
+			{
+				String s = "key_";
+				s.Append(std::to_string(i));
+				expected.push_back(s);
+				views.push_back(pool.Add(s));
+			}
+
+			// 之后的添加会分配新块，但之前返回的视图不受影响
+			bool allMatched = true;
+			for (Usize i = 0; i < views.size(); ++i)
+				allMatched = allMatched && views[i] == expected[i] && views[i].Data()[views[i].Size()] == '\0' && views[i].Data() != expected[i].Data();
+			UNIT_TEST_CONDITION("内容与结尾空字符", allMatched)
+			UNIT_TEST_CONDITION("统计", pool.Count() == 500 && pool.UsedBytes() >= 500 * 6 && pool.ReservedBytes() >= pool.UsedBytes())
+
+			StringView empty = pool.Add("");
+			UNIT_TEST_CONDITION("空串", empty.Empty() && empty.Data() != nullptr && empty.Data()[0] == '\0')
+
+			// 大字符串单独分配
+			String big('x', 1000);
+			StringView bigView = pool.Add(big);
+			UNIT_TEST_CONDITION("大字符串", bigView == big && views[0] == "key_0")
+		}
+
+		UNIT_TEST_CHECKPOINT("去重")
+		{
+			StringPool pool(true);
+			StringView a = pool.Add("alpha");
+			StringView b = pool.Add(String("alpha"));
+			StringView c = pool.Add("beta");
+			UNIT_TEST_CONDITION("相同内容返回同一视图", a.Data() == b.Data() && a.Data() != c.Data())
+			UNIT_TEST_CONDITION("计数", pool.Count() == 2 && pool.Contain("beta") && !pool.Contain("gamma"))
+		}
+
+		UNIT_TEST_CHECKPOINT("Reset与移动")
+		{
+			StringPool pool(true, 128);
+			for (Usize i = 0; i < 100; ++i)
+			{
+				String s = "value";
+				s.Append(std::to_string(i));
+				pool.Add(s);
+			}
+			pool.Add(String('y', 500));
+
+			pool.Reset();
+			UNIT_TEST_CONDITION("Reset后保留一个块", pool.Count() == 0 && pool.UsedBytes() == 0 && pool.ReservedBytes() == 128 && !pool.Contain("value1"))
+			UNIT_TEST_CONDITION("Reset后可继续使用", pool.Add("again") == "again" && pool.Count() == 1)
+
+			StringPool moved = std::move(pool);
+			UNIT_TEST_CONDITION("移动", moved.Count() == 1 && moved.Contain("again") && pool.Count() == 0 && pool.ReservedBytes() == 0)
+
+			moved.Release();
+			UNIT_TEST_CONDITION("Release", moved.ReservedBytes() == 0 && moved.Add("after") == "after")
+
+			U32StringPool wide(true);
+			UNIT_TEST_CONDITION("U32StringPool", wide.Add(U"中文").Data() == wide.Add(U"中文").Data() && wide.Count() == 1)
+		}
+
+		UNIT_TEST_CHECKPOINT("作为StringViewUnorderedMap的键")
+		{
+			StringPool pool(true);
+			StringViewUnorderedMap<Usize> counts;
+			const char* words[] = { "GET", "POST", "GET", "PUT", "GET" };
+			for (const char* word : words)
+			{
+				// 临时字符串离开作用域后，池中的副本仍可以作为键
+				String temp = word;
+				++counts[pool.Add(temp)];
+			}
+			UNIT_TEST_CONDITION("计数", counts.size() == 3 && counts.find(StringView("GET"))->second == 3 && counts.find("PUT")->second == 1)
+
+			StringUnorderedMap<Usize> owned = { { "POST", 7 } };
+			UNIT_TEST_CONDITION("用池中的视图查找", owned.find(pool.Add("POST"))->second == 7)
+		}
+	}
+	UNIT_TEST_AREA_END(TestStringPool)
+}
@@ -0,0 +1,143 @@
+// File /UnitTest/Tests/Test_StringSort.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/String/StringSort.hpp"
+#include "../UnitTestFramework.h"
+#include <random>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestStringSort)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 StringRadixSort")
+
+		auto lessView = [](StringView lhs, StringView rhs)
+			{
+				return std::string_view(lhs.Data(), lhs.Size()) < std::string_view(rhs.Data(), rhs.Size());
+			};
+
+		auto makeRandomStrings = [](Usize count, Usize maxLength, U32 seed)
+			{
+				std::mt19937 engine(seed);
+				std::uniform_int_distribution<Usize> lengthDistribution(0, maxLength);
+				// 字符集很小，用来制造大量公共前缀
+				std::uniform_int_distribution<int> charDistribution('a', 'd');
+
+				std::vector<String> res;
+				res.reserve(count);
+				for (Usize i = 0; i < count; ++i)
+				{
+					String s;
+					Usize length = lengthDistribution(engine);
+					for (Usize j = 0; j < length; ++j)
+						s.Append(static_cast<Ch>(charDistribution(engine)));
+					res.push_back(std::move(s));
+				}
+				return res;
+			};
+
+		UNIT_TEST_CHECKPOINT("基础排序")
+		{
+			std::vector<String> v = { "banana","apple","","cherry","app","apple","b" };
+			StringRadixSort(v);
+
+			UNIT_TEST_CONDITION("结果有序", std::ranges::is_sorted(v, lessView))
+			UNIT_TEST_CONDITION("空串排在最前", v[0].Empty())
+			UNIT_TEST_CONDITION("前缀排在更长的字符串之前", v[1] == "app" && v[2] == "apple" && v[3] == "apple")
+			UNIT_TEST_CONDITION("最后一个元素", v[6] == "cherry")
+		}
+
+		UNIT_TEST_CHECKPOINT("字节序与特殊字符")
+		{
+			// 高位字节需要按无符号比较，内嵌的'\0'不能被当作结束符
+			std::vector<String> v = { String("a\0b", 3), String("a"), String("\xff"), String("a\0", 2), String("\x7f") };
+			StringRadixSort(v);
+
+			UNIT_TEST_CONDITION("内嵌结束符", v[0] == "a" && v[1].Size() == 2 && v[2].Size() == 3)
+			UNIT_TEST_CONDITION("无符号比较", v[3] == "\x7f" && v[4] == "\xff")
+		}
+
+		UNIT_TEST_CHECKPOINT("随机数据与std::sort结果一致")
+		{
+			std::vector<String> v = makeRandomStrings(5000, 40, 1);
+			std::vector<String> expected = v;
+			std::ranges::sort(expected, lessView);
+
+			StringRadixSort(v);
+			UNIT_TEST_CONDITION("串行路径", v == expected)
+
+			std::vector<String> parallel = makeRandomStrings(20000, 40, 2);
+			std::vector<String> parallelExpected = parallel;
+			std::ranges::sort(parallelExpected, lessView);
+
+			StringRadixSort(parallel.begin(), parallel.end(), 1024);
+			UNIT_TEST_CONDITION("并行路径", parallel == parallelExpected)
+		}
+
+		UNIT_TEST_CHECKPOINT("长公共前缀")
+		{
+			String prefix('x', 300);
+			std::vector<String> v;
+			for (int i = 99; i >= 0; --i)
+			{
+				String s = prefix;
+				s.Append(std::to_string(i));
+				v.push_back(std::move(s));
+			}
+			std::vector<String> expected = v;
+			std::ranges::sort(expected, lessView);
+
+			StringRadixSort(v);
+			UNIT_TEST_CONDITION("跨越多个前缀缓存窗口", v == expected)
+		}
+
+		UNIT_TEST_CHECKPOINT("StringView 与投影")
+		{
+			std::vector<String> storage = makeRandomStrings(1000, 12, 3);
+			std::vector<StringView> views(storage.begin(), storage.end());
+			StringRadixSort(views);
+			UNIT_TEST_CONDITION("StringView 有序", std::ranges::is_sorted(views, lessView))
+
+			struct Record
+			{
+				String Name;
+				Usize Id;
+			};
+
+			std::vector<Record> records;
+			for (Usize i = 0; i < storage.size(); ++i)
+				records.push_back({ storage[i], i });
+
+			StringRadixSort(records, &Record::Name);
+			UNIT_TEST_CONDITION("按成员投影有序", std::ranges::is_sorted(records, lessView, [](const Record& r) { return StringView(r.Name); }))
+
+			bool idMatched = true;
+			for (const Record& r : records)
+				idMatched = idMatched && storage[r.Id] == r.Name;
+			UNIT_TEST_CONDITION("记录整体被搬运", idMatched)
+
+			std::ranges::reverse(records);
+			StringRadixSort(records, [](const Record& r) { return r.Name; });
+			UNIT_TEST_CONDITION("投影按值返回String", std::ranges::is_sorted(records, lessView, [](const Record& r) { return StringView(r.Name); }))
+		}
+
+		UNIT_TEST_CHECKPOINT("U32String")
+		{
+			std::vector<U32String> v = { U"\x10000", U"b", U"\x100", U"a", U"" };
+			StringRadixSort(v);
+			UNIT_TEST_CONDITION("按码元大小排序", v[0].Empty() && v[1] == U"a" && v[2] == U"b" && v[3] == U"\x100" && v[4] == U"\x10000")
+		}
+	}
+	UNIT_TEST_AREA_END(TestStringSort)
+}
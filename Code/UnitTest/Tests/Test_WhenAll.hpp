@@ -0,0 +1,203 @@
+// File /UnitTest/Tests/Test_WhenAll.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Coroutine/Scheduler.h"
+#include "../../Engine/Coroutine/WhenAll.hpp"
+#include "../../Engine/Coroutine/WhenAny.hpp"
+#include "../UnitTestFramework.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	namespace Detail
+	{
+		inline PenEngine::AsyncTask<int> WhenAllValue(int value)
+		{
+			co_return value;
+		}
+
+		inline PenEngine::AsyncTask<void> WhenAllCount(std::atomic<int>& counter)
+		{
+			counter.fetch_add(1, std::memory_order::relaxed);
+			co_return;
+		}
+
+		inline PenEngine::AsyncTask<std::unique_ptr<int>> WhenAllUnique(int value)
+		{
+			co_return std::make_unique<int>(value);
+		}
+
+		inline PenEngine::AsyncTask<int> WhenAllYield()
+		{
+			co_yield 1;
+			co_return 2;
+		}
+
+		inline PenEngine::AsyncTask<int> WhenAllThrow(std::atomic<int>& counter)
+		{
+			counter.fetch_add(1, std::memory_order::relaxed);
+			throw std::runtime_error("when all");
+			co_return 0;
+		}
+
+		inline PenEngine::AsyncTask<int> WhenAllNested()
+		{
+			auto [a, b] = co_await PenEngine::WhenAll(WhenAllValue(1), WhenAllValue(2));
+			co_return a + b;
+		}
+
+		inline PenEngine::AsyncTask<PenEngine::u64> WhenAllOnWorker(PenEngine::Scheduler& scheduler, PenEngine::u64 value)
+		{
+			co_await scheduler.Schedule();
+			co_return value * 2;
+		}
+
+		inline PenEngine::AsyncTask<PenEngine::u64> WhenAllSum(std::vector<PenEngine::AsyncTask<PenEngine::u64>>& tasks)
+		{
+			PenEngine::u64 sum = 0;
+			for (PenEngine::u64 v : co_await PenEngine::WhenAll(tasks))
+				sum += v;
+			co_return sum;
+		}
+
+		inline PenEngine::AsyncTask<int> WhenAnyWait(PenEngine::Scheduler& scheduler, std::atomic<bool>& release, int value)
+		{
+			co_await scheduler.Schedule();
+			while (!release.load(std::memory_order::acquire))
+				std::this_thread::yield();
+			co_return value;
+		}
+	}
+
+	UNIT_TEST_AREA_BEGIN(TestWhenAll)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 WhenAll 与 WhenAny")
+
+		UNIT_TEST_CHECKPOINT("WhenAll")
+		{
+			std::atomic<int> counter = 0;
+			AsyncTask<std::tuple<int, std::monostate, std::unique_ptr<int>>> all = WhenAll(Detail::WhenAllValue(1), Detail::WhenAllCount(counter), Detail::WhenAllUnique(3));
+			auto& [value, empty, unique] = all.Get();
+			UNIT_TEST_CONDITION("可变参数", value == 1 && counter == 1 && unique && *unique == 3)
+
+			std::vector<AsyncTask<int>> tasks;
+			for (int i = 0; i < 20; ++i)
+				tasks.push_back(Detail::WhenAllValue(i));
+			AsyncTask<SmallVector<int, WhenAllInlineCapacity>> range = WhenAll(tasks);
+			SmallVector<int, WhenAllInlineCapacity>& results = range.Get();
+			bool ordered = results.size() == 20;
+			for (int i = 0; ordered && i < 20; ++i)
+				ordered = results[i] == i && tasks[i].Done();
+			UNIT_TEST_CONDITION("范围", ordered)
+
+			std::vector<AsyncTask<void>> voids;
+			for (int i = 0; i < 3; ++i)
+				voids.push_back(Detail::WhenAllCount(counter));
+			AsyncTask<SmallVector<std::monostate, WhenAllInlineCapacity>> moved = WhenAll(std::move(voids));
+			UNIT_TEST_CONDITION("右值范围", moved.Get().size() == 3 && counter == 4)
+
+			AsyncTask<int> nested = Detail::WhenAllNested();
+			UNIT_TEST_CONDITION("在协程中等待", nested.Get() == 3)
+
+			AsyncTask<int> yielding = Detail::WhenAllYield();
+			auto yielded = WhenAll(std::move(yielding), Detail::WhenAllValue(3));
+			UNIT_TEST_CONDITION("产出值的task取得产出的值", std::get<0>(yielded.Get()) == 1 && std::get<1>(yielded.Get()) == 3)
+		}
+
+		UNIT_TEST_CHECKPOINT("WhenAll 异常")
+		{
+			std::atomic<int> counter = 0;
+			auto all = WhenAll(Detail::WhenAllThrow(counter), Detail::WhenAllCount(counter), Detail::WhenAllThrow(counter));
+			bool thrown = false;
+			try
+			{
+				all.Get();
+			}
+			catch (const std::runtime_error&)
+			{
+				thrown = true;
+			}
+			UNIT_TEST_CONDITION("所有task结束后重新抛出", thrown && counter == 3)
+		}
+
+		UNIT_TEST_CHECKPOINT("WhenAll 与 Scheduler")
+		{
+			static constexpr u64 count = 500;
+			Scheduler scheduler(3);
+			std::vector<AsyncTask<u64>> tasks;
+			for (u64 i = 0; i < count; ++i)
+				tasks.push_back(Detail::WhenAllOnWorker(scheduler, i));
+
+			u64 frames = GetPooledCoroutineFrameCount();
+			AsyncTask<SmallVector<u64, WhenAllInlineCapacity>> all = WhenAll(tasks);
+			u64 sum = 0;
+			for (u64 v : all.Get())
+				sum += v;
+			UNIT_TEST_CONDITION("结果", sum == count * (count - 1))
+			UNIT_TEST_CONDITION("只额外分配WhenAll的协程帧", GetPooledCoroutineFrameCount() == frames + 1)
+
+			std::vector<AsyncTask<u64>> more;
+			for (u64 i = 0; i < count; ++i)
+				more.push_back(Detail::WhenAllOnWorker(scheduler, i));
+			AsyncTask<u64> summed = Detail::WhenAllSum(more);
+			UNIT_TEST_CONDITION("在协程中遍历临时task的结果", summed.Get() == count * (count - 1))
+		}
+
+		UNIT_TEST_CHECKPOINT("WhenAny")
+		{
+			AsyncTask<int> a = Detail::WhenAllValue(1);
+			AsyncTask<int> b = Detail::WhenAllValue(2);
+			AsyncTask<Usize> any = WhenAny(a, b);
+			UNIT_TEST_CONDITION("同步结束的task", any.Get() == 0 && a.Done() && !b.Done())
+			UNIT_TEST_CONDITION("未启动的task之后仍可执行", b.Get() == 2)
+
+			AsyncTask<int> y = Detail::WhenAllYield();
+			AsyncTask<int> c = Detail::WhenAllValue(3);
+			AsyncTask<Usize> yieldAny = WhenAny(y, c);
+			UNIT_TEST_CONDITION("产出值的task胜出", yieldAny.Get() == 0 && y.Result() == 1 && !y.Done() && !c.Done())
+			UNIT_TEST_CONDITION("之后仍可继续执行", y.Get() == 2 && y.Done())
+
+			std::vector<AsyncTask<int>> tasks;
+			tasks.push_back(Detail::WhenAllValue(10));
+			tasks.push_back(Detail::WhenAllValue(20));
+			tasks[0].Get();
+			AsyncTask<Usize> finished = WhenAny(tasks);
+			UNIT_TEST_CONDITION("已经结束的task", finished.Get() == 0 && !tasks[1].Done())
+
+			Scheduler scheduler(2);
+			std::atomic<bool> release = false;
+			std::atomic<bool> never = false;
+			AsyncTask<int> slow = Detail::WhenAnyWait(scheduler, never, 1);
+			AsyncTask<int> fast = Detail::WhenAnyWait(scheduler, release, 2);
+			AsyncTask<Usize> first = WhenAny(slow, fast);
+			std::thread releaser([&]
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(10));
+					release.store(true, std::memory_order::release);
+				});
+			UNIT_TEST_CONDITION("在工作线程上先结束的task", first.Get() == 1 && fast.Get() == 2 && !slow.Done())
+			releaser.join();
+
+			// 销毁前等待其余task结束
+			never.store(true, std::memory_order::release);
+			UNIT_TEST_CONDITION("其余task正常结束", slow.Get() == 1)
+		}
+	}
+	UNIT_TEST_AREA_END(TestWhenAll)
+}
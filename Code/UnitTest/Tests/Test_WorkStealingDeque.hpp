@@ -0,0 +1,97 @@
+// File /UnitTest/Tests/Test_WorkStealingDeque.hpp
+// This file is a part of PenFramework Project
+// https://github.com/PenNineCat/PenFramework
+//
+// Copyright (C) 2025 - Present PenNineCat. All rights reserved
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "../../Engine/Container/WorkStealingDeque.hpp"
+#include "../UnitTestFramework.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace PenFramework::UnitTest
+{
+	UNIT_TEST_AREA_BEGIN(TestWorkStealingDeque)
+	{
+		using namespace PenEngine;
+
+		UNIT_TEST_MESSAGE("测试 WorkStealingDeque")
+
+		UNIT_TEST_CHECKPOINT("单线程")
+		{
+			WorkStealingDeque<int> deque(4);
+			UNIT_TEST_CONDITION("空队列", !deque.Pop() && !deque.Steal() && deque.EmptyApprox())
+
+			for (int i = 0; i < 10; ++i)
+				deque.Push(i);
+			UNIT_TEST_CONDITION("扩容", deque.Capacity() == 16 && deque.SizeApprox() == 10)
+			UNIT_TEST_CONDITION("所有者后进先出", deque.Pop() == 9 && deque.Pop() == 8)
+			UNIT_TEST_CONDITION("窃取先进先出", deque.Steal() == 0 && deque.Steal() == 1)
+
+			bool drained = true;
+			for (int i = 7; i >= 2; --i)
+				drained = drained && deque.Pop() == i;
+			UNIT_TEST_CONDITION("取空", drained && !deque.Pop() && !deque.Steal())
+
+			// 下标在取空后继续增长，数组按下标取模
+			for (int i = 0; i < 100; ++i)
+			{
+				deque.Push(i);
+				deque.Push(i + 1);
+				drained = drained && deque.Steal() == i && deque.Pop() == i + 1;
+			}
+			UNIT_TEST_CONDITION("反复放入取出", drained && deque.EmptyApprox() && deque.Capacity() == 16)
+		}
+
+		UNIT_TEST_CHECKPOINT("多线程窃取")
+		{
+			// 所有者放入并取出，其他线程同时窃取，每个元素恰好被取走一次
+			static constexpr int count = 200000;
+			static constexpr int thieves = 3;
+			WorkStealingDeque<int> deque(8);
+			std::vector<std::atomic<U8>> taken(count);
+			std::atomic<bool> done = false;
+
+			std::vector<std::thread> threads;
+			for (int t = 0; t < thieves; ++t)
+			{
+				threads.emplace_back([&]
+					{
+						while (!done.load(std::memory_order::acquire) || !deque.EmptyApprox())
+						{
+							if (std::optional<int> value = deque.Steal())
+								taken[*value].fetch_add(1, std::memory_order::relaxed);
+						}
+					});
+			}
+
+			for (int i = 0; i < count; ++i)
+			{
+				deque.Push(i);
+				if (i % 3 == 0)
+				{
+					if (std::optional<int> value = deque.Pop())
+						taken[*value].fetch_add(1, std::memory_order::relaxed);
+				}
+			}
+			while (std::optional<int> value = deque.Pop())
+				taken[*value].fetch_add(1, std::memory_order::relaxed);
+			done.store(true, std::memory_order::release);
+			for (auto& thread : threads)
+				thread.join();
+
+			bool once = true;
+			for (auto& flag : taken)
+				once = once && flag.load(std::memory_order::relaxed) == 1;
+			UNIT_TEST_CONDITION("每个元素恰好取走一次", once)
+		}
+	}
+	UNIT_TEST_AREA_END(TestWorkStealingDeque)
+}
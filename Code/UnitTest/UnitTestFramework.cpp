@@ -35,7 +35,7 @@ void PenFramework::UnitTest::Core::UnitTestManager::Register(PenEngine::StringVi
 {
 	auto it = m_registerUnitTest.find(filename);
 	if (it == m_registerUnitTest.end())
-		it = m_registerUnitTest.emplace(PenEngine::String(filename), std::vector<UnitTestNode>()).first;
+		it = m_registerUnitTest.emplace(PenEngine::String(filename), PenEngine::SmallVector<UnitTestNode, 4>()).first;
 
 	it->second.emplace_back(PenEngine::String(testName), ptr);
 }
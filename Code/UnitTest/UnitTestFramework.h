@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "../Engine/Container/SmallVector.hpp"
 #include "../Engine/String/String.hpp"
 #include "../Engine/String/StringUnorderedMap.hpp"
 #include "../Engine/Utils/Preprocessor.hpp"
@@ -130,7 +131,7 @@ namespace PenFramework::UnitTest::Core
 			InvokerPtr InvokerPtr;
 		};
 
-		PenEngine::StringUnorderedMap<std::vector<UnitTestNode>> m_registerUnitTest;
+		PenEngine::StringUnorderedMap<PenEngine::SmallVector<UnitTestNode, 4>> m_registerUnitTest;
 		std::unique_ptr<IUnitContext> m_context;
 	};
 